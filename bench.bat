@@ -0,0 +1,8 @@
+@echo off
+echo Running benchmarks...
+build\bin\Release\ShoeEngine_bench.exe --benchmark_out=bench_results.json --benchmark_out_format=json > bench_output.txt 2>&1
+IF %ERRORLEVEL% EQU 0 (
+    echo Benchmarks finished! Output saved to bench_output.txt and bench_results.json
+) ELSE (
+    echo Benchmarks failed! Check bench_output.txt for details
+)
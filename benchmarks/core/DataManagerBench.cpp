@@ -0,0 +1,168 @@
+#include <benchmark/benchmark.h>
+#include "core/DataManager.h"
+#include "bayou/BayouStateManager.h"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ShoeEngine;
+using namespace ShoeEngine::Core;
+
+namespace {
+
+// A save-sized document: the Bayou state plus a large section no manager is registered for
+const std::string& GeneratedDocument() {
+    static const std::string document = [] {
+        nlohmann::json board = nlohmann::json::array();
+        for (int i = 0; i < Bayou::BayouState::kBoardNumSquares; ++i) {
+            board.push_back(i % 3 == 0 ? Bayou::BayouState::EncodeOccupied(i % 2, i / 6) : 0);
+        }
+        nlohmann::json player1 = nlohmann::json::array();
+        nlohmann::json player2 = nlohmann::json::array();
+        for (int i = 0; i < 32; ++i) {
+            player1.push_back({ {"type", "Gator"}, {"boardIndex", i} });
+            player2.push_back({ {"type", "Frog"}, {"boardIndex", 63 - i} });
+        }
+
+        nlohmann::json history = nlohmann::json::array();
+        for (int i = 0; i < 20000; ++i) {
+            history.push_back({ {"turn", i}, {"from", i % 64}, {"to", (i * 7) % 64}, {"note", "moved"} });
+        }
+
+        nlohmann::json json = {
+            {"bayou_state", { {"board", board}, {"pieces", { {"player1", player1}, {"player2", player2} }} }},
+            {"history", history}
+        };
+        return json.dump();
+    }();
+    return document;
+}
+
+// Holds a large section, like a long move history; tracking can be turned off
+class HistoryManager : public BaseManager {
+public:
+    HistoryManager(DataManager& dataManager, bool tracksChanges)
+        : BaseManager(dataManager)
+        , m_tracksChanges(tracksChanges) {
+        dataManager.RegisterString("history");
+    }
+
+    bool CreateFromJson(const nlohmann::json& jsonData) override {
+        m_history = jsonData;
+        return true;
+    }
+    Hash::HashValue GetManagedType() const override { return "history"_h; }
+    nlohmann::json SerializeToJson() override { return m_history; }
+    bool TracksChanges() const override { return m_tracksChanges; }
+
+private:
+    nlohmann::json m_history;
+    bool m_tracksChanges;
+};
+
+// A loaded world where only the Bayou board changes between saves
+struct SaveWorld {
+    explicit SaveWorld(bool tracksChanges) {
+        auto bayou = std::make_unique<Bayou::BayouStateManager>(dataManager);
+        state = &bayou->GetState();
+        dataManager.RegisterManager(std::move(bayou));
+        dataManager.RegisterManager(std::make_unique<HistoryManager>(dataManager, tracksChanges));
+        dataManager.ProcessData(nlohmann::json::parse(GeneratedDocument()));
+    }
+
+    void MovePiece() {
+        state->RemovePiece(0, 0);
+        state->PlaceNewPiece(0, 0, 0, "Gator"_h);
+    }
+
+    DataManager dataManager;
+    Bayou::BayouState* state = nullptr;
+};
+
+} // namespace
+
+// Arg: 1 if managers track changes, so the unchanged history section is not serialized again
+static void BM_DataManager_SaveToFile(benchmark::State& state) {
+    SaveWorld world(state.range(0) != 0);
+    for (auto _ : state) {
+        world.MovePiece();
+        benchmark::DoNotOptimize(world.dataManager.SaveToFile("bench_save.json"));
+    }
+    std::remove("bench_save.json");
+}
+BENCHMARK(BM_DataManager_SaveToFile)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Main thread part of an autosave: the snapshot alone
+static void BM_DataManager_TakeSnapshot(benchmark::State& state) {
+    SaveWorld world(state.range(0) != 0);
+    world.dataManager.SaveToFile("bench_save.json");
+    for (auto _ : state) {
+        world.MovePiece();
+        benchmark::DoNotOptimize(world.dataManager.TakeSnapshot());
+    }
+    std::remove("bench_save.json");
+}
+BENCHMARK(BM_DataManager_TakeSnapshot)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+static void BM_DataManager_AppendDelta(benchmark::State& state) {
+    SaveWorld world(true);
+    world.dataManager.SaveToFile("bench_save.json");
+    std::remove("bench_save.delta");
+    for (auto _ : state) {
+        world.MovePiece();
+        DataManager::Snapshot snapshot = world.dataManager.TakeSnapshot();
+        benchmark::DoNotOptimize(world.dataManager.AppendDelta(snapshot, "bench_save.delta"));
+    }
+    std::remove("bench_save.json");
+    std::remove("bench_save.delta");
+}
+BENCHMARK(BM_DataManager_AppendDelta)->Unit(benchmark::kMicrosecond);
+
+static void BM_DataManager_ProcessData(benchmark::State& state) {
+    const std::string& document = GeneratedDocument();
+    DataManager dataManager;
+    dataManager.RegisterManager(std::make_unique<Bayou::BayouStateManager>(dataManager));
+
+    for (auto _ : state) {
+        std::istringstream input(document);
+        nlohmann::json json;
+        input >> json;
+        benchmark::DoNotOptimize(dataManager.ProcessData(json));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(document.size()));
+}
+BENCHMARK(BM_DataManager_ProcessData)->Unit(benchmark::kMillisecond);
+
+static void BM_DataManager_ProcessStream(benchmark::State& state) {
+    const std::string& document = GeneratedDocument();
+    DataManager dataManager;
+    dataManager.RegisterManager(std::make_unique<Bayou::BayouStateManager>(dataManager));
+
+    for (auto _ : state) {
+        std::istringstream input(document);
+        benchmark::DoNotOptimize(dataManager.ProcessStream(input));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(document.size()));
+}
+BENCHMARK(BM_DataManager_ProcessStream)->Unit(benchmark::kMillisecond);
+
+// Arg: number of distinct strings; each is registered 8 times, as ids repeat across sections
+static void BM_DataManager_RegisterString(benchmark::State& state) {
+    std::vector<std::string> strings;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        strings.push_back("sprite_" + std::to_string(i) + "_walk_cycle_frame");
+    }
+
+    for (auto _ : state) {
+        DataManager dataManager;
+        for (int repeat = 0; repeat < 8; ++repeat) {
+            for (const std::string& str : strings) {
+                benchmark::DoNotOptimize(dataManager.RegisterString(str));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_DataManager_RegisterString)->Arg(1000)->Arg(10000);
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include "core/FlatHashMap.h"
+#include "core/Hash.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace ShoeEngine::Core;
+
+namespace {
+
+struct Payload {
+    float x = 0.0f;
+    float y = 0.0f;
+    uint32_t id = 0;
+};
+
+using StdMap = std::unordered_map<Hash::HashValue, Payload, Hash::Hasher>;
+using FlatMap = FlatHashMap<Hash::HashValue, Payload>;
+
+// Keys hashed from generated names, the way the managers key their maps
+std::vector<Hash::HashValue> MakeKeys(size_t count, const char* prefix) {
+    std::vector<Hash::HashValue> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys.emplace_back(prefix + std::to_string(i));
+    }
+    return keys;
+}
+
+// The same keys in random order, so lookups do not walk memory in insertion order
+std::vector<Hash::HashValue> Shuffled(std::vector<Hash::HashValue> keys) {
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+    return keys;
+}
+
+template<typename Map>
+Map MakeMap(const std::vector<Hash::HashValue>& keys) {
+    Map map;
+    map.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        map[keys[i]] = Payload{ static_cast<float>(i), 1.0f, static_cast<uint32_t>(i) };
+    }
+    return map;
+}
+
+} // namespace
+
+template<typename Map>
+static void BM_HashMap_Insert(benchmark::State& state) {
+    const auto keys = MakeKeys(static_cast<size_t>(state.range(0)), "key_");
+    for (auto _ : state) {
+        Map map;
+        for (const auto& key : keys) {
+            map[key].id = key;
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Map>
+static void BM_HashMap_LookupHit(benchmark::State& state) {
+    const auto keys = MakeKeys(static_cast<size_t>(state.range(0)), "key_");
+    const Map map = MakeMap<Map>(keys);
+    const auto lookups = Shuffled(keys);
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (const auto& key : lookups) {
+            sum += map.find(key)->second.id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Map>
+static void BM_HashMap_LookupMiss(benchmark::State& state) {
+    const Map map = MakeMap<Map>(MakeKeys(static_cast<size_t>(state.range(0)), "key_"));
+    const auto missing = MakeKeys(static_cast<size_t>(state.range(0)), "missing_");
+    for (auto _ : state) {
+        size_t found = 0;
+        for (const auto& key : missing) {
+            found += map.find(key) != map.end();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Map>
+static void BM_HashMap_Iterate(benchmark::State& state) {
+    const Map map = MakeMap<Map>(MakeKeys(static_cast<size_t>(state.range(0)), "key_"));
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto& [key, payload] : map) {
+            sum += payload.x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_HashMap_Insert, StdMap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_HashMap_Insert, FlatMap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_HashMap_LookupHit, StdMap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_HashMap_LookupHit, FlatMap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_HashMap_LookupMiss, StdMap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_HashMap_LookupMiss, FlatMap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_HashMap_Iterate, StdMap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_HashMap_Iterate, FlatMap)->RangeMultiplier(10)->Range(1000, 1000000);
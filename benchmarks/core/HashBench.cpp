@@ -0,0 +1,251 @@
+#include <benchmark/benchmark.h>
+#include "core/Hash.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace ShoeEngine::Core;
+
+// Speed and quality of the Core::Hash functions.
+//
+// Quality cases report their results as counters rather than times:
+//   chi2     Chi-squared of a bucket histogram divided by its degrees of freedom; about 1
+//            for a uniform hash, much larger when keys pile into few buckets
+//   worst    Largest avalanche bias over all input/output bit pairs; 0 means every output
+//            bit flips with probability 1/2 when any input bit flips, 1 means never or always
+//   mean     Average avalanche bias
+// Run with --benchmark_out=<file> --benchmark_out_format=json to record them.
+
+namespace {
+
+struct FNV1a {
+    static constexpr int BITS = 32;
+    static uint64_t Compute(const std::string& key) {
+        return Hash::FNV1a(key.data(), static_cast<uint32_t>(key.size()));
+    }
+};
+
+struct MurmurHash3 {
+    static constexpr int BITS = 32;
+    static uint64_t Compute(const std::string& key) {
+        return Hash::MurmurHash3(key.data(), static_cast<uint32_t>(key.size()));
+    }
+};
+
+struct Universal {
+    static constexpr int BITS = 32;
+    static uint64_t Compute(const std::string& key) {
+        return Hash::Universal(key.c_str());
+    }
+};
+
+struct Hash64 {
+    static constexpr int BITS = 64;
+    static uint64_t Compute(const std::string& key) {
+        return Hash::Hash64(key.data(), key.size());
+    }
+};
+
+// Registry-style ids, mostly under 16 bytes
+const std::vector<std::string>& Ids() {
+    static const std::vector<std::string> ids = [] {
+        std::vector<std::string> result;
+        for (int i = 0; i < 65536; ++i) {
+            result.push_back("sprite_" + std::to_string(i));
+        }
+        return result;
+    }();
+    return ids;
+}
+
+// Random bytes that are never zero and never a power of two, so flipping any single bit
+// cannot produce a null character (Universal stops at the first one)
+std::string RandomKey(std::mt19937& random, size_t length) {
+    std::string key(length, '\0');
+    for (char& c : key) {
+        uint8_t byte;
+        do {
+            byte = static_cast<uint8_t>(random());
+        } while ((byte & (byte - 1)) == 0);
+        c = static_cast<char>(byte);
+    }
+    return key;
+}
+
+} // namespace
+
+template<typename Function>
+static void BM_Hash_KeyLength(benchmark::State& state) {
+    std::mt19937 random(1);
+    const std::string key = RandomKey(random, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Function::Compute(key));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Hash_KeyLength, FNV1a)->RangeMultiplier(4)->Range(1, 64 << 10);
+BENCHMARK_TEMPLATE(BM_Hash_KeyLength, MurmurHash3)->RangeMultiplier(4)->Range(1, 64 << 10);
+BENCHMARK_TEMPLATE(BM_Hash_KeyLength, Universal)->RangeMultiplier(4)->Range(1, 64 << 10);
+BENCHMARK_TEMPLATE(BM_Hash_KeyLength, Hash64)->RangeMultiplier(4)->Range(1, 64 << 10);
+
+template<typename Function>
+static void BM_Hash_Ids(benchmark::State& state) {
+    const auto& ids = Ids();
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& id : ids) {
+            sum += Function::Compute(id);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ids.size()));
+}
+BENCHMARK_TEMPLATE(BM_Hash_Ids, FNV1a);
+BENCHMARK_TEMPLATE(BM_Hash_Ids, MurmurHash3);
+BENCHMARK_TEMPLATE(BM_Hash_Ids, Universal);
+BENCHMARK_TEMPLATE(BM_Hash_Ids, Hash64);
+
+static void BM_Hash_Hash64Batch(benchmark::State& state) {
+    const std::vector<std::string_view> keys(Ids().begin(), Ids().end());
+    std::vector<uint64_t> hashes(keys.size());
+    for (auto _ : state) {
+        Hash::Hash64Batch(keys.data(), keys.size(), hashes.data());
+        benchmark::DoNotOptimize(hashes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(keys.size()));
+}
+BENCHMARK(BM_Hash_Hash64Batch);
+
+static void BM_Hash_Hash64Stream(benchmark::State& state) {
+    const std::vector<char> data(1 << 20, 'x');
+    const size_t chunkSize = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Hash::Hash64Stream stream;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            stream.Update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        benchmark::DoNotOptimize(stream.Finalize());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(BM_Hash_Hash64Stream)->Arg(100)->Arg(4096)->Arg(1 << 20);
+
+static void BM_Hash_HashFile(benchmark::State& state) {
+    const auto path = (std::filesystem::temp_directory_path() / "shoeengine_bench_hash.bin").string();
+    const std::vector<char> data(64 << 20, 'x');
+    std::ofstream(path, std::ios::binary).write(data.data(), static_cast<std::streamsize>(data.size()));
+
+    for (auto _ : state) {
+        Hash::HashValue64 hash;
+        benchmark::DoNotOptimize(Hash::HashFile(path, hash));
+        benchmark::DoNotOptimize(hash);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_Hash_HashFile)->Unit(benchmark::kMillisecond);
+
+// Histogram of the low bits of each hash, as a power-of-two table indexes buckets
+template<typename Function>
+static void BM_HashQuality_Buckets(benchmark::State& state) {
+    constexpr size_t BUCKETS = 1024;
+    const auto& ids = Ids();
+    double chi2 = 0.0;
+    for (auto _ : state) {
+        std::array<size_t, BUCKETS> counts{};
+        for (const auto& id : ids) {
+            ++counts[Function::Compute(id) & (BUCKETS - 1)];
+        }
+        const double expected = static_cast<double>(ids.size()) / BUCKETS;
+        chi2 = 0.0;
+        for (size_t count : counts) {
+            chi2 += (count - expected) * (count - expected) / expected;
+        }
+    }
+    state.counters["chi2"] = chi2 / (BUCKETS - 1);
+}
+BENCHMARK_TEMPLATE(BM_HashQuality_Buckets, FNV1a)->Iterations(1);
+BENCHMARK_TEMPLATE(BM_HashQuality_Buckets, MurmurHash3)->Iterations(1);
+BENCHMARK_TEMPLATE(BM_HashQuality_Buckets, Universal)->Iterations(1);
+BENCHMARK_TEMPLATE(BM_HashQuality_Buckets, Hash64)->Iterations(1);
+
+// Flips each bit of random 16-byte keys and measures how often each output bit follows
+template<typename Function>
+static void BM_HashQuality_Avalanche(benchmark::State& state) {
+    constexpr int KEYS = 2000;
+    constexpr int KEY_BITS = 16 * 8;
+    double worst = 0.0;
+    double mean = 0.0;
+    for (auto _ : state) {
+        std::vector<uint32_t> flips(KEY_BITS * Function::BITS, 0);
+        std::mt19937 random(2);
+        for (int k = 0; k < KEYS; ++k) {
+            std::string key = RandomKey(random, 16);
+            const uint64_t original = Function::Compute(key);
+            for (int bit = 0; bit < KEY_BITS; ++bit) {
+                key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+                const uint64_t changed = Function::Compute(key) ^ original;
+                key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+                for (int out = 0; out < Function::BITS; ++out) {
+                    flips[bit * Function::BITS + out] += (changed >> out) & 1;
+                }
+            }
+        }
+
+        worst = 0.0;
+        mean = 0.0;
+        for (uint32_t count : flips) {
+            const double bias = std::abs(2.0 * count / KEYS - 1.0);
+            worst = std::max(worst, bias);
+            mean += bias;
+        }
+        mean /= flips.size();
+    }
+    state.counters["worst"] = worst;
+    state.counters["mean"] = mean;
+}
+BENCHMARK_TEMPLATE(BM_HashQuality_Avalanche, FNV1a)->Iterations(1);
+BENCHMARK_TEMPLATE(BM_HashQuality_Avalanche, MurmurHash3)->Iterations(1);
+BENCHMARK_TEMPLATE(BM_HashQuality_Avalanche, Universal)->Iterations(1);
+BENCHMARK_TEMPLATE(BM_HashQuality_Avalanche, Hash64)->Iterations(1);
+
+// std::unordered_map lookups keyed by HashValue. Argument 1 selects the key set:
+// 0 = hashed names, 1 = counter ids spaced 4096 apart, whose low bits are all zero.
+template<typename HasherType>
+static void BM_Hash_MapLookup(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::vector<Hash::HashValue> keys;
+    for (size_t i = 0; i < count; ++i) {
+        keys.push_back(state.range(1) == 0
+            ? Hash::HashValue("key_" + std::to_string(i))
+            : Hash::HashValue(static_cast<uint32_t>(i << 12)));
+    }
+
+    std::unordered_map<Hash::HashValue, uint32_t, HasherType> map;
+    map.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        map[keys[i]] = static_cast<uint32_t>(i);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (const auto& key : keys) {
+            sum += map.find(key)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.counters["buckets"] = static_cast<double>(map.bucket_count());
+}
+BENCHMARK_TEMPLATE(BM_Hash_MapLookup, Hash::Hasher)->ArgsProduct({ { 1000, 100000 }, { 0, 1 } });
+BENCHMARK_TEMPLATE(BM_Hash_MapLookup, Hash::MixingHasher)->ArgsProduct({ { 1000, 100000 }, { 0, 1 } });
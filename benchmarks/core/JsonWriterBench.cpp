@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include "core/JsonWriter.h"
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+using namespace ShoeEngine::Core;
+
+namespace {
+
+// What SpriteManager saves of one sprite
+struct SpriteRecord {
+    std::string name;
+    std::string image;
+    float x, y, rotation, scaleX, scaleY, originX, originY;
+};
+
+std::vector<SpriteRecord> MakeSprites(size_t count) {
+    std::vector<SpriteRecord> sprites;
+    sprites.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i);
+        sprites.push_back({ "sprite_" + std::to_string(i), "image_" + std::to_string(i % 64),
+            f * 1.5f, f * 0.25f, f * 0.1f, 1.0f, 2.0f, 8.0f, 8.0f });
+    }
+    return sprites;
+}
+
+// The previous SerializeToJson: a tree of small objects, then dump
+std::string SerializeDom(const std::vector<SpriteRecord>& sprites, int indent) {
+    nlohmann::json spritesObject = nlohmann::json::object();
+    for (const SpriteRecord& sprite : sprites) {
+        nlohmann::json spriteJson;
+        spriteJson["image"] = sprite.image;
+        spriteJson["position"] = { {"x", sprite.x}, {"y", sprite.y} };
+        spriteJson["rotation"] = sprite.rotation;
+        spriteJson["scale"] = { {"x", sprite.scaleX}, {"y", sprite.scaleY} };
+        spriteJson["origin"] = { {"x", sprite.originX}, {"y", sprite.originY} };
+        spritesObject[sprite.name] = spriteJson;
+    }
+    return spritesObject.dump(indent);
+}
+
+void WritePair(JsonWriter& writer, const char* key, float x, float y) {
+    writer.Key(key);
+    writer.StartObject();
+    writer.Key("x");
+    writer.Float(x);
+    writer.Key("y");
+    writer.Float(y);
+    writer.EndObject();
+}
+
+void SerializeWriter(const std::vector<SpriteRecord>& sprites, JsonWriter& writer) {
+    writer.Reset();
+    writer.StartObject();
+    for (const SpriteRecord& sprite : sprites) {
+        writer.Key(sprite.name);
+        writer.StartObject();
+        writer.Key("image");
+        writer.String(sprite.image);
+        WritePair(writer, "origin", sprite.originX, sprite.originY);
+        WritePair(writer, "position", sprite.x, sprite.y);
+        writer.Key("rotation");
+        writer.Float(sprite.rotation);
+        WritePair(writer, "scale", sprite.scaleX, sprite.scaleY);
+        writer.EndObject();
+    }
+    writer.EndObject();
+}
+
+} // namespace
+
+// Args: sprite count, indent (-1 compact, 4 pretty)
+static void BM_SerializeSprites_Dom(benchmark::State& state) {
+    const auto sprites = MakeSprites(static_cast<size_t>(state.range(0)));
+    const int indent = static_cast<int>(state.range(1));
+    size_t bytes = 0;
+    for (auto _ : state) {
+        const std::string text = SerializeDom(sprites, indent);
+        bytes = text.size();
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerializeSprites_Dom)->ArgsProduct({ {1000, 100000}, {-1, 4} })->Unit(benchmark::kMillisecond);
+
+// The writer's buffer is reused across iterations, as DataManager reuses it across sections
+static void BM_SerializeSprites_Writer(benchmark::State& state) {
+    const auto sprites = MakeSprites(static_cast<size_t>(state.range(0)));
+    JsonWriter writer(static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        SerializeWriter(sprites, writer);
+        benchmark::DoNotOptimize(writer.GetBuffer().data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(writer.GetBuffer().size()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerializeSprites_Writer)->ArgsProduct({ {1000, 100000}, {-1, 4} })->Unit(benchmark::kMillisecond);
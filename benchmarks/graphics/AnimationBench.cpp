@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include "graphics/AnimationManager.h"
+#include "core/DataManager.h"
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ShoeEngine;
+using namespace ShoeEngine::Graphics;
+
+namespace {
+
+constexpr int ANIMATION_COUNT = 8;
+constexpr float FRAME_TIME = 1.0f / 60.0f;
+
+// A 256x32 sheet of eight 32x32 frames, and animations of it whose frame durations range from
+// 0.05 to 0.4 seconds, so sprites change frame on different updates
+struct AnimatedScene {
+    Core::DataManager dataManager;
+    ImageManager imageManager{ dataManager };
+    SpriteManager spriteManager{ dataManager, imageManager };
+    AnimationManager animationManager{ dataManager, imageManager, spriteManager };
+};
+
+std::unique_ptr<AnimatedScene> MakeScene(size_t spriteCount) {
+    auto scene = std::make_unique<AnimatedScene>();
+    const std::string file = (std::filesystem::temp_directory_path() / "shoeengine_bench_sheet.png").string();
+    std::vector<uint8_t> pixels(256 * 32 * 4, 255);
+    Image(pixels.data(), 256, 32).SaveToFile(file);
+    scene->imageManager.CreateFromJson({ {"sheet", {{"file", file}}} });
+
+    nlohmann::json animations = nlohmann::json::object();
+    for (int a = 0; a < ANIMATION_COUNT; ++a) {
+        nlohmann::json frames = nlohmann::json::array();
+        for (int i = 0; i < 8; ++i) {
+            frames.push_back({ {"x", 32 * i}, {"y", 0}, {"width", 32}, {"height", 32} });
+        }
+        animations["anim_" + std::to_string(a)] = { {"image", "sheet"}, {"frameDuration", 0.05f * (a + 1)}, {"frames", frames} };
+    }
+    scene->animationManager.CreateFromJson(animations);
+
+    std::mt19937 random(11);
+    for (size_t i = 0; i < spriteCount; ++i) {
+        const SpriteHandle sprite = scene->spriteManager.CreateSprite("sprite_" + std::to_string(i), "sheet");
+        const std::string animation = "anim_" + std::to_string(random() % ANIMATION_COUNT);
+        scene->animationManager.Play(sprite, Core::Hash::HashValue(animation));
+        // Spread the sprites over their cycles
+        if (i % 64 == 63) {
+            scene->animationManager.Update(FRAME_TIME);
+        }
+    }
+    return scene;
+}
+
+} // namespace
+
+// One 60 Hz frame of AnimationManager::Update
+// Arg: animated sprite count
+static void BM_Animation_Update(benchmark::State& state) {
+    const auto scene = MakeScene(static_cast<size_t>(state.range(0)));
+    size_t changed = 0;
+    for (auto _ : state) {
+        changed += scene->animationManager.Update(FRAME_TIME);
+    }
+    state.counters["changed"] = benchmark::Counter(static_cast<double>(changed) / static_cast<double>(state.iterations()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Animation_Update)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+// Update followed by recomputing the bounds of the sprites whose frame changed
+static void BM_Animation_UpdateAndTransforms(benchmark::State& state) {
+    const auto scene = MakeScene(static_cast<size_t>(state.range(0)));
+    SpriteStorage& storage = scene->spriteManager.GetStorage();
+    storage.UpdateTransforms();
+    for (auto _ : state) {
+        scene->animationManager.Update(FRAME_TIME);
+        benchmark::DoNotOptimize(storage.UpdateTransforms());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Animation_UpdateAndTransforms)->Arg(10000)->Unit(benchmark::kMicrosecond);
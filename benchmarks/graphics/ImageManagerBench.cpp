@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include "graphics/ImageManager.h"
+#include "core/DataManager.h"
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+using namespace ShoeEngine::Core;
+
+namespace {
+
+constexpr int IMAGE_COUNT = 64;
+constexpr unsigned int IMAGE_SIZE = 256;
+
+// Writes IMAGE_COUNT noisy PNGs once per run and returns the "images" section loading them.
+// Noise keeps the PNGs from compressing to nothing, so decoding does real work.
+const nlohmann::json& GeneratedImageSet() {
+    static const nlohmann::json images = [] {
+        const auto directory = std::filesystem::temp_directory_path() / "shoeengine_bench_images";
+        std::filesystem::create_directories(directory);
+
+        std::vector<uint8_t> pixels(IMAGE_SIZE * IMAGE_SIZE * 4);
+        uint32_t seed = 12345;
+        nlohmann::json json = nlohmann::json::object();
+        for (int i = 0; i < IMAGE_COUNT; ++i) {
+            for (size_t p = 0; p < pixels.size(); ++p) {
+                seed = seed * 1664525u + 1013904223u;
+                pixels[p] = static_cast<uint8_t>((p % 4 == 3) ? 255 : (seed >> 24));
+            }
+            const std::string file = (directory / ("image_" + std::to_string(i) + ".png")).string();
+            Image(pixels.data(), IMAGE_SIZE, IMAGE_SIZE).SaveToFile(file);
+            json["image_" + std::to_string(i)] = { { "file", file } };
+        }
+        return json;
+    }();
+    return images;
+}
+
+} // namespace
+
+// Arg: number of decode threads
+static void BM_ImageManager_CreateFromJson(benchmark::State& state) {
+    const nlohmann::json& images = GeneratedImageSet();
+    DataManager dataManager;
+    ImageManager manager(dataManager);
+    manager.SetDecodeThreadCount(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        if (!manager.CreateFromJson(images)) {
+            state.SkipWithError("Failed to load generated images");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * IMAGE_COUNT);
+}
+BENCHMARK(BM_ImageManager_CreateFromJson)
+    ->Arg(1)->Arg(2)->Arg(4)->Arg(8)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Arg: number of decode threads. Loads the same set with a warm decoded-pixel cache.
+static void BM_ImageManager_CreateFromJson_WarmCache(benchmark::State& state) {
+    const nlohmann::json& images = GeneratedImageSet();
+    const auto cacheDirectory = std::filesystem::temp_directory_path() / "shoeengine_bench_decoded_cache";
+    DataManager dataManager;
+    ImageManager manager(dataManager);
+    manager.SetDecodeThreadCount(static_cast<size_t>(state.range(0)));
+    manager.SetDecodedCacheDirectory(cacheDirectory.string());
+
+    // Warm the cache
+    if (!manager.CreateFromJson(images)) {
+        state.SkipWithError("Failed to load generated images");
+        return;
+    }
+
+    for (auto _ : state) {
+        if (!manager.CreateFromJson(images)) {
+            state.SkipWithError("Failed to load generated images");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * IMAGE_COUNT);
+    state.counters["hits"] = static_cast<double>(manager.GetDecodedCache()->GetStats().hits);
+}
+BENCHMARK(BM_ImageManager_CreateFromJson_WarmCache)
+    ->Arg(1)->Arg(4)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
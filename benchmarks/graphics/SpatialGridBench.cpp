@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include "graphics/SpatialGrid.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+
+namespace {
+
+// 64x64 sprites at one per 4096 square units, so a 1280x720 view shows about 225 of them
+// whatever the sprite count
+std::vector<sf::FloatRect> MakeWorld(size_t count) {
+    const float side = std::sqrt(static_cast<float>(count) * 4096.0f);
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(0.0f, side);
+    std::vector<sf::FloatRect> bounds;
+    bounds.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        bounds.emplace_back(position(random), position(random), 64.0f, 64.0f);
+    }
+    return bounds;
+}
+
+SpatialGrid MakeGrid(const std::vector<sf::FloatRect>& bounds) {
+    SpatialGrid grid(128.0f);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        grid.Update(static_cast<uint32_t>(i), bounds[i]);
+    }
+    return grid;
+}
+
+const sf::FloatRect VIEW(1000.0f, 1000.0f, 1280.0f, 720.0f);
+
+} // namespace
+
+// Arg: sprite count
+static void BM_Culling_LinearScan(benchmark::State& state) {
+    const std::vector<sf::FloatRect> bounds = MakeWorld(static_cast<size_t>(state.range(0)));
+    std::vector<uint32_t> visible;
+    for (auto _ : state) {
+        visible.clear();
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            if (bounds[i].intersects(VIEW)) {
+                visible.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.counters["visible"] = static_cast<double>(visible.size());
+}
+BENCHMARK(BM_Culling_LinearScan)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_Culling_SpatialGrid(benchmark::State& state) {
+    const SpatialGrid grid = MakeGrid(MakeWorld(static_cast<size_t>(state.range(0))));
+    std::vector<uint32_t> visible;
+    for (auto _ : state) {
+        visible.clear();
+        grid.QueryRect(VIEW, visible);
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.counters["visible"] = static_cast<double>(visible.size());
+}
+BENCHMARK(BM_Culling_SpatialGrid)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_Picking_SpatialGrid(benchmark::State& state) {
+    const std::vector<sf::FloatRect> bounds = MakeWorld(static_cast<size_t>(state.range(0)));
+    const SpatialGrid grid = MakeGrid(bounds);
+    std::vector<uint32_t> hits;
+    size_t target = 0;
+    for (auto _ : state) {
+        hits.clear();
+        const sf::FloatRect& aim = bounds[target++ % bounds.size()];
+        grid.QueryPoint(aim.left + 1.0f, aim.top + 1.0f, hits);
+        benchmark::DoNotOptimize(hits.data());
+    }
+}
+BENCHMARK(BM_Picking_SpatialGrid)->Arg(10000)->Arg(100000);
+
+// A tenth of the sprites move a few units per frame
+static void BM_SpatialGrid_UpdateMoving(benchmark::State& state) {
+    std::vector<sf::FloatRect> bounds = MakeWorld(static_cast<size_t>(state.range(0)));
+    SpatialGrid grid = MakeGrid(bounds);
+    for (auto _ : state) {
+        for (size_t i = 0; i < bounds.size(); i += 10) {
+            bounds[i].left += 3.0f;
+            grid.Update(static_cast<uint32_t>(i), bounds[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 10);
+}
+BENCHMARK(BM_SpatialGrid_UpdateMoving)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
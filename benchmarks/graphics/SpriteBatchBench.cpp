@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include "graphics/SpriteBatch.h"
+#include <array>
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+
+namespace {
+
+// Build() never dereferences textures, so distinct addresses are enough to key
+// the batches without creating an OpenGL context.
+const sf::Texture* FakeTexture(size_t index) {
+    static std::array<unsigned char, 256> storage{};
+    return reinterpret_cast<const sf::Texture*>(&storage[index % storage.size()]);
+}
+
+sf::Transform MakeTransform(size_t index) {
+    sf::Transformable transformable;
+    transformable.setPosition(static_cast<float>(index % 640), static_cast<float>(index / 640));
+    transformable.setRotation(static_cast<float>(index % 360));
+    transformable.setScale(2.0f, 2.0f);
+    return transformable.getTransform();
+}
+
+} // namespace
+
+static void BM_SpriteBatch_AppendQuad(benchmark::State& state) {
+    const sf::Transform transform = MakeTransform(7);
+    const sf::IntRect rect(0, 0, 32, 32);
+    std::vector<sf::Vertex> vertices;
+    vertices.reserve(SpriteBatch::VERTICES_PER_SPRITE);
+
+    for (auto _ : state) {
+        vertices.clear();
+        SpriteBatch::AppendQuad(transform, rect, sf::Color::White, vertices);
+        benchmark::DoNotOptimize(vertices.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SpriteBatch_AppendQuad);
+
+// Args: sprite count, distinct texture count
+static void BM_SpriteBatch_Build(benchmark::State& state) {
+    const size_t spriteCount = static_cast<size_t>(state.range(0));
+    const size_t textureCount = static_cast<size_t>(state.range(1));
+
+    std::vector<sf::Transform> transforms;
+    transforms.reserve(spriteCount);
+    for (size_t i = 0; i < spriteCount; ++i) {
+        transforms.push_back(MakeTransform(i));
+    }
+
+    SpriteBatch batch;
+    const sf::IntRect rect(0, 0, 32, 32);
+    for (auto _ : state) {
+        batch.Begin();
+        for (size_t i = 0; i < spriteCount; ++i) {
+            batch.Draw(FakeTexture(i % textureCount), transforms[i], rect, sf::Color::White, static_cast<int>(i % 3));
+        }
+        batch.Build();
+        benchmark::DoNotOptimize(batch.GetVertices().data());
+    }
+    state.SetItemsProcessed(state.iterations() * spriteCount);
+    state.counters["batches"] = static_cast<double>(batch.GetLastStats().batches);
+}
+BENCHMARK(BM_SpriteBatch_Build)
+    ->ArgsProduct({ { 100, 1000, 10000, 100000 }, { 1, 4, 16 } })
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+#include "graphics/SpriteDrawOrder.h"
+#include "core/RadixSort.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace ShoeEngine;
+using namespace ShoeEngine::Graphics;
+
+namespace {
+
+// Sprites over 8 layers and 16 textures, at random depths
+struct Scene {
+    std::vector<std::shared_ptr<const sf::Texture>> textures;
+    SpriteStorage storage;
+};
+
+std::unique_ptr<Scene> MakeScene(size_t count) {
+    auto scene = std::make_unique<Scene>();
+    for (int i = 0; i < 16; ++i) {
+        scene->textures.push_back(std::make_shared<const sf::Texture>());
+    }
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> depth(-100.0f, 100.0f);
+    for (size_t i = 0; i < count; ++i) {
+        const SpriteHandle sprite = scene->storage.Create(static_cast<uint32_t>(i + 1));
+        scene->storage.SetImage(sprite, "image"_h, scene->textures[random() % 16], sf::IntRect(0, 0, 32, 32));
+        scene->storage.SetLayer(sprite, static_cast<int>(random() % 8));
+        scene->storage.SetDepth(sprite, depth(random));
+    }
+    return scene;
+}
+
+} // namespace
+
+// The per-frame cost of ordering every sprite with a comparison sort, as SpriteBatch used to
+// Arg: sprite count
+static void BM_DrawOrder_StableSort(benchmark::State& state) {
+    const auto scene = MakeScene(static_cast<size_t>(state.range(0)));
+    const SpriteStorage& storage = scene->storage;
+    std::vector<uint32_t> slots;
+    for (auto _ : state) {
+        slots.resize(storage.GetSlotCount());
+        for (size_t i = 0; i < slots.size(); ++i) {
+            slots[i] = static_cast<uint32_t>(i);
+        }
+        std::stable_sort(slots.begin(), slots.end(), [&](uint32_t a, uint32_t b) {
+            const auto& layers = storage.GetLayers();
+            if (layers[a] != layers[b]) {
+                return layers[a] < layers[b];
+            }
+            const auto& textures = storage.GetTextures();
+            if (textures[a] != textures[b]) {
+                return textures[a] < textures[b];
+            }
+            return storage.GetDepths()[a] < storage.GetDepths()[b];
+        });
+        benchmark::DoNotOptimize(slots.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DrawOrder_StableSort)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+// A full SpriteDrawOrder sort: build the packed keys and radix sort them
+static void BM_DrawOrder_RadixSort(benchmark::State& state) {
+    const auto scene = MakeScene(static_cast<size_t>(state.range(0)));
+    const SpriteHandle sprite = scene->storage.GetHandle(0);
+    SpriteDrawOrder order;
+    float depth = 0.0f;
+    for (auto _ : state) {
+        scene->storage.SetDepth(sprite, depth += 1.0f); // Forces a sort
+        benchmark::DoNotOptimize(order.Update(scene->storage));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DrawOrder_RadixSort)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+// Frames where sprites only moved: the order is reused
+static void BM_DrawOrder_Unchanged(benchmark::State& state) {
+    const auto scene = MakeScene(static_cast<size_t>(state.range(0)));
+    SpriteDrawOrder order;
+    order.Update(scene->storage);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(order.Update(scene->storage));
+    }
+}
+BENCHMARK(BM_DrawOrder_Unchanged)->Arg(100000);
+
+// Ordering a view's worth of culled slots by their rank
+static void BM_DrawOrder_SortVisible(benchmark::State& state) {
+    const auto scene = MakeScene(100000);
+    SpriteDrawOrder order;
+    order.Update(scene->storage);
+    std::mt19937 random(3);
+    std::vector<uint32_t> visible(static_cast<size_t>(state.range(0)));
+    for (uint32_t& slot : visible) {
+        slot = static_cast<uint32_t>(random() % 100000);
+    }
+    std::vector<uint32_t> slots;
+    for (auto _ : state) {
+        slots = visible;
+        order.Sort(slots);
+        benchmark::DoNotOptimize(slots.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DrawOrder_SortVisible)->Arg(256)->Arg(4096);
@@ -0,0 +1,135 @@
+#include <benchmark/benchmark.h>
+#include "graphics/Sprite.h"
+#include "graphics/SpriteStorage.h"
+#include "core/FlatHashMap.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ShoeEngine;
+using namespace ShoeEngine::Graphics;
+
+// The per-frame work of a sprite: move it, then compute its transform for drawing.
+// Compares sprites held one heap object each, iterated through a hash map as SpriteManager
+// used to, with the same sprites in a SpriteStorage.
+
+// Arg: sprite count
+static void BM_SpriteFrame_Objects(benchmark::State& state) {
+    Core::FlatHashMap<Core::Hash::HashValue, std::unique_ptr<Sprite>> sprites;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        auto sprite = std::make_unique<Sprite>();
+        sprite->SetPosition(static_cast<float>(i % 640), static_cast<float>(i / 640));
+        sprite->SetRotation(static_cast<float>(i % 360));
+        sprites[Core::Hash::HashValue("sprite_" + std::to_string(i))] = std::move(sprite);
+    }
+
+    for (auto _ : state) {
+        for (const auto& [name, sprite] : sprites) {
+            sprite->Move(1.0f, 0.5f);
+            benchmark::DoNotOptimize(sprite->GetSFMLSprite().getTransform());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpriteFrame_Objects)->Arg(1000)->Arg(100000);
+
+static void BM_SpriteFrame_Storage(benchmark::State& state) {
+    SpriteStorage storage;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        const SpriteHandle sprite = storage.Create(Core::Hash::HashValue("sprite_" + std::to_string(i)));
+        storage.SetPosition(sprite, static_cast<float>(i % 640), static_cast<float>(i / 640));
+        storage.SetRotation(sprite, static_cast<float>(i % 360));
+    }
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < storage.GetSlotCount(); ++i) {
+            if (storage.IsAlive(i)) {
+                storage.Move(storage.GetHandle(i), 1.0f, 0.5f);
+                benchmark::DoNotOptimize(storage.GetTransform(i));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpriteFrame_Storage)->Arg(1000)->Arg(100000);
+
+namespace {
+
+// A 32x32 textured sprite at a varied transform
+void SetUpSprite(SpriteStorage& storage, SpriteHandle sprite, size_t index, const std::shared_ptr<const sf::Texture>& texture) {
+    storage.SetImage(sprite, "image"_h, texture, sf::IntRect(0, 0, 32, 32));
+    storage.SetPosition(sprite, static_cast<float>(index % 640), static_cast<float>(index / 640));
+    storage.SetRotation(sprite, static_cast<float>(index % 360));
+    storage.SetScale(sprite, 2.0f, 2.0f);
+    storage.SetOrigin(sprite, 16.0f, 16.0f);
+}
+
+std::shared_ptr<sf::Texture> MakeTexture() {
+    auto texture = std::make_shared<sf::Texture>();
+    texture->create(32, 32);
+    return texture;
+}
+
+} // namespace
+
+// Move every sprite, then get its bounds from Sprite::GetGlobalBounds
+static void BM_SpriteBounds_PerSprite(benchmark::State& state) {
+    const auto texture = MakeTexture();
+    const Image image;
+    std::vector<std::unique_ptr<Sprite>> sprites;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        auto sprite = std::make_unique<Sprite>();
+        sprite->SetImage(image, texture, sf::IntRect(0, 0, 32, 32));
+        sprite->SetPosition(static_cast<float>(i % 640), static_cast<float>(i / 640));
+        sprite->SetRotation(static_cast<float>(i % 360));
+        sprite->SetScale(2.0f, 2.0f);
+        sprite->SetOrigin(16.0f, 16.0f);
+        sprites.push_back(std::move(sprite));
+    }
+
+    for (auto _ : state) {
+        for (const auto& sprite : sprites) {
+            sprite->Move(1.0f, 0.5f);
+            benchmark::DoNotOptimize(sprite->GetGlobalBounds());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpriteBounds_PerSprite)->Arg(10000)->Arg(100000);
+
+// Move every sprite, then compute all transforms and bounds in one UpdateTransforms pass
+static void BM_SpriteBounds_Bulk(benchmark::State& state) {
+    const auto texture = MakeTexture();
+    SpriteStorage storage;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        SetUpSprite(storage, storage.Create(static_cast<uint32_t>(i + 1)), static_cast<size_t>(i), texture);
+    }
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < storage.GetSlotCount(); ++i) {
+            storage.Move(storage.GetHandle(i), 1.0f, 0.5f);
+        }
+        benchmark::DoNotOptimize(storage.UpdateTransforms());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpriteBounds_Bulk)->Arg(10000)->Arg(100000);
+
+// UpdateTransforms when 1% of the sprites moved since the last frame
+static void BM_SpriteBounds_BulkFewChanged(benchmark::State& state) {
+    const auto texture = MakeTexture();
+    SpriteStorage storage;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        SetUpSprite(storage, storage.Create(static_cast<uint32_t>(i + 1)), static_cast<size_t>(i), texture);
+    }
+    storage.UpdateTransforms();
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < storage.GetSlotCount(); i += 100) {
+            storage.Move(storage.GetHandle(i), 1.0f, 0.5f);
+        }
+        benchmark::DoNotOptimize(storage.UpdateTransforms());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpriteBounds_BulkFewChanged)->Arg(10000)->Arg(100000);
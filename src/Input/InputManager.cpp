@@ -1,6 +1,9 @@
 #include "InputManager.h"
 #include "core/DataManager.h"
+#include "core/BakedData.h"
+#include "core/LiteralTable.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <iostream>
 
 namespace ShoeEngine {
@@ -8,6 +11,125 @@ namespace ShoeEngine {
 
 		using namespace Core;
 
+		namespace {
+
+			// Key names used by "key" in input data
+			constexpr auto KEYBOARD_KEYS = Core::MakeLiteralTable<sf::Keyboard::Key>({
+				{ "A", sf::Keyboard::A },
+				{ "B", sf::Keyboard::B },
+				{ "C", sf::Keyboard::C },
+				{ "D", sf::Keyboard::D },
+				{ "E", sf::Keyboard::E },
+				{ "F", sf::Keyboard::F },
+				{ "G", sf::Keyboard::G },
+				{ "H", sf::Keyboard::H },
+				{ "I", sf::Keyboard::I },
+				{ "J", sf::Keyboard::J },
+				{ "K", sf::Keyboard::K },
+				{ "L", sf::Keyboard::L },
+				{ "M", sf::Keyboard::M },
+				{ "N", sf::Keyboard::N },
+				{ "O", sf::Keyboard::O },
+				{ "P", sf::Keyboard::P },
+				{ "Q", sf::Keyboard::Q },
+				{ "R", sf::Keyboard::R },
+				{ "S", sf::Keyboard::S },
+				{ "T", sf::Keyboard::T },
+				{ "U", sf::Keyboard::U },
+				{ "V", sf::Keyboard::V },
+				{ "W", sf::Keyboard::W },
+				{ "X", sf::Keyboard::X },
+				{ "Y", sf::Keyboard::Y },
+				{ "Z", sf::Keyboard::Z },
+
+				{ "Num0", sf::Keyboard::Num0 },
+				{ "Num1", sf::Keyboard::Num1 },
+				{ "Num2", sf::Keyboard::Num2 },
+				{ "Num3", sf::Keyboard::Num3 },
+				{ "Num4", sf::Keyboard::Num4 },
+				{ "Num5", sf::Keyboard::Num5 },
+				{ "Num6", sf::Keyboard::Num6 },
+				{ "Num7", sf::Keyboard::Num7 },
+				{ "Num8", sf::Keyboard::Num8 },
+				{ "Num9", sf::Keyboard::Num9 },
+
+				{ "Escape", sf::Keyboard::Escape },
+				{ "LControl", sf::Keyboard::LControl },
+				{ "LShift", sf::Keyboard::LShift },
+				{ "LAlt", sf::Keyboard::LAlt },
+				{ "LSystem", sf::Keyboard::LSystem },
+				{ "RControl", sf::Keyboard::RControl },
+				{ "RShift", sf::Keyboard::RShift },
+				{ "RAlt", sf::Keyboard::RAlt },
+				{ "RSystem", sf::Keyboard::RSystem },
+				{ "Menu", sf::Keyboard::Menu },
+
+				{ "LBracket", sf::Keyboard::LBracket },
+				{ "RBracket", sf::Keyboard::RBracket },
+				{ "Semicolon", sf::Keyboard::Semicolon },
+				{ "Comma", sf::Keyboard::Comma },
+				{ "Period", sf::Keyboard::Period },
+				{ "Quote", sf::Keyboard::Quote },
+				{ "Slash", sf::Keyboard::Slash },
+				{ "Backslash", sf::Keyboard::Backslash },
+				{ "Tilde", sf::Keyboard::Tilde },
+				{ "Equal", sf::Keyboard::Equal },
+				{ "Hyphen", sf::Keyboard::Hyphen },
+				{ "Space", sf::Keyboard::Space },
+				{ "Enter", sf::Keyboard::Enter },
+				{ "Backspace", sf::Keyboard::Backspace },
+				{ "Tab", sf::Keyboard::Tab },
+
+				{ "PageUp", sf::Keyboard::PageUp },
+				{ "PageDown", sf::Keyboard::PageDown },
+				{ "End", sf::Keyboard::End },
+				{ "Home", sf::Keyboard::Home },
+				{ "Insert", sf::Keyboard::Insert },
+				{ "Delete", sf::Keyboard::Delete },
+
+				{ "Add", sf::Keyboard::Add },
+				{ "Subtract", sf::Keyboard::Subtract },
+				{ "Multiply", sf::Keyboard::Multiply },
+				{ "Divide", sf::Keyboard::Divide },
+
+				{ "Left", sf::Keyboard::Left },
+				{ "Right", sf::Keyboard::Right },
+				{ "Up", sf::Keyboard::Up },
+				{ "Down", sf::Keyboard::Down },
+
+				{ "Numpad0", sf::Keyboard::Numpad0 },
+				{ "Numpad1", sf::Keyboard::Numpad1 },
+				{ "Numpad2", sf::Keyboard::Numpad2 },
+				{ "Numpad3", sf::Keyboard::Numpad3 },
+				{ "Numpad4", sf::Keyboard::Numpad4 },
+				{ "Numpad5", sf::Keyboard::Numpad5 },
+				{ "Numpad6", sf::Keyboard::Numpad6 },
+				{ "Numpad7", sf::Keyboard::Numpad7 },
+				{ "Numpad8", sf::Keyboard::Numpad8 },
+				{ "Numpad9", sf::Keyboard::Numpad9 },
+
+				{ "F1", sf::Keyboard::F1 },
+				{ "F2", sf::Keyboard::F2 },
+				{ "F3", sf::Keyboard::F3 },
+				{ "F4", sf::Keyboard::F4 },
+				{ "F5", sf::Keyboard::F5 },
+				{ "F6", sf::Keyboard::F6 },
+				{ "F7", sf::Keyboard::F7 },
+				{ "F8", sf::Keyboard::F8 },
+				{ "F9", sf::Keyboard::F9 },
+				{ "F10", sf::Keyboard::F10 },
+				{ "F11", sf::Keyboard::F11 },
+				{ "F12", sf::Keyboard::F12 },
+				{ "F13", sf::Keyboard::F13 },
+				{ "F14", sf::Keyboard::F14 },
+				{ "F15", sf::Keyboard::F15 },
+
+				{ "Pause", sf::Keyboard::Pause },
+			});
+			static_assert(KEYBOARD_KEYS.IsValid(), "Keyboard key names must have distinct hashes");
+
+		} // namespace
+
 		InputManager::InputManager(Core::DataManager& dataManager)
 			: BaseManager(dataManager)
 		{
@@ -32,7 +154,7 @@ namespace ShoeEngine {
 						if (!input) continue;
 
 						// Register input name
-						const Hash::HashValue inputNameHash = m_dataManager.RegisterString(inputData.at("name"));
+						const Hash::HashValue inputNameHash = m_dataManager.RegisterString(inputData.at("name").get<std::string>());
 
 						context->inputs[inputNameHash] = std::move(input);
 					}
@@ -45,56 +167,185 @@ namespace ShoeEngine {
 			}
 		}
 
+		bool InputManager::CreateFromBaked(const Core::BakedSection& section) {
+			const BakedInput* records = section.GetRecords<BakedInput>();
+			if (!records && section.GetRecordCount() > 0) {
+				return false;
+			}
+
+			for (size_t i = 0; i < section.GetRecordCount(); ++i) {
+				const BakedInput& record = records[i];
+				InputContext* context = GetOrCreateContext(std::string(section.GetString(record.context)));
+
+				auto input = CreateInput(record);
+				if (!input) continue;
+
+				context->inputs[Hash::HashValue(record.name)] = std::move(input);
+			}
+			return true;
+		}
+
+		bool InputManager::BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const {
+			try {
+				for (const auto& [contextName, inputArray] : jsonData.items()) {
+					const Hash::HashValue contextHash = writer.AddString(contextName);
+
+					for (const auto& inputData : inputArray) {
+						BakedInput record{};
+						record.context = contextHash;
+						record.name = writer.AddString(inputData.at("name"));
+						const std::string typeStr = inputData.at("type");
+						record.type = writer.AddString(typeStr);
+
+						if (typeStr == "keyboard") {
+							record.value = static_cast<int32_t>(static_cast<uint32_t>(writer.AddString(inputData.at("key"))));
+						}
+						else if (typeStr == "mouseButton") {
+							record.value = inputData.at("button").get<int32_t>();
+						}
+						else if (typeStr == "mouseAxis") {
+							record.value = inputData.at("axis") == "x" ? 1 : 0;
+						}
+						writer.AddRecord(record);
+					}
+				}
+				return true;
+			}
+			catch (const nlohmann::json::exception& e) {
+				std::cerr << "InputManager JSON error: " << e.what() << "\n";
+				return false;
+			}
+		}
+
 		Hash::HashValue InputManager::GetManagedType() const {
 			return "inputs"_h;
 		}
 
+		namespace {
+
+			// What InputManager saves of one input binding
+			struct InputRecord {
+				Hash::HashValue name;
+				Input::Type type;
+				int32_t value; ///< Key, mouse button, or 1 for the x axis and 0 for the y axis
+			};
+
+			struct ContextRecord {
+				std::string name;
+				std::vector<InputRecord> inputs;
+			};
+
+			// Copy of the input contexts, written by the autosave worker
+			class InputSnapshot : public ManagerSnapshot {
+			public:
+				InputSnapshot(std::vector<ContextRecord> contexts, const DataManager& dataManager)
+					: m_contexts(std::move(contexts))
+					, m_dataManager(dataManager)
+				{
+				}
+
+				void WriteJson(JsonWriter& writer) const override {
+					writer.StartObject();
+
+					for (const ContextRecord& context : m_contexts) {
+						writer.Key(context.name);
+						writer.StartArray();
+
+						for (const InputRecord& input : context.inputs) {
+							writer.StartObject();
+
+							// Add type-specific data
+							switch (input.type) {
+							case Input::Type::Keyboard: {
+								const auto* key = KEYBOARD_KEYS.FindValue(static_cast<sf::Keyboard::Key>(input.value));
+								writer.Key("key");
+								writer.String(key ? key->name : "Unknown");
+								break;
+							}
+							case Input::Type::MouseButton:
+								writer.Key("button");
+								writer.Integer(input.value);
+								break;
+							case Input::Type::MouseAxis:
+								writer.Key("axis");
+								writer.String(input.value ? "x" : "y");
+								break;
+							}
+
+							writer.Key("name");
+							writer.String(m_dataManager.GetString(input.name));
+							writer.Key("type");
+							writer.String([&]() {
+								switch (input.type) {
+								case Input::Type::Keyboard: return "keyboard";
+								case Input::Type::MouseButton: return "mouseButton";
+								case Input::Type::MouseAxis: return "mouseAxis";
+								default: return "unknown";
+								}
+								}());
+
+							writer.EndObject();
+						}
+
+						writer.EndArray();
+					}
+
+					writer.EndObject();
+				}
+
+			private:
+				std::vector<ContextRecord> m_contexts;
+				const DataManager& m_dataManager;
+			};
+
+		} // namespace
+
 		nlohmann::json InputManager::SerializeToJson() {
-			nlohmann::json output;
+			return JsonWriter::ToJson([this](JsonWriter& writer) { WriteJson(writer); });
+		}
 
-			for (const auto& [contextHash, context] : m_contexts) {
-				nlohmann::json contextJson = nlohmann::json::array();
+		void InputManager::WriteJson(JsonWriter& writer) {
+			CreateSnapshot()->WriteJson(writer);
+		}
 
+		std::unique_ptr<ManagerSnapshot> InputManager::CreateSnapshot() {
+			std::vector<ContextRecord> contexts;
+			contexts.reserve(m_contexts.size());
+			for (const auto& [contextHash, context] : m_contexts) {
+				ContextRecord record{ context.name, {} };
+				record.inputs.reserve(context.inputs.size());
 				for (const auto& [inputHash, input] : context.inputs) {
-					nlohmann::json inputJson;
-					inputJson["name"] = m_dataManager.GetString(inputHash);
-					inputJson["type"] = [&]() {
-						switch (input->GetType()) {
-						case Input::Type::Keyboard: return "keyboard";
-						case Input::Type::MouseButton: return "mouseButton";
-						case Input::Type::MouseAxis: return "mouseAxis";
-						default: return "unknown";
-						}
-						}();
-
-					// Add type-specific data
+					int32_t value = 0;
 					switch (input->GetType()) {
-					case Input::Type::Keyboard: {
-						auto kbInput = static_cast<KeyboardInput*>(input.get());
-						inputJson["key"] = m_dataManager.GetString(
-							KeyToHash(kbInput->GetKey())
-						);
+					case Input::Type::Keyboard:
+						value = static_cast<int32_t>(static_cast<KeyboardInput*>(input.get())->GetKey());
 						break;
-					}
-					case Input::Type::MouseButton: {
-						auto mbInput = static_cast<MouseButtonInput*>(input.get());
-						inputJson["button"] = mbInput->GetButton();
+					case Input::Type::MouseButton:
+						value = static_cast<int32_t>(static_cast<MouseButtonInput*>(input.get())->GetButton());
 						break;
-					}
-					case Input::Type::MouseAxis: {
-						auto maInput = static_cast<MouseAxisInput*>(input.get());
-						inputJson["axis"] = maInput->IsXAxis() ? "x" : "y";
+					case Input::Type::MouseAxis:
+						value = static_cast<MouseAxisInput*>(input.get())->IsXAxis() ? 1 : 0;
 						break;
 					}
-					}
-
-					contextJson.push_back(inputJson);
+					record.inputs.push_back({ inputHash, input->GetType(), value });
 				}
-
-				output[context.name] = contextJson;
+				contexts.push_back(std::move(record));
 			}
+			// Sorted by name like the keys of a dumped tree
+			std::sort(contexts.begin(), contexts.end(),
+				[](const ContextRecord& a, const ContextRecord& b) { return a.name < b.name; });
+			return std::make_unique<InputSnapshot>(std::move(contexts), m_dataManager);
+		}
 
-			return output;
+		void InputManager::Clear() {
+			// Back to the state after construction: only the empty global context, active
+			m_contexts.clear();
+			m_activeContextStack.clear();
+			auto& globalContext = m_contexts["global"_h];
+			globalContext.nameHash = "global"_h;
+			globalContext.name = "global";
+			m_activeContextStack.push_back("global"_h);
+			MarkDirty();
 		}
 
 		void InputManager::PushContext(const std::string& contextName) {
@@ -143,10 +394,9 @@ namespace ShoeEngine {
 				const Hash::HashValue nameHash = m_dataManager.RegisterString(name);
 
 				if (typeStr == "keyboard") {
+					// Key names come from KEYBOARD_KEYS, so they need no registration
 					const std::string keyStr = inputData.at("key");
-					auto keyHash = m_dataManager.RegisterString(keyStr);
-
-					const auto key = HashToKey(keyHash);
+					const auto key = HashToKey(Hash::HashValue(keyStr));
 
 					auto input = std::make_unique<KeyboardInput>(nameHash);
 					input->SetKey(key);
@@ -173,238 +423,36 @@ namespace ShoeEngine {
 			}
 		}
 
-		sf::Keyboard::Key InputManager::HashToKey(Core::Hash::HashValue keyHash) const {
-			switch (keyHash) {
-			case "A"_h: return sf::Keyboard::A;
-			case "B"_h: return sf::Keyboard::B;
-			case "C"_h: return sf::Keyboard::C;
-			case "D"_h: return sf::Keyboard::D;
-			case "E"_h: return sf::Keyboard::E;
-			case "F"_h: return sf::Keyboard::F;
-			case "G"_h: return sf::Keyboard::G;
-			case "H"_h: return sf::Keyboard::H;
-			case "I"_h: return sf::Keyboard::I;
-			case "J"_h: return sf::Keyboard::J;
-			case "K"_h: return sf::Keyboard::K;
-			case "L"_h: return sf::Keyboard::L;
-			case "M"_h: return sf::Keyboard::M;
-			case "N"_h: return sf::Keyboard::N;
-			case "O"_h: return sf::Keyboard::O;
-			case "P"_h: return sf::Keyboard::P;
-			case "Q"_h: return sf::Keyboard::Q;
-			case "R"_h: return sf::Keyboard::R;
-			case "S"_h: return sf::Keyboard::S;
-			case "T"_h: return sf::Keyboard::T;
-			case "U"_h: return sf::Keyboard::U;
-			case "V"_h: return sf::Keyboard::V;
-			case "W"_h: return sf::Keyboard::W;
-			case "X"_h: return sf::Keyboard::X;
-			case "Y"_h: return sf::Keyboard::Y;
-			case "Z"_h: return sf::Keyboard::Z;
-
-			case "Num0"_h: return sf::Keyboard::Num0;
-			case "Num1"_h: return sf::Keyboard::Num1;
-			case "Num2"_h: return sf::Keyboard::Num2;
-			case "Num3"_h: return sf::Keyboard::Num3;
-			case "Num4"_h: return sf::Keyboard::Num4;
-			case "Num5"_h: return sf::Keyboard::Num5;
-			case "Num6"_h: return sf::Keyboard::Num6;
-			case "Num7"_h: return sf::Keyboard::Num7;
-			case "Num8"_h: return sf::Keyboard::Num8;
-			case "Num9"_h: return sf::Keyboard::Num9;
-
-			case "Escape"_h: return sf::Keyboard::Escape;
-			case "LControl"_h: return sf::Keyboard::LControl;
-			case "LShift"_h: return sf::Keyboard::LShift;
-			case "LAlt"_h: return sf::Keyboard::LAlt;
-			case "LSystem"_h: return sf::Keyboard::LSystem;
-			case "RControl"_h: return sf::Keyboard::RControl;
-			case "RShift"_h: return sf::Keyboard::RShift;
-			case "RAlt"_h: return sf::Keyboard::RAlt;
-			case "RSystem"_h: return sf::Keyboard::RSystem;
-			case "Menu"_h: return sf::Keyboard::Menu;
-
-			case "LBracket"_h: return sf::Keyboard::LBracket;
-			case "RBracket"_h: return sf::Keyboard::RBracket;
-			case "Semicolon"_h: return sf::Keyboard::Semicolon;
-			case "Comma"_h: return sf::Keyboard::Comma;
-			case "Period"_h: return sf::Keyboard::Period;
-			case "Quote"_h: return sf::Keyboard::Quote;
-			case "Slash"_h: return sf::Keyboard::Slash;
-			case "Backslash"_h: return sf::Keyboard::Backslash;
-			case "Tilde"_h: return sf::Keyboard::Tilde;
-			case "Equal"_h: return sf::Keyboard::Equal;
-			case "Hyphen"_h: return sf::Keyboard::Hyphen;
-			case "Space"_h: return sf::Keyboard::Space;
-			case "Enter"_h: return sf::Keyboard::Enter;
-			case "Backspace"_h: return sf::Keyboard::Backspace;
-			case "Tab"_h: return sf::Keyboard::Tab;
-
-			case "PageUp"_h: return sf::Keyboard::PageUp;
-			case "PageDown"_h: return sf::Keyboard::PageDown;
-			case "End"_h: return sf::Keyboard::End;
-			case "Home"_h: return sf::Keyboard::Home;
-			case "Insert"_h: return sf::Keyboard::Insert;
-			case "Delete"_h: return sf::Keyboard::Delete;
-
-			case "Add"_h: return sf::Keyboard::Add;
-			case "Subtract"_h: return sf::Keyboard::Subtract;
-			case "Multiply"_h: return sf::Keyboard::Multiply;
-			case "Divide"_h: return sf::Keyboard::Divide;
-
-			case "Left"_h: return sf::Keyboard::Left;
-			case "Right"_h: return sf::Keyboard::Right;
-			case "Up"_h: return sf::Keyboard::Up;
-			case "Down"_h: return sf::Keyboard::Down;
-
-			case "Numpad0"_h: return sf::Keyboard::Numpad0;
-			case "Numpad1"_h: return sf::Keyboard::Numpad1;
-			case "Numpad2"_h: return sf::Keyboard::Numpad2;
-			case "Numpad3"_h: return sf::Keyboard::Numpad3;
-			case "Numpad4"_h: return sf::Keyboard::Numpad4;
-			case "Numpad5"_h: return sf::Keyboard::Numpad5;
-			case "Numpad6"_h: return sf::Keyboard::Numpad6;
-			case "Numpad7"_h: return sf::Keyboard::Numpad7;
-			case "Numpad8"_h: return sf::Keyboard::Numpad8;
-			case "Numpad9"_h: return sf::Keyboard::Numpad9;
-
-			case "F1"_h: return sf::Keyboard::F1;
-			case "F2"_h: return sf::Keyboard::F2;
-			case "F3"_h: return sf::Keyboard::F3;
-			case "F4"_h: return sf::Keyboard::F4;
-			case "F5"_h: return sf::Keyboard::F5;
-			case "F6"_h: return sf::Keyboard::F6;
-			case "F7"_h: return sf::Keyboard::F7;
-			case "F8"_h: return sf::Keyboard::F8;
-			case "F9"_h: return sf::Keyboard::F9;
-			case "F10"_h: return sf::Keyboard::F10;
-			case "F11"_h: return sf::Keyboard::F11;
-			case "F12"_h: return sf::Keyboard::F12;
-			case "F13"_h: return sf::Keyboard::F13;
-			case "F14"_h: return sf::Keyboard::F14;
-			case "F15"_h: return sf::Keyboard::F15;
-
-			case "Pause"_h: return sf::Keyboard::Pause;
-
-			default: return sf::Keyboard::Unknown;
+		std::unique_ptr<Input> InputManager::CreateInput(const BakedInput& record) const {
+			const Hash::HashValue nameHash(record.name);
+
+			switch (Hash::HashValue(record.type)) {
+			case "keyboard"_h: {
+				auto input = std::make_unique<KeyboardInput>(nameHash);
+				input->SetKey(HashToKey(Hash::HashValue(static_cast<uint32_t>(record.value))));
+				return input;
+			}
+			case "mouseButton"_h: {
+				auto input = std::make_unique<MouseButtonInput>(nameHash);
+				input->SetButton(static_cast<sf::Mouse::Button>(record.value));
+				return input;
+			}
+			case "mouseAxis"_h:
+				return std::make_unique<MouseAxisInput>(nameHash, record.value != 0);
+			default:
+				std::cerr << "Unknown baked input type: " << record.type << "\n";
+				return nullptr;
 			}
 		}
 
+		sf::Keyboard::Key InputManager::HashToKey(Core::Hash::HashValue keyHash) const {
+			const sf::Keyboard::Key* key = KEYBOARD_KEYS.Find(keyHash);
+			return key ? *key : sf::Keyboard::Unknown;
+		}
+
 		Core::Hash::HashValue InputManager::KeyToHash(sf::Keyboard::Key key) const {
-			switch (key) {
-			case sf::Keyboard::A:           return "A"_h;
-			case sf::Keyboard::B:           return "B"_h;
-			case sf::Keyboard::C:           return "C"_h;
-			case sf::Keyboard::D:           return "D"_h;
-			case sf::Keyboard::E:           return "E"_h;
-			case sf::Keyboard::F:           return "F"_h;
-			case sf::Keyboard::G:           return "G"_h;
-			case sf::Keyboard::H:           return "H"_h;
-			case sf::Keyboard::I:           return "I"_h;
-			case sf::Keyboard::J:           return "J"_h;
-			case sf::Keyboard::K:           return "K"_h;
-			case sf::Keyboard::L:           return "L"_h;
-			case sf::Keyboard::M:           return "M"_h;
-			case sf::Keyboard::N:           return "N"_h;
-			case sf::Keyboard::O:           return "O"_h;
-			case sf::Keyboard::P:           return "P"_h;
-			case sf::Keyboard::Q:           return "Q"_h;
-			case sf::Keyboard::R:           return "R"_h;
-			case sf::Keyboard::S:           return "S"_h;
-			case sf::Keyboard::T:           return "T"_h;
-			case sf::Keyboard::U:           return "U"_h;
-			case sf::Keyboard::V:           return "V"_h;
-			case sf::Keyboard::W:           return "W"_h;
-			case sf::Keyboard::X:           return "X"_h;
-			case sf::Keyboard::Y:           return "Y"_h;
-			case sf::Keyboard::Z:           return "Z"_h;
-
-			case sf::Keyboard::Num0:        return "Num0"_h;
-			case sf::Keyboard::Num1:        return "Num1"_h;
-			case sf::Keyboard::Num2:        return "Num2"_h;
-			case sf::Keyboard::Num3:        return "Num3"_h;
-			case sf::Keyboard::Num4:        return "Num4"_h;
-			case sf::Keyboard::Num5:        return "Num5"_h;
-			case sf::Keyboard::Num6:        return "Num6"_h;
-			case sf::Keyboard::Num7:        return "Num7"_h;
-			case sf::Keyboard::Num8:        return "Num8"_h;
-			case sf::Keyboard::Num9:        return "Num9"_h;
-
-			case sf::Keyboard::Escape:      return "Escape"_h;
-			case sf::Keyboard::LControl:    return "LControl"_h;
-			case sf::Keyboard::LShift:      return "LShift"_h;
-			case sf::Keyboard::LAlt:        return "LAlt"_h;
-			case sf::Keyboard::LSystem:     return "LSystem"_h;
-			case sf::Keyboard::RControl:    return "RControl"_h;
-			case sf::Keyboard::RShift:      return "RShift"_h;
-			case sf::Keyboard::RAlt:        return "RAlt"_h;
-			case sf::Keyboard::RSystem:     return "RSystem"_h;
-			case sf::Keyboard::Menu:        return "Menu"_h;
-
-			case sf::Keyboard::LBracket:    return "LBracket"_h;
-			case sf::Keyboard::RBracket:    return "RBracket"_h;
-			case sf::Keyboard::Semicolon:   return "Semicolon"_h;
-			case sf::Keyboard::Comma:       return "Comma"_h;
-			case sf::Keyboard::Period:      return "Period"_h;
-			case sf::Keyboard::Quote:       return "Quote"_h;
-			case sf::Keyboard::Slash:       return "Slash"_h;
-			case sf::Keyboard::Backslash:   return "Backslash"_h;
-			case sf::Keyboard::Tilde:       return "Tilde"_h;
-			case sf::Keyboard::Equal:       return "Equal"_h;
-			case sf::Keyboard::Hyphen:      return "Hyphen"_h;
-			case sf::Keyboard::Space:       return "Space"_h;
-			case sf::Keyboard::Enter:       return "Enter"_h;
-			case sf::Keyboard::Backspace:   return "Backspace"_h;
-			case sf::Keyboard::Tab:         return "Tab"_h;
-
-			case sf::Keyboard::PageUp:      return "PageUp"_h;
-			case sf::Keyboard::PageDown:    return "PageDown"_h;
-			case sf::Keyboard::End:         return "End"_h;
-			case sf::Keyboard::Home:        return "Home"_h;
-			case sf::Keyboard::Insert:      return "Insert"_h;
-			case sf::Keyboard::Delete:      return "Delete"_h;
-
-			case sf::Keyboard::Add:         return "Add"_h;
-			case sf::Keyboard::Subtract:    return "Subtract"_h;
-			case sf::Keyboard::Multiply:    return "Multiply"_h;
-			case sf::Keyboard::Divide:      return "Divide"_h;
-
-			case sf::Keyboard::Left:        return "Left"_h;
-			case sf::Keyboard::Right:       return "Right"_h;
-			case sf::Keyboard::Up:          return "Up"_h;
-			case sf::Keyboard::Down:        return "Down"_h;
-
-			case sf::Keyboard::Numpad0:     return "Numpad0"_h;
-			case sf::Keyboard::Numpad1:     return "Numpad1"_h;
-			case sf::Keyboard::Numpad2:     return "Numpad2"_h;
-			case sf::Keyboard::Numpad3:     return "Numpad3"_h;
-			case sf::Keyboard::Numpad4:     return "Numpad4"_h;
-			case sf::Keyboard::Numpad5:     return "Numpad5"_h;
-			case sf::Keyboard::Numpad6:     return "Numpad6"_h;
-			case sf::Keyboard::Numpad7:     return "Numpad7"_h;
-			case sf::Keyboard::Numpad8:     return "Numpad8"_h;
-			case sf::Keyboard::Numpad9:     return "Numpad9"_h;
-
-			case sf::Keyboard::F1:          return "F1"_h;
-			case sf::Keyboard::F2:          return "F2"_h;
-			case sf::Keyboard::F3:          return "F3"_h;
-			case sf::Keyboard::F4:          return "F4"_h;
-			case sf::Keyboard::F5:          return "F5"_h;
-			case sf::Keyboard::F6:          return "F6"_h;
-			case sf::Keyboard::F7:          return "F7"_h;
-			case sf::Keyboard::F8:          return "F8"_h;
-			case sf::Keyboard::F9:          return "F9"_h;
-			case sf::Keyboard::F10:         return "F10"_h;
-			case sf::Keyboard::F11:         return "F11"_h;
-			case sf::Keyboard::F12:         return "F12"_h;
-			case sf::Keyboard::F13:         return "F13"_h;
-			case sf::Keyboard::F14:         return "F14"_h;
-			case sf::Keyboard::F15:         return "F15"_h;
-
-			case sf::Keyboard::Pause:       return "Pause"_h;
-
-			default:                        return "Unknown"_h;
-			}
+			const auto* entry = KEYBOARD_KEYS.FindValue(key);
+			return entry ? entry->hash : "Unknown"_h;
 		}
 
 	} // namespace Input
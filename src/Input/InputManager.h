@@ -3,7 +3,7 @@
 #include "core/BaseManager.h"
 #include "core/Hash.h"
 #include "Input.h"
-#include <unordered_map>
+#include "core/FlatHashMap.h"
 #include <memory>
 #include <vector>
 
@@ -12,6 +12,17 @@ namespace ShoeEngine {
 
 		class InputManager : public Core::BaseManager {
 		public:
+			/**
+			 * @struct BakedInput
+			 * @brief Fixed-layout record of one input binding in a baked data file
+			 */
+			struct BakedInput {
+				uint32_t context; ///< Hash of the context name
+				uint32_t name;    ///< Hash of the input name
+				uint32_t type;    ///< Hash of the input type ("keyboard", "mouseButton" or "mouseAxis")
+				int32_t value;    ///< Key name hash, mouse button, or 1 for the x axis and 0 for the y axis
+			};
+
 			/**
 			 * @brief Constructor
 			 * @param dataManager Reference to the DataManager for string registration
@@ -25,6 +36,21 @@ namespace ShoeEngine {
 			 */
 			bool CreateFromJson(const nlohmann::json& jsonData) override;
 
+			/**
+			 * @brief Creates input bindings from a baked "inputs" section
+			 * @param section Section of BakedInput records
+			 * @return bool True if inputs were created successfully
+			 */
+			bool CreateFromBaked(const Core::BakedSection& section) override;
+
+			/**
+			 * @brief Bakes an "inputs" JSON section into BakedInput records
+			 * @param jsonData JSON data containing input contexts and bindings
+			 * @param writer Receives the records
+			 * @return bool True if the section was valid
+			 */
+			bool BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const override;
+
 			/**
 			 * @brief Get the type of objects this manager handles
 			 * @return Core::Hash::HashValue Returns hash of "input_contexts"
@@ -37,6 +63,23 @@ namespace ShoeEngine {
 			 */
 			nlohmann::json SerializeToJson() override;
 
+			/**
+			 * @brief Write all input contexts straight into a JSON writer
+			 * @param writer Receives an object of input arrays keyed by context name
+			 */
+			void WriteJson(Core::JsonWriter& writer) override;
+
+			/**
+			 * @brief Copies the contexts and their bindings
+			 * @return Snapshot writing the same JSON as WriteJson
+			 */
+			std::unique_ptr<Core::ManagerSnapshot> CreateSnapshot() override;
+
+			/**
+			 * @brief Remove all input contexts except an empty global context, which becomes the only active one
+			 */
+			void Clear() override;
+
 			/**
 			 * @brief Push a new context onto the active context stack
 			 * @param contextName Name of the context to activate
@@ -57,16 +100,17 @@ namespace ShoeEngine {
 
 		private:
 			struct InputContext {
-				std::unordered_map<Core::Hash::HashValue, std::unique_ptr<Input>> inputs;
+				Core::FlatHashMap<Core::Hash::HashValue, std::unique_ptr<Input>> inputs;
 				Core::Hash::HashValue nameHash;
 				std::string name;
 			};
 
-			std::unordered_map<Core::Hash::HashValue, InputContext> m_contexts;
+			Core::FlatHashMap<Core::Hash::HashValue, InputContext> m_contexts;
 			std::vector<Core::Hash::HashValue> m_activeContextStack;
 
 			InputContext* GetOrCreateContext(const std::string& contextName);
 			std::unique_ptr<Input> CreateInput(const nlohmann::json& inputData);
+			std::unique_ptr<Input> CreateInput(const BakedInput& record) const;
 			sf::Keyboard::Key HashToKey(Core::Hash::HashValue keyHash) const;
 			Core::Hash::HashValue KeyToHash(sf::Keyboard::Key key) const;
 		};
@@ -36,6 +36,7 @@ void BayouState::ResetState()
         //     p.m_boardIndex = 0;
         // }
     }
+    MarkChanged();
 }
 
 // -------------------------------------------------------------------------
@@ -111,6 +112,7 @@ bool BayouState::PlaceNewPiece(int row, int col, int playerId, ShoeEngine::Core:
     m_board[idx] = EncodeOccupied(playerId, pieceArrayIndex);
 
     count++;
+    MarkChanged();
     return true;
 }
 
@@ -154,6 +156,7 @@ bool BayouState::RemovePiece(int row, int col)
 
     // Clear the square
     m_board[idx] = 0;
+    MarkChanged();
     return true;
 }
 
@@ -70,6 +70,20 @@ public:
     // ---------------------------------------------------------------------
     bool PlaceNewPiece(int row, int col, int playerId, ShoeEngine::Core::Hash::HashValue pieceType);
     bool RemovePiece(int row, int col);
+
+    // ---------------------------------------------------------------------
+    // Change Tracking
+    // ---------------------------------------------------------------------
+    /**
+     * @brief Counter bumped by every change made through the methods above.
+     *
+     * Code writing m_board or the piece arrays directly must call MarkChanged().
+     */
+    uint64_t GetGeneration() const { return m_generation; }
+    void MarkChanged() { ++m_generation; }
+
+private:
+    uint64_t m_generation = 0;
 };
 
 } // namespace Bayou
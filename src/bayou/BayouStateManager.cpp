@@ -1,11 +1,235 @@
 #include "BayouStateManager.h"
 #include "core/Hash.h"
 #include "core/DataManager.h"
+#include "core/BakedData.h"
 #include <stdexcept>
+#include <vector>
 
 namespace ShoeEngine {
 	namespace Bayou {
 
+		namespace {
+
+			// Builds a BayouState from the events of a "bayou_state" section. Accepts the same
+			// layout as BayouStateManager::CreateFromJson and only replaces the state once the
+			// whole section turned out to be valid.
+			class BayouStateStreamHandler : public ShoeEngine::Core::JsonStreamHandler {
+			public:
+				BayouStateStreamHandler(BayouState& state, ShoeEngine::Core::DataManager& dataManager)
+					: m_state(state)
+					, m_dataManager(dataManager)
+				{
+				}
+
+				bool Null() override { return Top() != Scope::Board; }
+				bool Boolean(bool) override { return Top() != Scope::Board; }
+				bool Integer(int64_t value) override { return Number(static_cast<double>(value)); }
+				bool Unsigned(uint64_t value) override { return Number(static_cast<double>(value)); }
+				bool Float(double value) override { return Number(value); }
+
+				bool String(const std::string& value) override {
+					if (Top() == Scope::Piece && m_key == "type") {
+						m_pieceType = value;
+						m_hasPieceType = true;
+					}
+					else if (Top() == Scope::Board) {
+						return false;
+					}
+					return true;
+				}
+
+				bool Key(const std::string& key) override {
+					m_key = key;
+					return true;
+				}
+
+				bool StartObject() override {
+					if (m_scopes.empty()) {
+						m_scopes.push_back(Scope::Section);
+					}
+					else if (Top() == Scope::Section && m_key == "pieces") {
+						m_hasPieces = true;
+						m_scopes.push_back(Scope::Pieces);
+					}
+					else if (Top() == Scope::PlayerPieces) {
+						m_hasPieceType = false;
+						m_hasBoardIndex = false;
+						m_scopes.push_back(Scope::Piece);
+					}
+					else if (Top() == Scope::Board) {
+						return false;
+					}
+					else {
+						m_scopes.push_back(Scope::Ignored);
+					}
+					return true;
+				}
+
+				bool EndObject() override {
+					const Scope scope = Pop();
+					if (scope == Scope::Piece && m_hasPieceType && m_hasBoardIndex) {
+						int& count = m_numPieces[m_player];
+						if (count == 64) {
+							return false;
+						}
+						m_pieces[m_player][count].m_type = m_dataManager.RegisterString(m_pieceType);
+						m_pieces[m_player][count].m_boardIndex = m_pieceBoardIndex;
+						++count;
+					}
+					return true;
+				}
+
+				bool StartArray() override {
+					if (m_scopes.empty()) {
+						m_scopes.push_back(Scope::Ignored);
+					}
+					else if (Top() == Scope::Section && m_key == "board") {
+						m_boardSize = 0;
+						m_hasBoard = true;
+						m_scopes.push_back(Scope::Board);
+					}
+					else if (Top() == Scope::Pieces && (m_key == "player1" || m_key == "player2")) {
+						m_player = m_key == "player1" ? 0 : 1;
+						m_numPieces[m_player] = 0;
+						m_scopes.push_back(Scope::PlayerPieces);
+					}
+					else if (Top() == Scope::Board) {
+						return false;
+					}
+					else {
+						m_scopes.push_back(Scope::Ignored);
+					}
+					return true;
+				}
+
+				bool EndArray() override {
+					Pop();
+					return true;
+				}
+
+				bool Finish() override {
+					if (!m_hasBoard || m_boardSize != BayouState::kBoardNumSquares || !m_hasPieces) {
+						return false;
+					}
+
+					m_state.ResetState();
+					m_state.m_board = m_board;
+					for (int player = 0; player < 2; ++player) {
+						m_state.m_playerPieces[player] = m_pieces[player];
+						m_state.m_numPieces[player] = m_numPieces[player];
+					}
+					return true;
+				}
+
+			private:
+				enum class Scope {
+					Section,      // The "bayou_state" object
+					Board,        // The "board" array
+					Pieces,       // The "pieces" object
+					PlayerPieces, // A "player1" or "player2" array
+					Piece,        // One piece object
+					Ignored       // Anything else
+				};
+
+				Scope Top() const {
+					return m_scopes.empty() ? Scope::Ignored : m_scopes.back();
+				}
+
+				Scope Pop() {
+					const Scope scope = Top();
+					if (!m_scopes.empty()) {
+						m_scopes.pop_back();
+					}
+					return scope;
+				}
+
+				bool Number(double value) {
+					if (Top() == Scope::Board) {
+						if (m_boardSize == BayouState::kBoardNumSquares) {
+							return false;
+						}
+						m_board[m_boardSize++] = static_cast<uint8_t>(value);
+					}
+					else if (Top() == Scope::Piece && m_key == "boardIndex") {
+						m_pieceBoardIndex = static_cast<uint8_t>(value);
+						m_hasBoardIndex = true;
+					}
+					return true;
+				}
+
+				BayouState& m_state;
+				ShoeEngine::Core::DataManager& m_dataManager;
+				std::vector<Scope> m_scopes;
+				std::string m_key;
+
+				std::array<uint8_t, BayouState::kBoardNumSquares> m_board{};
+				int m_boardSize = 0;
+				bool m_hasBoard = false;
+				bool m_hasPieces = false;
+
+				std::array<Piece, 64> m_pieces[2];
+				int m_numPieces[2] = { 0, 0 };
+				int m_player = 0;
+				std::string m_pieceType;
+				uint8_t m_pieceBoardIndex = 0;
+				bool m_hasPieceType = false;
+				bool m_hasBoardIndex = false;
+			};
+
+			// Writes a state; type names are looked up in the thread-safe string registry.
+			void WriteState(ShoeEngine::Core::JsonWriter& writer, const BayouState& state, const ShoeEngine::Core::DataManager& dataManager) {
+				writer.StartObject();
+
+				// Write board.
+				writer.Key("board");
+				writer.StartArray();
+				for (const auto& cell : state.m_board) {
+					writer.Unsigned(cell);
+				}
+				writer.EndArray();
+
+				// Write pieces of both players.
+				writer.Key("pieces");
+				writer.StartObject();
+				for (int player = 0; player < 2; ++player) {
+					writer.Key(player == 0 ? "player1" : "player2");
+					writer.StartArray();
+					for (int i = 0; i < state.m_numPieces[player]; ++i) {
+						const Piece& piece = state.m_playerPieces[player][i];
+						writer.StartObject();
+						writer.Key("boardIndex");
+						writer.Unsigned(piece.m_boardIndex);
+						writer.Key("type");
+						writer.String(dataManager.GetString(piece.m_type));
+						writer.EndObject();
+					}
+					writer.EndArray();
+				}
+				writer.EndObject();
+
+				writer.EndObject();
+			}
+
+			// Copy of the board and pieces, serialized by the autosave worker.
+			class BayouStateSnapshot : public ShoeEngine::Core::ManagerSnapshot {
+			public:
+				BayouStateSnapshot(const BayouState& state, const ShoeEngine::Core::DataManager& dataManager)
+					: m_state(state)
+					, m_dataManager(dataManager)
+				{
+				}
+
+				void WriteJson(ShoeEngine::Core::JsonWriter& writer) const override {
+					WriteState(writer, m_state, m_dataManager);
+				}
+
+			private:
+				BayouState m_state;
+				const ShoeEngine::Core::DataManager& m_dataManager;
+			};
+
+		} // namespace
+
 		BayouStateManager::BayouStateManager(ShoeEngine::Core::DataManager& dataManager)
 			: ShoeEngine::Core::BaseManager(dataManager)
 		{
@@ -17,6 +241,10 @@ namespace ShoeEngine {
 			return "bayou_state"_h;
 		}
 
+		void BayouStateManager::Clear() {
+			m_state.ResetState();
+		}
+
 		bool BayouStateManager::CreateFromJson(const nlohmann::json& jsonData) {
 			try {
 				// Expect JSON to have a "board" key (an array of 64 uint8_t values)
@@ -90,41 +318,89 @@ namespace ShoeEngine {
 			}
 		}
 
-		nlohmann::json BayouStateManager::SerializeToJson() {
-			nlohmann::json jsonData;
+		std::unique_ptr<ShoeEngine::Core::JsonStreamHandler> BayouStateManager::CreateFromStream() {
+			return std::make_unique<BayouStateStreamHandler>(m_state, m_dataManager);
+		}
 
-			// Serialize board.
-			jsonData["board"] = nlohmann::json::array();
-			for (const auto& cell : m_state.m_board) {
-				jsonData["board"].push_back(cell);
+		bool BayouStateManager::CreateFromBaked(const ShoeEngine::Core::BakedSection& section) {
+			const BakedBayouState* record = section.GetRecords<BakedBayouState>();
+			if (!record || section.GetRecordCount() != 1
+				|| record->numPieces[0] > 64 || record->numPieces[1] > 64) {
+				return false;
 			}
 
-			// Serialize pieces.
-			nlohmann::json piecesJson;
-
-			// Serialize player 1 pieces.
-			piecesJson["player1"] = nlohmann::json::array();
-			for (int i = 0; i < m_state.m_numPieces[0]; ++i) {
-				nlohmann::json pieceJson;
-				std::string typeStr = m_dataManager.GetString(m_state.m_playerPieces[0][i].m_type);
-				pieceJson["type"] = typeStr;
-				pieceJson["boardIndex"] = m_state.m_playerPieces[0][i].m_boardIndex;
-				piecesJson["player1"].push_back(pieceJson);
+			m_state.ResetState();
+			for (int i = 0; i < BayouState::kBoardNumSquares; ++i) {
+				m_state.m_board[i] = record->board[i];
 			}
+			for (int player = 0; player < 2; ++player) {
+				for (uint32_t i = 0; i < record->numPieces[player]; ++i) {
+					m_state.m_playerPieces[player][i].m_type = ShoeEngine::Core::Hash::HashValue(record->pieces[player][i].type);
+					m_state.m_playerPieces[player][i].m_boardIndex = static_cast<uint8_t>(record->pieces[player][i].boardIndex);
+				}
+				m_state.m_numPieces[player] = static_cast<int>(record->numPieces[player]);
+			}
+			return true;
+		}
 
-			// Serialize player 2 pieces.
-			piecesJson["player2"] = nlohmann::json::array();
-			for (int i = 0; i < m_state.m_numPieces[1]; ++i) {
-				nlohmann::json pieceJson;
-				std::string typeStr = m_dataManager.GetString(m_state.m_playerPieces[1][i].m_type);
-				pieceJson["type"] = typeStr;
-				pieceJson["boardIndex"] = m_state.m_playerPieces[1][i].m_boardIndex;
-				piecesJson["player2"].push_back(pieceJson);
+		bool BayouStateManager::BakeJson(const nlohmann::json& jsonData, ShoeEngine::Core::BakedSectionWriter& writer) const {
+			try {
+				if (!jsonData.is_object() || !jsonData.contains("board") || !jsonData["board"].is_array()
+					|| !jsonData.contains("pieces") || !jsonData["pieces"].is_object()) {
+					return false;
+				}
+
+				BakedBayouState record{};
+				const auto& boardArray = jsonData["board"];
+				if (boardArray.size() != BayouState::kBoardNumSquares) {
+					return false;
+				}
+				for (size_t i = 0; i < boardArray.size(); ++i) {
+					record.board[i] = boardArray[i].get<uint8_t>();
+				}
+
+				const char* playerKeys[2] = { "player1", "player2" };
+				const auto& piecesObj = jsonData["pieces"];
+				for (int player = 0; player < 2; ++player) {
+					if (!piecesObj.contains(playerKeys[player]) || !piecesObj[playerKeys[player]].is_array())
+						continue;
+					uint32_t count = 0;
+					for (const auto& pieceJson : piecesObj[playerKeys[player]]) {
+						if (!pieceJson.contains("type") || !pieceJson.contains("boardIndex"))
+							continue;
+						if (count == 64) {
+							return false;
+						}
+						record.pieces[player][count].type = writer.AddString(pieceJson["type"].get<std::string>());
+						record.pieces[player][count].boardIndex = pieceJson["boardIndex"].get<uint8_t>();
+						++count;
+					}
+					record.numPieces[player] = count;
+				}
+
+				writer.AddRecord(record);
+				return true;
+			}
+			catch (const std::exception&) {
+				return false;
 			}
+		}
 
-			jsonData["pieces"] = piecesJson;
+		nlohmann::json BayouStateManager::SerializeToJson() {
+			return ShoeEngine::Core::JsonWriter::ToJson([this](ShoeEngine::Core::JsonWriter& writer) { WriteJson(writer); });
+		}
+
+		void BayouStateManager::WriteJson(ShoeEngine::Core::JsonWriter& writer) {
+			WriteState(writer, m_state, m_dataManager);
+		}
+
+		std::unique_ptr<ShoeEngine::Core::ManagerSnapshot> BayouStateManager::CreateSnapshot() {
+			return std::make_unique<BayouStateSnapshot>(m_state, m_dataManager);
+		}
 
-			return jsonData;
+		uint64_t BayouStateManager::GetGeneration() const {
+			// Both counters only grow, so their sum changes whenever either does
+			return m_generation + m_state.GetGeneration();
 		}
 
 		BayouState& BayouStateManager::GetState() {
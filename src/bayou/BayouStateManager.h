@@ -10,18 +10,53 @@ namespace ShoeEngine {
 
 		class BayouStateManager : public ShoeEngine::Core::BaseManager {
 		public:
+			// Fixed-layout record of one piece in a baked data file.
+			struct BakedPiece {
+				uint32_t type;       // Hash of the piece type
+				uint32_t boardIndex; // Board cell the piece occupies
+			};
+
+			// Fixed-layout record of the whole state in a baked data file.
+			struct BakedBayouState {
+				uint8_t board[BayouState::kBoardNumSquares];
+				uint32_t numPieces[2];
+				BakedPiece pieces[2][64];
+			};
+
 			explicit BayouStateManager(ShoeEngine::Core::DataManager& dataManager);
 			virtual ~BayouStateManager() = default;
 
 			// Create the game state from JSON data.
 			bool CreateFromJson(const nlohmann::json& jsonData) override;
 
+			// Parse the game state directly from the events of a streamed "bayou_state" section.
+			std::unique_ptr<ShoeEngine::Core::JsonStreamHandler> CreateFromStream() override;
+
+			// Create the game state from a baked section holding one BakedBayouState.
+			bool CreateFromBaked(const ShoeEngine::Core::BakedSection& section) override;
+
+			// Bake the JSON game state into a single BakedBayouState record.
+			bool BakeJson(const nlohmann::json& jsonData, ShoeEngine::Core::BakedSectionWriter& writer) const override;
+
 			// Return the type identifier for this manager.
 			ShoeEngine::Core::Hash::HashValue GetManagedType() const override;
 
+			// Reset the board and remove all pieces.
+			void Clear() override;
+
 			// Serialize the BayouState to JSON.
 			nlohmann::json SerializeToJson() override;
 
+			// Write the BayouState straight into a JSON writer.
+			void WriteJson(ShoeEngine::Core::JsonWriter& writer) override;
+
+			// Copy the board and pieces for the autosave worker to serialize.
+			std::unique_ptr<ShoeEngine::Core::ManagerSnapshot> CreateSnapshot() override;
+
+			// The state's changes count towards the generation, so unchanged boards are not re-saved.
+			bool TracksChanges() const override { return true; }
+			uint64_t GetGeneration() const override;
+
 			// Access the internal BayouState.
 			BayouState& GetState();
 
@@ -2,81 +2,138 @@
 #include "graphics/ImageManager.h"
 #include "graphics/Sprite.h"
 #include "core/Hash.h"
+#include "core/LiteralTable.h"
 #include <SFML/Window/Mouse.hpp>
 #include <iostream>
 
 namespace ShoeEngine {
 	namespace Bayou {
 
+		namespace {
+
+			// Piece types with their own image; all others use "player_image"
+			constexpr auto PIECE_IMAGES = ShoeEngine::Core::MakeLiteralTable<ShoeEngine::Core::Hash::HashValue>({
+				{ "alligator", "alligator"_h },
+				{ "crocodile", "crocodile"_h },
+			});
+			static_assert(PIECE_IMAGES.IsValid(), "Piece type names must have distinct hashes");
+
+		} // namespace
+
 		BayouStateVisualizer::BayouStateVisualizer(BayouState& state, ShoeEngine::Graphics::ImageManager& imageManager,
 			int tileSize, int gridCount)
 			: m_state(state),
 			m_imageManager(imageManager),
 			m_tileSize(tileSize),
 			m_gridCount(gridCount),
-			m_boardRenderer(tileSize)
+			m_boardRenderer(tileSize, gridCount)
 		{
-			for (auto& spritePtr : m_pieceSprites) {
-				spritePtr = nullptr;
+			// Every cell owns one pooled sprite whose position never changes.
+			for (int i = 0; i < BayouState::kBoardNumSquares; ++i) {
+				int row = i / m_gridCount;
+				int col = i % m_gridCount;
+				m_pieceSprites[i].SetPosition(static_cast<float>(col * m_tileSize), static_cast<float>(row * m_tileSize));
 			}
 		}
 
-		std::string BayouStateVisualizer::GetImageIdForPiece(ShoeEngine::Core::Hash::HashValue type) const {
-			if (type == "alligator"_h) {
-				return "alligator";
+		ShoeEngine::Core::Hash::HashValue BayouStateVisualizer::GetImageIdForPiece(ShoeEngine::Core::Hash::HashValue type) const {
+			const auto* imageId = PIECE_IMAGES.Find(type);
+			return imageId ? *imageId : "player_image"_h;
+		}
+
+		ShoeEngine::Core::Hash::HashValue BayouStateVisualizer::GetCellType(uint8_t cell) const {
+			if (!BayouState::IsOccupied(cell)) {
+				return ShoeEngine::Core::Hash::HashValue();
 			}
-			else if (type == "crocodile"_h) {
-				return "crocodile";
+			int playerId = BayouState::GetPlayerId(cell);
+			int pieceIndex = BayouState::GetPieceIndex(cell);
+			return m_state.m_playerPieces[playerId][pieceIndex].m_type;
+		}
+
+		const BayouStateVisualizer::PieceVisual* BayouStateVisualizer::GetPieceVisual(ShoeEngine::Core::Hash::HashValue imageId) {
+			auto it = m_pieceVisuals.find(imageId);
+			if (it != m_pieceVisuals.end()) {
+				return &it->second;
+			}
+
+			++m_lastUpdateStats.imageLookups;
+			auto image = m_imageManager.GetImage(imageId);
+			if (!image || image->GetWidth() == 0 || image->GetHeight() == 0) {
+				return nullptr;
 			}
-			return "player_image";
+
+			PieceVisual visual;
+			visual.image = image;
+			auto region = m_imageManager.AcquireTexture(*image);
+			visual.texture = std::move(region.texture);
+			visual.rect = region.rect;
+			visual.scale = sf::Vector2f(m_tileSize / static_cast<float>(image->GetWidth()),
+				m_tileSize / static_cast<float>(image->GetHeight()));
+			return &m_pieceVisuals.emplace(imageId, std::move(visual)).first->second;
 		}
 
 		void BayouStateVisualizer::Update() {
+			m_lastUpdateStats = UpdateStats{};
+
 			for (int i = 0; i < BayouState::kBoardNumSquares; ++i) {
 				uint8_t cell = m_state.m_board[i];
-				int row = i / m_gridCount;
-				int col = i % m_gridCount;
-				sf::Vector2f position(static_cast<float>(col * m_tileSize), static_cast<float>(row * m_tileSize));
-
-				if (BayouState::IsOccupied(cell)) {
-					int playerId = BayouState::GetPlayerId(cell);
-					int pieceIndex = BayouState::GetPieceIndex(cell);
-					if (pieceIndex < 0 || pieceIndex >= 64) {
-						continue;
-					}
-					const auto& piece = m_state.m_playerPieces[playerId][pieceIndex];
-					std::string imageId = GetImageIdForPiece(piece.m_type);
-					const auto* image = m_imageManager.GetImage(imageId);
-					if (!image) {
-						std::cerr << "Error: Image with id '" << imageId << "' not found in ImageManager." << std::endl;
-						continue;
-					}
-					if (!m_pieceSprites[i]) {
-						m_pieceSprites[i] = std::make_unique<ShoeEngine::Graphics::Sprite>();
-					}
-					m_pieceSprites[i]->SetImage(*image);
-					m_pieceSprites[i]->SetPosition(position.x, position.y);
-					float imageWidth = static_cast<float>(image->GetWidth());
-					float imageHeight = static_cast<float>(image->GetHeight());
-					float scaleX = m_tileSize / imageWidth;
-					float scaleY = m_tileSize / imageHeight;
-					m_pieceSprites[i]->SetScale(scaleX, scaleY);
+				ShoeEngine::Core::Hash::HashValue type = GetCellType(cell);
+				if (m_hasLastFrame && cell == m_lastBoard[i] && type == m_lastTypes[i]) {
+					continue;
+				}
+
+				m_lastBoard[i] = cell;
+				m_lastTypes[i] = type;
+				++m_lastUpdateStats.cellsChanged;
+
+				if (!BayouState::IsOccupied(cell)) {
+					m_cellVisible[i] = false;
+					continue;
 				}
-				else {
-					if (m_pieceSprites[i]) {
-						m_pieceSprites[i].reset();
-					}
+
+				ShoeEngine::Core::Hash::HashValue imageId = GetImageIdForPiece(type);
+				const PieceVisual* visual = GetPieceVisual(imageId);
+				if (!visual) {
+					std::cerr << "Error: Image with id " << static_cast<uint32_t>(imageId) << " not found in ImageManager." << std::endl;
+					m_cellVisible[i] = false;
+					continue;
+				}
+
+				// A sprite keeps its texture alive, so an unchanged pointer and region means an unchanged image.
+				auto& sprite = m_pieceSprites[i];
+				if (sprite.GetTexture() != visual->texture.get() || sprite.GetTextureRect() != visual->rect) {
+					sprite.SetImage(*visual->image, visual->texture, visual->rect);
+					sprite.SetScale(visual->scale.x, visual->scale.y);
+					++m_lastUpdateStats.spritesRebound;
 				}
+				m_cellVisible[i] = true;
 			}
+
+			m_hasLastFrame = true;
+		}
+
+		void BayouStateVisualizer::Invalidate() {
+			m_hasLastFrame = false;
+			m_pieceVisuals.clear();
+		}
+
+		const ShoeEngine::Graphics::Sprite* BayouStateVisualizer::GetPieceSprite(int index) const {
+			if (index < 0 || index >= BayouState::kBoardNumSquares || !m_cellVisible[index]) {
+				return nullptr;
+			}
+			return &m_pieceSprites[index];
 		}
 
 		void BayouStateVisualizer::Render(ShoeEngine::Graphics::Window& window) {
 			m_boardRenderer.Render(window);
-			for (const auto& spritePtr : m_pieceSprites) {
-				if (spritePtr) {
-					window.GetRenderWindow().draw(spritePtr->GetSFMLSprite());
+
+			m_spriteBatch.Begin();
+			for (int i = 0; i < BayouState::kBoardNumSquares; ++i) {
+				if (m_cellVisible[i]) {
+					m_spriteBatch.Draw(m_pieceSprites[i]);
 				}
 			}
+			m_spriteBatch.End(window.GetRenderWindow());
 		}
 
 		// New method to handle mouse clicks.
@@ -3,8 +3,10 @@
 #include <SFML/Graphics.hpp>
 #include <array>
 #include <memory>
+#include <unordered_map>
 #include "BayouState.h"
 #include "graphics/Sprite.h"
+#include "graphics/SpriteBatch.h"
 #include "graphics/Window.h"
 #include "BoardRenderer.h"  // Include board renderer.
 
@@ -21,9 +23,23 @@ namespace ShoeEngine {
 		 * This class observes a BayouState instance and renders both the grid (via BoardRenderer)
 		 * and the game pieces. The grid configuration (tile size and grid count) is passed in,
 		 * allowing for customization.
+		 *
+		 * Updates are diff-driven: the visualizer remembers the board bytes and piece types it
+		 * displayed last and only rebinds the pooled sprites of cells that changed since then.
+		 * A frame without board changes performs no image lookups, texture uploads or allocations.
 		 */
 		class BayouStateVisualizer {
 		public:
+			/**
+			 * @struct UpdateStats
+			 * @brief Work performed by the most recent call to Update().
+			 */
+			struct UpdateStats {
+				int cellsChanged = 0;   ///< Cells whose occupant differed from the previous frame
+				int imageLookups = 0;   ///< Piece visuals resolved through the ImageManager
+				int spritesRebound = 0; ///< Pooled sprites that switched to a different image
+			};
+
 			/**
 			 * @brief Constructs a BayouStateVisualizer.
 			 * @param state The BayouState instance to visualize.
@@ -36,12 +52,48 @@ namespace ShoeEngine {
 
 			/**
 			 * @brief Updates the visual representation to match the current game state.
+			 *
+			 * Only cells whose board byte or piece type changed since the previous call are touched.
 			 */
 			void Update();
 
+			/**
+			 * @brief Forgets the displayed state and cached piece visuals.
+			 *
+			 * The next Update() rebuilds every cell. Call this after images have been reloaded.
+			 */
+			void Invalidate();
+
+			/**
+			 * @brief Gets the work performed by the most recent Update().
+			 * @return Counters of the last update.
+			 */
+			const UpdateStats& GetLastUpdateStats() const { return m_lastUpdateStats; }
+
+			/**
+			 * @brief Gets the renderer drawing the static board layer.
+			 * @return Reference to the board renderer, e.g. to enable static layer baking.
+			 */
+			BoardRenderer& GetBoardRenderer() { return m_boardRenderer; }
+
+			/**
+			 * @brief Gets the batch used to draw the pieces.
+			 * @return Const reference to the sprite batch, e.g. to inspect draw call counts.
+			 */
+			const ShoeEngine::Graphics::SpriteBatch& GetSpriteBatch() const { return m_spriteBatch; }
+
+			/**
+			 * @brief Gets the sprite displayed in a board cell.
+			 * @param index Board index (0..63).
+			 * @return Pointer to the pooled sprite, or nullptr if the cell is empty or out of range.
+			 */
+			const ShoeEngine::Graphics::Sprite* GetPieceSprite(int index) const;
+
 			/**
 			 * @brief Renders the grid and game pieces onto the provided window.
 			 * @param window The engine Window to draw on.
+			 *
+			 * @note Pieces are drawn through a SpriteBatch, so all pieces sharing an image cost one draw call.
 			 */
 			void Render(ShoeEngine::Graphics::Window& window);
 
@@ -52,19 +104,53 @@ namespace ShoeEngine {
 			void HandleMouseClick(ShoeEngine::Graphics::Window& window);
 
 		private:
+			/**
+			 * @struct PieceVisual
+			 * @brief Image, shared texture region and tile scale resolved once per image.
+			 */
+			struct PieceVisual {
+				std::shared_ptr<const ShoeEngine::Graphics::Image> image; ///< Held, so its pixels stay resident
+				std::shared_ptr<const sf::Texture> texture;
+				sf::IntRect rect;
+				sf::Vector2f scale;
+			};
+
 			/**
 			 * @brief Helper function to get the image id for a given piece type.
 			 * @param type The hash value representing the piece type.
 			 * @return The image id corresponding to the piece.
 			 */
-			std::string GetImageIdForPiece(ShoeEngine::Core::Hash::HashValue type) const;
+			ShoeEngine::Core::Hash::HashValue GetImageIdForPiece(ShoeEngine::Core::Hash::HashValue type) const;
+
+			/**
+			 * @brief Gets the cached visual for an image, resolving it on first use.
+			 * @param imageId The id of the image.
+			 * @return Pointer to the cached visual, or nullptr if the image does not exist.
+			 */
+			const PieceVisual* GetPieceVisual(ShoeEngine::Core::Hash::HashValue imageId);
+
+			/**
+			 * @brief Gets the piece type occupying a cell.
+			 * @param cell The encoded board cell.
+			 * @return The piece type, or an empty hash if the cell is empty.
+			 */
+			ShoeEngine::Core::Hash::HashValue GetCellType(uint8_t cell) const;
 
 			BayouState& m_state;
 			ShoeEngine::Graphics::ImageManager& m_imageManager;
 			int m_tileSize;
 			int m_gridCount;
 			BoardRenderer m_boardRenderer;
-			std::array<std::unique_ptr<ShoeEngine::Graphics::Sprite>, BayouState::kBoardNumSquares> m_pieceSprites;
+
+			std::array<ShoeEngine::Graphics::Sprite, BayouState::kBoardNumSquares> m_pieceSprites; ///< One pooled sprite per cell
+			std::array<bool, BayouState::kBoardNumSquares> m_cellVisible{};                    ///< Whether a cell's sprite is drawn
+			std::array<uint8_t, BayouState::kBoardNumSquares> m_lastBoard{};                   ///< Board bytes seen by the last update
+			std::array<ShoeEngine::Core::Hash::HashValue, BayouState::kBoardNumSquares> m_lastTypes{}; ///< Piece types seen by the last update
+			bool m_hasLastFrame = false;                                                        ///< False until the first full update
+
+			std::unordered_map<ShoeEngine::Core::Hash::HashValue, PieceVisual, ShoeEngine::Core::Hash::Hasher> m_pieceVisuals;
+			UpdateStats m_lastUpdateStats;
+			ShoeEngine::Graphics::SpriteBatch m_spriteBatch; ///< Draws all pieces sharing an image in one call
 		};
 
 	} // namespace Bayou
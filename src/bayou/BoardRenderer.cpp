@@ -3,36 +3,131 @@
 namespace ShoeEngine {
 	namespace Bayou {
 
-		BoardRenderer::BoardRenderer(int tileSize)
-			: m_tileSize(tileSize)
+		BoardRenderer::BoardRenderer(int tileSize, int gridCount)
+			: m_tileSize(tileSize),
+			m_gridCount(gridCount)
 		{
 			// No texture loading since we're only drawing grid lines.
 		}
 
-		void BoardRenderer::Render(ShoeEngine::Graphics::Window& window) {
-			const int gridCount = 8; // 8 columns and 8 rows.
-			sf::VertexArray gridLines(sf::Lines);
+		void BoardRenderer::SetTileSize(int tileSize) {
+			if (tileSize != m_tileSize) {
+				m_tileSize = tileSize;
+				m_geometryDirty = true;
+			}
+		}
 
-			// Draw vertical grid lines.
-			for (int i = 0; i <= gridCount; ++i) {
-				float x = static_cast<float>(i * m_tileSize);
-				gridLines.append(sf::Vertex(sf::Vector2f(x, 0.0f), sf::Color::White));
-				gridLines.append(sf::Vertex(sf::Vector2f(x, static_cast<float>(gridCount * m_tileSize)), sf::Color::White));
+		void BoardRenderer::SetGridCount(int gridCount) {
+			if (gridCount != m_gridCount) {
+				m_gridCount = gridCount;
+				m_geometryDirty = true;
+			}
+		}
+
+		void BoardRenderer::SetBackgroundColor(const sf::Color& color) {
+			if (color != m_backgroundColor) {
+				m_backgroundColor = color;
+				m_geometryDirty = true;
 			}
+		}
 
-			// Draw horizontal grid lines.
-			for (int i = 0; i <= gridCount; ++i) {
+		void BoardRenderer::SetStaticLayerBaking(bool enabled) {
+			m_bakeStaticLayer = enabled;
+			if (!enabled) {
+				m_bakedLayer.reset();
+				m_bakedDirty = true;
+			}
+		}
+
+		const sf::VertexArray& BoardRenderer::GetGridGeometry() {
+			UpdateGeometry();
+			return m_gridLines;
+		}
+
+		const sf::VertexArray& BoardRenderer::GetBackgroundGeometry() {
+			UpdateGeometry();
+			return m_background;
+		}
+
+		void BoardRenderer::UpdateGeometry() {
+			if (!m_geometryDirty) {
+				return;
+			}
+
+			const float boardSize = static_cast<float>(m_gridCount * m_tileSize);
+
+			m_gridLines.clear();
+			// Vertical grid lines.
+			for (int i = 0; i <= m_gridCount; ++i) {
+				float x = static_cast<float>(i * m_tileSize);
+				m_gridLines.append(sf::Vertex(sf::Vector2f(x, 0.0f), sf::Color::White));
+				m_gridLines.append(sf::Vertex(sf::Vector2f(x, boardSize), sf::Color::White));
+			}
+			// Horizontal grid lines.
+			for (int i = 0; i <= m_gridCount; ++i) {
 				float y = static_cast<float>(i * m_tileSize);
-				gridLines.append(sf::Vertex(sf::Vector2f(0.0f, y), sf::Color::White));
-				gridLines.append(sf::Vertex(sf::Vector2f(static_cast<float>(gridCount * m_tileSize), y), sf::Color::White));
+				m_gridLines.append(sf::Vertex(sf::Vector2f(0.0f, y), sf::Color::White));
+				m_gridLines.append(sf::Vertex(sf::Vector2f(boardSize, y), sf::Color::White));
+			}
+
+			m_background.clear();
+			if (m_backgroundColor.a != 0) {
+				const sf::Vector2f corners[4] = {
+					{ 0.0f, 0.0f }, { boardSize, 0.0f }, { boardSize, boardSize }, { 0.0f, boardSize }
+				};
+				for (int index : { 0, 1, 2, 0, 2, 3 }) {
+					m_background.append(sf::Vertex(corners[index], m_backgroundColor));
+				}
+			}
+
+			m_geometryDirty = false;
+			m_bakedDirty = true;
+			++m_geometryBuildCount;
+		}
+
+		bool BoardRenderer::UpdateBakedLayer() {
+			if (!m_bakedDirty) {
+				return m_bakedLayer != nullptr;
+			}
+			m_bakedDirty = false;
+
+			// One extra pixel so the closing grid lines at the far edges are inside the texture.
+			const unsigned int size = static_cast<unsigned int>(m_gridCount * m_tileSize + 1);
+			auto layer = std::make_unique<sf::RenderTexture>();
+			if (!layer->create(size, size)) {
+				m_bakedLayer.reset();
+				return false;
 			}
 
-			window.GetRenderWindow().draw(gridLines);
+			layer->clear(sf::Color::Transparent);
+			layer->draw(m_background);
+			layer->draw(m_gridLines);
+			layer->display();
+
+			m_bakedLayer = std::move(layer);
+			m_bakedSprite.setTexture(m_bakedLayer->getTexture(), true);
+			++m_bakeCount;
+			return true;
+		}
+
+		void BoardRenderer::Render(ShoeEngine::Graphics::Window& window) {
+			UpdateGeometry();
+			auto& target = window.GetRenderWindow();
+
+			if (m_bakeStaticLayer && UpdateBakedLayer()) {
+				target.draw(m_bakedSprite);
+				return;
+			}
+
+			if (m_background.getVertexCount() > 0) {
+				target.draw(m_background);
+			}
+			target.draw(m_gridLines);
 		}
 
 		bool BoardRenderer::GetBoardCell(float x, float y, int& row, int& col) const {
-			const int gridCount = 8;
-			if (x < 0 || y < 0 || x >= static_cast<float>(gridCount * m_tileSize) || y >= static_cast<float>(gridCount * m_tileSize)) {
+			const float boardSize = static_cast<float>(m_gridCount * m_tileSize);
+			if (x < 0 || y < 0 || x >= boardSize || y >= boardSize) {
 				return false;
 			}
 			col = static_cast<int>(x) / m_tileSize;
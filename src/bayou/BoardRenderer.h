@@ -2,6 +2,8 @@
 
 #include <SFML/Graphics.hpp>
 #include "graphics/Window.h"
+#include <memory>
+#include <cstddef>
 
 namespace ShoeEngine {
 	namespace Bayou {
@@ -11,17 +13,21 @@ namespace ShoeEngine {
 		 * @brief Renders grid lines for the game board.
 		 *
 		 * This class draws an 8×8 grid (or a grid defined by gridCount) using the specified tile size.
+		 * The grid and background geometry only depend on the tile size, grid count and background
+		 * color, so it is built once and rebuilt only when one of those changes. Optionally the whole
+		 * static layer can be baked into a render texture and drawn as a single textured quad.
 		 */
 		class BoardRenderer {
 		public:
 			/**
 			 * @brief Constructs a BoardRenderer.
 			 * @param tileSize The size of each board cell in pixels (default: 64).
+			 * @param gridCount The number of rows/columns on the board (default: 8).
 			 */
-			BoardRenderer(int tileSize = 64);
+			BoardRenderer(int tileSize = 64, int gridCount = 8);
 
 			/**
-			 * @brief Renders the grid lines.
+			 * @brief Renders the static board layer (background and grid lines).
 			 * @param window The engine Window to draw on.
 			 */
 			void Render(ShoeEngine::Graphics::Window& window);
@@ -42,8 +48,89 @@ namespace ShoeEngine {
 			 */
 			int GetTileSize() const { return m_tileSize; }
 
+			/**
+			 * @brief Sets the tile size; the geometry is rebuilt on the next render if it changed.
+			 * @param tileSize The size of each board cell in pixels.
+			 */
+			void SetTileSize(int tileSize);
+
+			/**
+			 * @brief Gets the number of rows/columns on the board.
+			 * @return The grid count.
+			 */
+			int GetGridCount() const { return m_gridCount; }
+
+			/**
+			 * @brief Sets the number of rows/columns; the geometry is rebuilt on the next render if it changed.
+			 * @param gridCount The number of rows/columns on the board.
+			 */
+			void SetGridCount(int gridCount);
+
+			/**
+			 * @brief Sets the color filling the board behind the grid.
+			 * @param color The background color; sf::Color::Transparent disables the background.
+			 */
+			void SetBackgroundColor(const sf::Color& color);
+
+			/**
+			 * @brief Enables or disables baking the static layer into a render texture.
+			 * @param enabled True to draw the board as one pre-rendered texture.
+			 *
+			 * @note If the render texture cannot be created the renderer falls back to drawing
+			 *       the cached geometry directly.
+			 */
+			void SetStaticLayerBaking(bool enabled);
+
+			/**
+			 * @brief Gets the cached grid line geometry, building it if it is out of date.
+			 * @return Vertex array of grid lines.
+			 */
+			const sf::VertexArray& GetGridGeometry();
+
+			/**
+			 * @brief Gets the cached background geometry, building it if it is out of date.
+			 * @return Vertex array of background triangles (empty when the background is transparent).
+			 */
+			const sf::VertexArray& GetBackgroundGeometry();
+
+			/**
+			 * @brief Gets how many times the geometry has been built.
+			 * @return Number of geometry builds.
+			 */
+			size_t GetGeometryBuildCount() const { return m_geometryBuildCount; }
+
+			/**
+			 * @brief Gets how many times the static layer has been baked.
+			 * @return Number of bakes.
+			 */
+			size_t GetBakeCount() const { return m_bakeCount; }
+
 		private:
+			/**
+			 * @brief Rebuilds the grid and background vertex arrays if they are out of date.
+			 */
+			void UpdateGeometry();
+
+			/**
+			 * @brief Renders the geometry into the baked render texture if it is out of date.
+			 * @return True if a valid baked texture is available.
+			 */
+			bool UpdateBakedLayer();
+
 			int m_tileSize;
+			int m_gridCount;
+			sf::Color m_backgroundColor = sf::Color::Transparent;
+
+			sf::VertexArray m_gridLines{ sf::Lines };       ///< Cached grid line geometry
+			sf::VertexArray m_background{ sf::Triangles };  ///< Cached background geometry
+			bool m_geometryDirty = true;
+			size_t m_geometryBuildCount = 0;
+
+			bool m_bakeStaticLayer = false;
+			bool m_bakedDirty = true;
+			std::unique_ptr<sf::RenderTexture> m_bakedLayer; ///< Pre-rendered static layer
+			sf::Sprite m_bakedSprite;
+			size_t m_bakeCount = 0;
 		};
 
 	} // namespace Bayou
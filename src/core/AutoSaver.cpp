@@ -0,0 +1,138 @@
+#include "AutoSaver.h"
+#include <filesystem>
+#include <utility>
+
+namespace ShoeEngine {
+namespace Core {
+
+namespace {
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+AutoSaver::AutoSaver(DataManager& dataManager, std::string filePath, std::chrono::milliseconds interval)
+    : m_dataManager(dataManager)
+    , m_filePath(std::move(filePath))
+    , m_interval(interval)
+    , m_lastSave(std::chrono::steady_clock::now())
+    , m_worker(&AutoSaver::WorkerLoop, this)
+{
+}
+
+AutoSaver::~AutoSaver()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    m_worker.join();
+}
+
+void AutoSaver::SetDeltaFile(std::string deltaPath, size_t compactInterval)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_deltaPath = std::move(deltaPath);
+    m_compactInterval = compactInterval;
+    m_deltaCount = 0;
+}
+
+bool AutoSaver::Update()
+{
+    if (std::chrono::steady_clock::now() - m_lastSave < m_interval) {
+        return false;
+    }
+    SaveNow();
+    return true;
+}
+
+void AutoSaver::SaveNow()
+{
+    const auto start = std::chrono::steady_clock::now();
+    DataManager::Snapshot snapshot = m_dataManager.TakeSnapshot();
+    const double milliseconds = MillisecondsSince(start);
+    m_lastSave = std::chrono::steady_clock::now();
+
+    std::optional<DataManager::Snapshot> replaced;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending) {
+            // Destroyed outside the lock
+            replaced = std::move(m_pending);
+            ++m_stats.savesReplaced;
+        }
+        m_pending = std::move(snapshot);
+        ++m_stats.savesRequested;
+        m_stats.lastSnapshotMilliseconds = milliseconds;
+        m_stats.totalSnapshotMilliseconds += milliseconds;
+    }
+    m_condition.notify_all();
+}
+
+void AutoSaver::Flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this]() { return !m_pending && !m_writing; });
+}
+
+AutoSaver::Stats AutoSaver::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void AutoSaver::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_condition.wait(lock, [this]() { return m_pending || m_stopping; });
+        if (!m_pending) {
+            return;
+        }
+
+        DataManager::Snapshot snapshot = std::move(*m_pending);
+        m_pending.reset();
+        m_writing = true;
+        const std::string deltaPath = m_deltaPath;
+        const bool compact = !deltaPath.empty() && m_deltaCount + 1 >= m_compactInterval;
+        lock.unlock();
+
+        const auto start = std::chrono::steady_clock::now();
+        bool written = true;
+        bool compacted = false;
+        if (!deltaPath.empty()) {
+            written = m_dataManager.AppendDelta(snapshot, deltaPath);
+        }
+        if (written && (deltaPath.empty() || compact)) {
+            // The delta already holds this snapshot's changes, so if the process dies before
+            // the delta is removed, replaying it over the new main file changes nothing
+            written = m_dataManager.WriteSnapshot(snapshot, m_filePath);
+            if (written && compact) {
+                std::error_code error;
+                std::filesystem::remove(deltaPath, error);
+                compacted = true;
+            }
+        }
+        snapshot.sections.clear();
+        const double milliseconds = MillisecondsSince(start);
+
+        lock.lock();
+        m_writing = false;
+        if (written && !deltaPath.empty() && deltaPath == m_deltaPath) {
+            m_deltaCount = compacted ? 0 : m_deltaCount + 1;
+            ++m_stats.deltasAppended;
+            m_stats.compactions += compacted ? 1 : 0;
+        }
+        ++(written ? m_stats.savesWritten : m_stats.savesFailed);
+        m_stats.lastWriteMilliseconds = milliseconds;
+        m_stats.totalWriteMilliseconds += milliseconds;
+        m_condition.notify_all();
+    }
+}
+
+} // namespace Core
+} // namespace ShoeEngine
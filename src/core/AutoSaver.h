@@ -0,0 +1,131 @@
+#pragma once
+
+#include "DataManager.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @class AutoSaver
+ * @brief Periodically saves the managers' state without stalling the frame
+ *
+ * Each save takes a DataManager::Snapshot on the calling thread, which only copies state,
+ * and hands it to a worker thread that serializes it and writes it with
+ * DataManager::WriteSnapshot. If the worker is still writing when the next snapshot is
+ * taken, the newer snapshot replaces any snapshot still waiting, so saves never queue up.
+ *
+ * With SetDeltaFile, saves append only the sections that changed to a delta file, and
+ * every few saves the delta is compacted into the main file. Load such a save with
+ * DataManager::LoadFromFileWithDelta. Do not save to other files through the same
+ * DataManager meanwhile, since sections saved there would be left out of the delta.
+ *
+ * The AutoSaver must be destroyed before its DataManager. The destructor writes the
+ * snapshot still waiting, if any, before joining the worker.
+ *
+ * @example
+ * AutoSaver autoSaver(dataManager, "data/user/autosave.json", std::chrono::seconds(30));
+ * while (running) {
+ *     ...
+ *     autoSaver.Update();
+ * }
+ * autoSaver.SaveNow();
+ * autoSaver.Flush();
+ */
+class AutoSaver {
+public:
+    /**
+     * @struct Stats
+     * @brief Counts and times of the saves so far
+     */
+    struct Stats {
+        size_t savesRequested = 0;               ///< Snapshots taken
+        size_t savesWritten = 0;                 ///< Snapshots written to the file
+        size_t savesFailed = 0;                  ///< Snapshots that failed to be written
+        size_t savesReplaced = 0;                ///< Snapshots replaced by a newer one before being written
+        size_t deltasAppended = 0;               ///< Saves appended to the delta file
+        size_t compactions = 0;                  ///< Times the delta file was folded into the main file
+        double lastSnapshotMilliseconds = 0.0;   ///< Main thread time of the last snapshot
+        double totalSnapshotMilliseconds = 0.0;  ///< Main thread time of all snapshots
+        double lastWriteMilliseconds = 0.0;      ///< Worker time serializing and writing the last snapshot
+        double totalWriteMilliseconds = 0.0;     ///< Worker time of all writes
+    };
+
+    /**
+     * @brief Constructor starting the worker thread
+     * @param dataManager Manager whose state is saved
+     * @param filePath Path of the JSON file to write
+     * @param interval Time between saves made by Update
+     */
+    AutoSaver(DataManager& dataManager, std::string filePath, std::chrono::milliseconds interval);
+
+    /**
+     * @brief Destructor; writes the waiting snapshot and joins the worker
+     */
+    ~AutoSaver();
+
+    AutoSaver(const AutoSaver&) = delete;
+    AutoSaver& operator=(const AutoSaver&) = delete;
+
+    /**
+     * @brief Saves changes to a delta file, compacting it into the main file periodically
+     * @param deltaPath Path of the delta file; empty to always write the whole main file
+     * @param compactInterval Number of saves appended before the main file is rewritten
+     */
+    void SetDeltaFile(std::string deltaPath, size_t compactInterval);
+
+    /**
+     * @brief Saves if the interval has passed since the last save; call once per frame
+     * @return bool True if a snapshot was taken
+     */
+    bool Update();
+
+    /**
+     * @brief Takes a snapshot now and queues it for writing
+     */
+    void SaveNow();
+
+    /**
+     * @brief Waits until every snapshot taken so far has been written or has failed
+     */
+    void Flush();
+
+    /**
+     * @brief Gets the counts and times of the saves so far
+     * @return Copy of the statistics
+     */
+    Stats GetStats() const;
+
+    const std::string& GetFilePath() const { return m_filePath; }
+    std::chrono::milliseconds GetInterval() const { return m_interval; }
+
+private:
+    /**
+     * @brief Worker loop: writes snapshots until stopped and nothing is waiting
+     */
+    void WorkerLoop();
+
+    DataManager& m_dataManager;
+    const std::string m_filePath;
+    const std::chrono::milliseconds m_interval;
+    std::chrono::steady_clock::time_point m_lastSave;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::optional<DataManager::Snapshot> m_pending; ///< Snapshot waiting for the worker
+    bool m_writing = false;                         ///< Worker is writing a snapshot
+    bool m_stopping = false;
+    std::string m_deltaPath;                        ///< Empty when delta saves are off
+    size_t m_compactInterval = 0;
+    size_t m_deltaCount = 0;                        ///< Saves appended since the last compaction
+    Stats m_stats;
+    std::thread m_worker;                           ///< Last member, so it starts after the others exist
+};
+
+} // namespace Core
+} // namespace ShoeEngine
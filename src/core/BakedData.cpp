@@ -0,0 +1,220 @@
+#include "BakedData.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace ShoeEngine {
+namespace Core {
+
+namespace {
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+template<typename T>
+void WriteAt(std::vector<uint8_t>& buffer, size_t offset, const T& value) {
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+} // namespace
+
+BakedSection::BakedSection(const BakedFile& file, const Baked::SectionHeader& header)
+    : m_file(&file)
+    , m_header(&header)
+    , m_records(file.GetData() + header.offset)
+{
+}
+
+std::string_view BakedSection::GetString(Hash::HashValue hash) const
+{
+    return m_file->GetString(hash);
+}
+
+bool BakedFile::Open(const std::string& filePath)
+{
+    m_memory.clear();
+    if (!m_mapping.Open(filePath)) {
+        return false;
+    }
+    m_data = m_mapping.GetData();
+    m_size = m_mapping.GetSize();
+    return Validate();
+}
+
+bool BakedFile::OpenFromMemory(std::vector<uint8_t> bytes)
+{
+    m_mapping.Close();
+    m_memory = std::move(bytes);
+    m_data = m_memory.data();
+    m_size = m_memory.size();
+    return Validate();
+}
+
+bool BakedFile::Validate()
+{
+    m_header = nullptr;
+    m_sections = nullptr;
+    m_strings = nullptr;
+    m_stringData = nullptr;
+
+    if (!m_data || m_size < sizeof(Baked::FileHeader)) {
+        return false;
+    }
+    const auto* header = reinterpret_cast<const Baked::FileHeader*>(m_data);
+    if (std::memcmp(header->magic, Baked::FILE_MAGIC, sizeof(Baked::FILE_MAGIC)) != 0
+        || header->version != Baked::FILE_VERSION) {
+        return false;
+    }
+
+    const uint64_t sectionsEnd = sizeof(Baked::FileHeader) + uint64_t{ header->sectionCount } * sizeof(Baked::SectionHeader);
+    const uint64_t stringsEnd = header->stringTableOffset + uint64_t{ header->stringCount } * sizeof(Baked::StringEntry);
+    const uint64_t stringDataEnd = uint64_t{ header->stringDataOffset } + header->stringDataSize;
+    if (sectionsEnd > m_size || stringsEnd > m_size || stringDataEnd > m_size
+        || header->stringTableOffset % alignof(Baked::StringEntry) != 0) {
+        return false;
+    }
+
+    const auto* sections = reinterpret_cast<const Baked::SectionHeader*>(m_data + sizeof(Baked::FileHeader));
+    for (uint32_t i = 0; i < header->sectionCount; ++i) {
+        const uint64_t recordsEnd = sections[i].offset + uint64_t{ sections[i].recordSize } * sections[i].recordCount;
+        if (recordsEnd > m_size || sections[i].offset % 8 != 0) {
+            return false;
+        }
+    }
+
+    const auto* strings = reinterpret_cast<const Baked::StringEntry*>(m_data + header->stringTableOffset);
+    for (uint32_t i = 0; i < header->stringCount; ++i) {
+        if (uint64_t{ strings[i].offset } + strings[i].length >= uint64_t{ header->stringDataSize } + 1) {
+            return false;
+        }
+    }
+
+    m_header = header;
+    m_sections = sections;
+    m_strings = strings;
+    m_stringData = reinterpret_cast<const char*>(m_data + header->stringDataOffset);
+    return true;
+}
+
+std::string_view BakedFile::GetString(size_t index, Hash::HashValue& hash) const
+{
+    const Baked::StringEntry& entry = m_strings[index];
+    hash = Hash::HashValue(entry.hash);
+    return std::string_view(m_stringData + entry.offset, entry.length);
+}
+
+std::string_view BakedFile::GetString(Hash::HashValue hash) const
+{
+    if (!m_header) {
+        return {};
+    }
+    const Baked::StringEntry* end = m_strings + m_header->stringCount;
+    const Baked::StringEntry* entry = std::lower_bound(m_strings, end, static_cast<uint32_t>(hash),
+        [](const Baked::StringEntry& lhs, uint32_t rhs) { return lhs.hash < rhs; });
+    if (entry == end || entry->hash != static_cast<uint32_t>(hash)) {
+        return {};
+    }
+    return std::string_view(m_stringData + entry->offset, entry->length);
+}
+
+BakedSectionWriter::BakedSectionWriter(Hash::HashValue type, BakedWriter& file)
+    : m_type(type)
+    , m_file(&file)
+{
+}
+
+Hash::HashValue BakedSectionWriter::AddString(const std::string& str)
+{
+    return m_file->AddString(str);
+}
+
+BakedSectionWriter& BakedWriter::AddSection(Hash::HashValue type)
+{
+    m_sections.push_back(std::make_unique<BakedSectionWriter>(type, *this));
+    return *m_sections.back();
+}
+
+Hash::HashValue BakedWriter::AddString(const std::string& str)
+{
+    Hash::HashValue hash(str);
+    auto [it, inserted] = m_strings.try_emplace(hash, str);
+    if (!inserted && it->second != str) {
+        std::cerr << "String hash collision while baking: \"" << str << "\" and \"" << it->second
+            << "\" both hash to " << static_cast<uint32_t>(hash) << "\n";
+        ++m_collisionCount;
+    }
+    return hash;
+}
+
+std::vector<uint8_t> BakedWriter::WriteToBuffer() const
+{
+    // Lay out the blocks
+    const size_t stringTableOffset = sizeof(Baked::FileHeader) + m_sections.size() * sizeof(Baked::SectionHeader);
+    const size_t stringDataOffset = stringTableOffset + m_strings.size() * sizeof(Baked::StringEntry);
+    size_t stringDataSize = 0;
+    for (const auto& [hash, str] : m_strings) {
+        stringDataSize += str.size() + 1;
+    }
+
+    std::vector<size_t> recordOffsets;
+    size_t end = stringDataOffset + stringDataSize;
+    for (const auto& section : m_sections) {
+        end = AlignUp(end, 8);
+        recordOffsets.push_back(end);
+        end += section->GetBytes().size();
+    }
+
+    std::vector<uint8_t> buffer(end, 0);
+
+    Baked::FileHeader header{};
+    std::memcpy(header.magic, Baked::FILE_MAGIC, sizeof(Baked::FILE_MAGIC));
+    header.version = Baked::FILE_VERSION;
+    header.sectionCount = static_cast<uint32_t>(m_sections.size());
+    header.stringCount = static_cast<uint32_t>(m_strings.size());
+    header.stringTableOffset = static_cast<uint32_t>(stringTableOffset);
+    header.stringDataOffset = static_cast<uint32_t>(stringDataOffset);
+    header.stringDataSize = static_cast<uint32_t>(stringDataSize);
+    header.sourceHash = m_sourceHash;
+    WriteAt(buffer, 0, header);
+
+    for (size_t i = 0; i < m_sections.size(); ++i) {
+        const auto& section = *m_sections[i];
+        Baked::SectionHeader sectionHeader{};
+        sectionHeader.type = section.GetType();
+        sectionHeader.recordSize = section.GetRecordSize();
+        sectionHeader.recordCount = section.GetRecordCount();
+        sectionHeader.offset = static_cast<uint32_t>(recordOffsets[i]);
+        WriteAt(buffer, sizeof(Baked::FileHeader) + i * sizeof(Baked::SectionHeader), sectionHeader);
+        if (!section.GetBytes().empty()) {
+            std::memcpy(buffer.data() + recordOffsets[i], section.GetBytes().data(), section.GetBytes().size());
+        }
+    }
+
+    // std::map keeps the string table sorted by hash for binary search
+    size_t index = 0;
+    size_t stringOffset = 0;
+    for (const auto& [hash, str] : m_strings) {
+        Baked::StringEntry entry{ hash, static_cast<uint32_t>(stringOffset), static_cast<uint32_t>(str.size()) };
+        WriteAt(buffer, stringTableOffset + index * sizeof(Baked::StringEntry), entry);
+        std::memcpy(buffer.data() + stringDataOffset + stringOffset, str.data(), str.size());
+        stringOffset += str.size() + 1;
+        ++index;
+    }
+
+    return buffer;
+}
+
+bool BakedWriter::WriteToFile(const std::string& filePath) const
+{
+    const std::vector<uint8_t> buffer = WriteToBuffer();
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(file);
+}
+
+} // namespace Core
+} // namespace ShoeEngine
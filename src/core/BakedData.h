@@ -0,0 +1,341 @@
+#pragma once
+
+#include "Hash.h"
+#include "MappedFile.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @namespace Baked
+ * @brief On-disk layout of baked data files
+ *
+ * A baked file is laid out as follows. All offsets are relative to the start of the
+ * file, in native byte order:
+ *
+ * | Block            | Contents                                                    |
+ * |------------------|-------------------------------------------------------------|
+ * | FileHeader       | Magic, version, block offsets and source hash               |
+ * | SectionHeader[]  | One per top-level section, keyed by the type HashValue      |
+ * | StringEntry[]    | String registry sorted by hash                              |
+ * | string data      | Null-terminated UTF-8 strings                               |
+ * | section records  | Fixed-size records of each section, 8-byte aligned          |
+ */
+namespace Baked {
+
+constexpr char FILE_MAGIC[8] = { 'S', 'H', 'O', 'E', 'B', 'A', 'K', 'E' };
+constexpr uint32_t FILE_VERSION = 2;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t sectionCount;
+    uint32_t stringCount;
+    uint32_t stringTableOffset;
+    uint32_t stringDataOffset;
+    uint32_t stringDataSize;
+    uint64_t sourceHash; ///< Hash::HashFile of the JSON the file was baked from, 0 if unknown
+};
+
+struct SectionHeader {
+    uint32_t type;        ///< HashValue of the section name (e.g. "images")
+    uint32_t recordSize;  ///< Size of one record in bytes
+    uint32_t recordCount; ///< Number of records
+    uint32_t offset;      ///< Offset of the first record
+};
+
+struct StringEntry {
+    uint32_t hash;   ///< HashValue of the string
+    uint32_t offset; ///< Offset of the string within the string data
+    uint32_t length; ///< Length of the string without the terminator
+};
+
+} // namespace Baked
+
+class BakedFile;
+class BakedWriter;
+
+/**
+ * @class BakedSection
+ * @brief Read-only view of the records of one top-level section of a baked file
+ *
+ * Records point straight into the file's memory; nothing is copied or parsed.
+ */
+class BakedSection {
+public:
+    /**
+     * @brief Constructor
+     * @param file The file the section belongs to
+     * @param header The section's header within the file
+     */
+    BakedSection(const BakedFile& file, const Baked::SectionHeader& header);
+
+    /**
+     * @brief Gets the type of the section
+     * @return HashValue of the section name
+     */
+    Hash::HashValue GetType() const { return Hash::HashValue(m_header->type); }
+
+    /**
+     * @brief Gets the number of records in the section
+     * @return Record count
+     */
+    size_t GetRecordCount() const { return m_header->recordCount; }
+
+    /**
+     * @brief Gets the records of the section
+     * @tparam Record Plain record type the section was baked with
+     * @return Pointer to the first record, or nullptr if the record size does not match
+     */
+    template<typename Record>
+    const Record* GetRecords() const {
+        static_assert(std::is_trivially_copyable_v<Record>, "Baked records must be plain data");
+        if (m_header->recordSize != sizeof(Record)) {
+            return nullptr;
+        }
+        return reinterpret_cast<const Record*>(m_records);
+    }
+
+    /**
+     * @brief Looks up a string in the file's string table
+     * @param hash HashValue of the string
+     * @return The string, or an empty view if it is not in the table
+     */
+    std::string_view GetString(Hash::HashValue hash) const;
+
+private:
+    const BakedFile* m_file;
+    const Baked::SectionHeader* m_header;
+    const uint8_t* m_records;
+};
+
+/**
+ * @class BakedFile
+ * @brief Memory-mapped baked data file
+ *
+ * The file is validated once when it is opened. After that, sections and strings are
+ * read in place from the mapping.
+ */
+class BakedFile {
+public:
+    /**
+     * @brief Maps and validates a baked file
+     * @param filePath Path of the file
+     * @return True if the file was mapped and is a valid baked file
+     */
+    bool Open(const std::string& filePath);
+
+    /**
+     * @brief Uses an in-memory copy of a baked file instead of a mapping
+     * @param bytes Contents of a baked file
+     * @return True if the contents are a valid baked file
+     */
+    bool OpenFromMemory(std::vector<uint8_t> bytes);
+
+    /**
+     * @brief Gets the number of sections
+     * @return Section count
+     */
+    size_t GetSectionCount() const { return m_header ? m_header->sectionCount : 0; }
+
+    /**
+     * @brief Gets a section by index, in the order they were baked
+     * @param index Section index
+     * @return View of the section
+     */
+    BakedSection GetSection(size_t index) const { return BakedSection(*this, m_sections[index]); }
+
+    /**
+     * @brief Gets the number of strings in the string table
+     * @return String count
+     */
+    size_t GetStringCount() const { return m_header ? m_header->stringCount : 0; }
+
+    /**
+     * @brief Gets the total size of the string data
+     * @return Size in bytes, including terminators
+     */
+    size_t GetStringDataSize() const { return m_header ? m_header->stringDataSize : 0; }
+
+    /**
+     * @brief Gets a string table entry by index
+     * @param index Entry index
+     * @param hash Receives the HashValue of the string
+     * @return The string
+     */
+    std::string_view GetString(size_t index, Hash::HashValue& hash) const;
+
+    /**
+     * @brief Looks up a string by its hash
+     * @param hash HashValue of the string
+     * @return The string, or an empty view if it is not in the table
+     */
+    std::string_view GetString(Hash::HashValue hash) const;
+
+    /**
+     * @brief Gets the hash of the JSON file the data was baked from
+     * @return Hash::HashFile of the source, or 0 if it was not recorded
+     */
+    Hash::HashValue64 GetSourceHash() const { return Hash::HashValue64(m_header ? m_header->sourceHash : 0); }
+
+    /**
+     * @brief Gets the start of the file's bytes
+     * @return Pointer to the file contents
+     */
+    const uint8_t* GetData() const { return m_data; }
+
+private:
+    /**
+     * @brief Checks the header and that every block lies inside the file
+     * @return True if the file is a valid baked file
+     */
+    bool Validate();
+
+    MappedFile m_mapping;
+    std::vector<uint8_t> m_memory;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    const Baked::FileHeader* m_header = nullptr;
+    const Baked::SectionHeader* m_sections = nullptr;
+    const Baked::StringEntry* m_strings = nullptr;
+    const char* m_stringData = nullptr;
+};
+
+/**
+ * @class BakedSectionWriter
+ * @brief Collects the records of one section while baking
+ */
+class BakedSectionWriter {
+public:
+    /**
+     * @brief Constructor
+     * @param type HashValue of the section name
+     * @param file Writer of the file, whose string table is shared by all sections
+     */
+    BakedSectionWriter(Hash::HashValue type, BakedWriter& file);
+
+    /**
+     * @brief Appends a record; all records of a section must have the same type
+     * @tparam Record Plain record type
+     * @param record The record
+     */
+    template<typename Record>
+    void AddRecord(const Record& record) {
+        static_assert(std::is_trivially_copyable_v<Record>, "Baked records must be plain data");
+        m_recordSize = sizeof(Record);
+        const size_t offset = m_bytes.size();
+        m_bytes.resize(offset + sizeof(Record));
+        std::memcpy(m_bytes.data() + offset, &record, sizeof(Record));
+        ++m_recordCount;
+    }
+
+    /**
+     * @brief Adds a string to the file's string table
+     * @param str The string
+     * @return HashValue of the string, to be stored in records
+     * @see BakedWriter::AddString
+     */
+    Hash::HashValue AddString(const std::string& str);
+
+    /**
+     * @brief Gets the type of the section
+     * @return HashValue of the section name
+     */
+    Hash::HashValue GetType() const { return m_type; }
+
+    /**
+     * @brief Gets the size of one record
+     * @return Record size in bytes, 0 if no record was added
+     */
+    uint32_t GetRecordSize() const { return m_recordSize; }
+
+    /**
+     * @brief Gets the number of records added
+     * @return Record count
+     */
+    uint32_t GetRecordCount() const { return m_recordCount; }
+
+    /**
+     * @brief Gets the raw bytes of all records
+     * @return Record bytes
+     */
+    const std::vector<uint8_t>& GetBytes() const { return m_bytes; }
+
+private:
+    Hash::HashValue m_type;
+    BakedWriter* m_file;
+    uint32_t m_recordSize = 0;
+    uint32_t m_recordCount = 0;
+    std::vector<uint8_t> m_bytes;
+};
+
+/**
+ * @class BakedWriter
+ * @brief Builds a baked file from sections and strings
+ *
+ * Output is deterministic: sections are written in the order they were added and the
+ * string table is sorted by hash.
+ */
+class BakedWriter {
+public:
+    /**
+     * @brief Starts a new section
+     * @param type HashValue of the section name
+     * @return Writer receiving the section's records; valid until the BakedWriter is destroyed
+     */
+    BakedSectionWriter& AddSection(Hash::HashValue type);
+
+    /**
+     * @brief Adds a string to the string table
+     * @param str The string
+     * @return HashValue of the string
+     *
+     * If a different string was added under the same hash, the collision is reported on
+     * std::cerr and counted, and the first string is kept. Records could not tell the
+     * two strings apart, so DataManager rejects bakes with collisions.
+     */
+    Hash::HashValue AddString(const std::string& str);
+
+    /**
+     * @brief Gets the number of strings that collided with a different string
+     * @return Collision count
+     */
+    size_t GetCollisionCount() const { return m_collisionCount; }
+
+    /**
+     * @brief Records the hash of the JSON file the data is baked from
+     * @param sourceHash Hash::HashFile of the source, or 0 for none
+     */
+    void SetSourceHash(Hash::HashValue64 sourceHash) { m_sourceHash = sourceHash; }
+
+    /**
+     * @brief Serializes the file
+     * @return Contents of the baked file
+     */
+    std::vector<uint8_t> WriteToBuffer() const;
+
+    /**
+     * @brief Writes the file to disk
+     * @param filePath Destination path
+     * @return True if the file was written
+     */
+    bool WriteToFile(const std::string& filePath) const;
+
+private:
+    std::map<uint32_t, std::string> m_strings;
+    std::vector<std::unique_ptr<BakedSectionWriter>> m_sections;
+    size_t m_collisionCount = 0;
+    Hash::HashValue64 m_sourceHash;
+};
+
+} // namespace Core
+} // namespace ShoeEngine
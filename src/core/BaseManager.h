@@ -1,12 +1,63 @@
 #pragma once
 
 #include "Hash.h"
+#include "JsonStreamHandler.h"
+#include "JsonWriter.h"
 #include <nlohmann/json.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace ShoeEngine {
 namespace Core {
 
 class DataManager;  // Forward declaration
+class BakedSection;
+class BakedSectionWriter;
+
+/**
+ * @class ManagerSnapshot
+ * @brief Copy of a manager's state that can be serialized on another thread
+ *
+ * Taken on the main thread by BaseManager::CreateSnapshot, then turned into JSON by the
+ * autosave worker while the game keeps running. A snapshot must not refer to the live
+ * state of its manager; strings may be looked up through the DataManager, whose string
+ * registry is thread-safe.
+ */
+class ManagerSnapshot {
+public:
+    /**
+     * @brief Layout of saved sections: indented by 4, nested one level deep in the root object
+     */
+    static constexpr int SAVE_INDENT = 4;
+    static constexpr int SAVE_LEVEL = 1;
+
+    virtual ~ManagerSnapshot() = default;
+
+    /**
+     * @brief Serializes the snapshot
+     * @param writer Receives the same JSON as the manager's WriteJson at the time of the snapshot
+     */
+    virtual void WriteJson(JsonWriter& writer) const = 0;
+};
+
+/**
+ * @class TextSnapshot
+ * @brief Snapshot holding a section already written as JSON text in the save layout
+ */
+class TextSnapshot : public ManagerSnapshot {
+public:
+    explicit TextSnapshot(std::string text) : m_text(std::move(text)) {}
+
+    void WriteJson(JsonWriter& writer) const override {
+        writer.Raw(m_text);
+    }
+
+private:
+    std::string m_text;
+};
 
 /**
  * @class BaseManager
@@ -41,6 +92,60 @@ public:
      */
     virtual Hash::HashValue GetManagedType() const = 0;
 
+    /**
+     * @brief Gets the types whose sections must be loaded before this manager's section
+     * @return Types this manager reads during loading, e.g. "images" for sprites
+     *
+     * Dependencies on types that are not part of the loaded data are ignored.
+     */
+    virtual std::vector<Hash::HashValue> GetDependencies() const {
+        return {};
+    }
+
+    /**
+     * @brief Whether this manager's section must be loaded on the thread calling DataManager
+     * @return True for managers creating windows or GPU resources; false (the default) allows a worker thread
+     */
+    virtual bool RequiresMainThread() const {
+        return false;
+    }
+
+    /**
+     * @brief Opts into event-based loading by DataManager::ProcessStream
+     * @return Handler receiving the parse events of this manager's section, or nullptr
+     *         (the default) to receive the section as a JSON tree through CreateFromJson
+     */
+    virtual std::unique_ptr<JsonStreamHandler> CreateFromStream() {
+        return nullptr;
+    }
+
+    /**
+     * @brief Creates objects from a section of a baked data file
+     * @param section View of the section's records, baked by BakeJson
+     * @return bool True if the objects were created successfully; false if unsupported
+     */
+    virtual bool CreateFromBaked(const BakedSection& section) {
+        return false;
+    }
+
+    /**
+     * @brief Converts this manager's JSON section into fixed-layout baked records
+     * @param jsonData The JSON data that would be passed to CreateFromJson
+     * @param writer Receives the records and the strings they reference
+     * @return bool True if the section was baked; false if unsupported or invalid
+     */
+    virtual bool BakeJson(const nlohmann::json& jsonData, BakedSectionWriter& writer) const {
+        return false;
+    }
+
+    /**
+     * @brief Removes all managed objects
+     *
+     * DataManager::ClearManagers calls it to undo a partial load before loading from
+     * another source. The default does nothing, for managers that hold no objects.
+     */
+    virtual void Clear() {}
+
     /**
      * @brief Virtual function to serialize managed objects to JSON
      * @return nlohmann::json JSON object containing serialized data of all managed objects
@@ -49,8 +154,59 @@ public:
         return nlohmann::json::array();
     }
 
+    /**
+     * @brief Writes managed objects straight into a JSON writer
+     * @param writer Receives one value, the manager's section
+     *
+     * The default writes the tree returned by SerializeToJson. Managers overriding it
+     * usually implement SerializeToJson with JsonWriter::ToJson on top of it.
+     */
+    virtual void WriteJson(JsonWriter& writer) {
+        writer.Value(SerializeToJson());
+    }
+
+    /**
+     * @brief Copies the state that SerializeToJson would save
+     * @return Snapshot to serialize off the main thread
+     *
+     * The default writes the section as text with WriteJson on the calling thread. Managers
+     * whose state changes while the game runs should override it with a plain copy of that
+     * state, which is cheaper.
+     */
+    virtual std::unique_ptr<ManagerSnapshot> CreateSnapshot() {
+        JsonWriter writer(ManagerSnapshot::SAVE_INDENT);
+        writer.Reset(ManagerSnapshot::SAVE_LEVEL);
+        WriteJson(writer);
+        return std::make_unique<TextSnapshot>(writer.TakeBuffer());
+    }
+
+    /**
+     * @brief Whether the manager calls MarkDirty on every change to the state it saves
+     * @return True to let saves reuse the last serialized section while GetGeneration() is
+     *         unchanged; false (the default) serializes the manager on every save
+     */
+    virtual bool TracksChanges() const {
+        return false;
+    }
+
+    /**
+     * @brief Gets a counter that grows whenever the state saved by SerializeToJson changes
+     * @return Generation; only meaningful if TracksChanges() returns true
+     */
+    virtual uint64_t GetGeneration() const {
+        return m_generation;
+    }
+
+    /**
+     * @brief Records a change to the saved state; DataManager calls it after loading a section
+     */
+    void MarkDirty() {
+        ++m_generation;
+    }
+
 protected:
     DataManager& m_dataManager;  // Reference to the DataManager for string registration
+    uint64_t m_generation = 0;   // Bumped by MarkDirty
 };
 
 } // namespace Core
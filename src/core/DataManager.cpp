@@ -1,11 +1,228 @@
 #include "DataManager.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
+#include <iostream>
+#include <mutex>
+#include <set>
 #include <stdexcept>
 #include <filesystem>
 
 namespace ShoeEngine {
 namespace Core {
 
+namespace {
+
+/**
+ * @brief SAX consumer that routes the top-level sections of a JSON object to their managers
+ *
+ * Depth 1 is inside the root object, where each key names a section. Events of a section
+ * are forwarded to the manager's stream handler, collected into a JSON tree for
+ * CreateFromJson, or dropped when no manager is registered.
+ */
+class SectionRouter : public nlohmann::json_sax<nlohmann::json> {
+public:
+    explicit SectionRouter(DataManager& dataManager) : m_dataManager(dataManager) {}
+
+    bool null() override {
+        return Scalar(nullptr, [](JsonStreamHandler& handler) { return handler.Null(); });
+    }
+    bool boolean(bool value) override {
+        return Scalar(value, [value](JsonStreamHandler& handler) { return handler.Boolean(value); });
+    }
+    bool number_integer(number_integer_t value) override {
+        return Scalar(value, [value](JsonStreamHandler& handler) { return handler.Integer(value); });
+    }
+    bool number_unsigned(number_unsigned_t value) override {
+        return Scalar(value, [value](JsonStreamHandler& handler) { return handler.Unsigned(value); });
+    }
+    bool number_float(number_float_t value, const string_t&) override {
+        return Scalar(value, [value](JsonStreamHandler& handler) { return handler.Float(value); });
+    }
+    bool string(string_t& value) override {
+        return Scalar(value, [&value](JsonStreamHandler& handler) { return handler.String(value); });
+    }
+    bool binary(binary_t&) override {
+        return false;
+    }
+
+    bool start_object(std::size_t) override {
+        return StartContainer(nlohmann::json::object(), [](JsonStreamHandler& handler) { return handler.StartObject(); });
+    }
+    bool end_object() override {
+        return EndContainer([](JsonStreamHandler& handler) { return handler.EndObject(); });
+    }
+    bool start_array(std::size_t) override {
+        return StartContainer(nlohmann::json::array(), [](JsonStreamHandler& handler) { return handler.StartArray(); });
+    }
+    bool end_array() override {
+        return EndContainer([](JsonStreamHandler& handler) { return handler.EndArray(); });
+    }
+
+    bool key(string_t& key) override {
+        if (m_depth == 1) {
+            BeginSection(key);
+            return true;
+        }
+        switch (m_mode) {
+        case Mode::Stream:
+            Forward([&key](JsonStreamHandler& handler) { return handler.Key(key); });
+            break;
+        case Mode::Tree:
+            m_treeKey = key;
+            break;
+        case Mode::Skip:
+            break;
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::json::exception&) override {
+        return false;
+    }
+
+    bool Succeeded() const { return m_anyManagerProcessed && m_allProcessedSuccessfully; }
+
+private:
+    enum class Mode {
+        Skip,   ///< No manager, or the section already failed
+        Stream, ///< Events go to the manager's JsonStreamHandler
+        Tree    ///< Events build a JSON tree of the section for CreateFromJson
+    };
+
+    void BeginSection(const std::string& name) {
+        m_mode = Mode::Skip;
+        m_manager = m_dataManager.GetManager(Hash::HashValue(name));
+        if (!m_manager) {
+            return;
+        }
+
+        m_anyManagerProcessed = true;
+        m_handler = m_manager->CreateFromStream();
+        m_mode = m_handler ? Mode::Stream : Mode::Tree;
+        m_tree = nullptr;
+        m_treeStack.clear();
+    }
+
+    void EndSection() {
+        bool succeeded = true;
+        if (m_mode == Mode::Stream) {
+            succeeded = m_handler->Finish();
+        }
+        else if (m_mode == Mode::Tree) {
+            succeeded = m_manager->CreateFromJson(m_tree);
+        }
+        else if (m_manager) {
+            succeeded = false; // Skipping after a failed event
+        }
+
+        if (!succeeded) {
+            m_allProcessedSuccessfully = false;
+        }
+        if (m_manager) {
+            m_manager->MarkDirty();
+        }
+        m_manager = nullptr;
+        m_handler.reset();
+        m_tree = nullptr;
+        m_mode = Mode::Skip;
+    }
+
+    template<typename Event>
+    void Forward(Event&& event) {
+        if (!event(*m_handler)) {
+            // The section failed; ignore the rest of it
+            m_handler.reset();
+            m_mode = Mode::Skip;
+        }
+    }
+
+    // Stores a value in the section tree and returns where it was stored
+    nlohmann::json* AddToTree(nlohmann::json&& value) {
+        if (m_treeStack.empty()) {
+            m_tree = std::move(value);
+            return &m_tree;
+        }
+        nlohmann::json& parent = *m_treeStack.back();
+        if (parent.is_array()) {
+            parent.push_back(std::move(value));
+            return &parent.back();
+        }
+        nlohmann::json& slot = parent[m_treeKey];
+        slot = std::move(value);
+        return &slot;
+    }
+
+    template<typename Event>
+    bool Scalar(nlohmann::json&& value, Event&& event) {
+        if (m_depth == 0) {
+            return false; // The root must be an object
+        }
+        if (m_mode == Mode::Stream) {
+            Forward(event);
+        }
+        else if (m_mode == Mode::Tree) {
+            AddToTree(std::move(value));
+        }
+
+        if (m_depth == 1) {
+            EndSection();
+        }
+        return true;
+    }
+
+    template<typename Event>
+    bool StartContainer(nlohmann::json&& container, Event&& event) {
+        ++m_depth;
+        if (m_depth == 1) {
+            return container.is_object(); // The root must be an object
+        }
+
+        if (m_mode == Mode::Stream) {
+            Forward(event);
+        }
+        else if (m_mode == Mode::Tree) {
+            m_treeStack.push_back(AddToTree(std::move(container)));
+        }
+        return true;
+    }
+
+    template<typename Event>
+    bool EndContainer(Event&& event) {
+        --m_depth;
+        if (m_depth == 0) {
+            return true;
+        }
+
+        if (m_mode == Mode::Stream) {
+            Forward(event);
+        }
+        else if (m_mode == Mode::Tree) {
+            m_treeStack.pop_back();
+        }
+
+        if (m_depth == 1) {
+            EndSection();
+        }
+        return true;
+    }
+
+    DataManager& m_dataManager;
+    int m_depth = 0;
+    Mode m_mode = Mode::Skip;
+    BaseManager* m_manager = nullptr;
+    std::unique_ptr<JsonStreamHandler> m_handler;
+    nlohmann::json m_tree;
+    std::vector<nlohmann::json*> m_treeStack;
+    std::string m_treeKey;
+    bool m_anyManagerProcessed = false;
+    bool m_allProcessedSuccessfully = true;
+};
+
+} // namespace
+
 DataManager::DataManager() = default;
 DataManager::~DataManager() = default;
 
@@ -18,16 +235,38 @@ bool DataManager::RegisterManager(std::unique_ptr<BaseManager> manager) {
     return true;
 }
 
-Hash::HashValue DataManager::RegisterString(const std::string& str) {
-    Hash::HashValue hash(str.c_str(), static_cast<uint32_t>(str.length()));
-    m_stringRegistry[hash] = str;
+Hash::HashValue DataManager::RegisterString(std::string_view str) {
+    Hash::HashValue hash(str.data(), static_cast<uint32_t>(str.length()));
+    {
+        // Most strings are already registered; check under the shared lock first
+        std::shared_lock<std::shared_mutex> lock(m_stringMutex);
+        std::string_view existing = m_stringPool.Find(hash);
+        if (!existing.empty() && existing == str) {
+            return hash;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_stringMutex);
+    if (m_stringPool.Intern(hash, str) == StringPool::InternResult::Collision) {
+        std::cerr << "String hash collision: \"" << str << "\" and \"" << m_stringPool.Find(hash)
+            << "\" both hash to " << static_cast<uint32_t>(hash) << "\n";
+    }
     return hash;
 }
 
-const std::string& DataManager::GetString(const Hash::HashValue& hash) const {
-    static const std::string empty;
-    auto it = m_stringRegistry.find(hash);
-    return it != m_stringRegistry.end() ? it->second : empty;
+std::string_view DataManager::GetString(const Hash::HashValue& hash) const {
+    std::shared_lock<std::shared_mutex> lock(m_stringMutex);
+    return m_stringPool.Find(hash);
+}
+
+void DataManager::ReserveStrings(size_t stringCount, size_t byteCount) {
+    std::unique_lock<std::shared_mutex> lock(m_stringMutex);
+    m_stringPool.Reserve(stringCount, byteCount);
+}
+
+size_t DataManager::GetStringCollisionCount() const {
+    std::shared_lock<std::shared_mutex> lock(m_stringMutex);
+    return m_stringPool.GetCollisionCount();
 }
 
 bool DataManager::LoadFromFile(const std::string& filePath) {
@@ -46,48 +285,397 @@ bool DataManager::LoadFromFile(const std::string& filePath) {
     }
 }
 
-bool DataManager::ProcessData(const nlohmann::json& jsonData) {
-    bool anyManagerProcessed = false;
-    bool allProcessedSuccessfully = true;
+bool DataManager::LoadFromFileStreaming(const std::string& filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    return ProcessStream(file);
+}
 
+bool DataManager::ProcessStream(std::istream& input) {
+    try {
+        SectionRouter router(*this);
+        if (!nlohmann::json::sax_parse(input, &router)) {
+            return false;
+        }
+        return router.Succeeded();
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool DataManager::ProcessData(const nlohmann::json& jsonData) {
 	if (!jsonData.is_object()) {
 		return false;
 	}
 
+    std::vector<SectionLoad> sections;
 	for (auto jit = jsonData.begin(); jit != jsonData.end(); ++jit) {
         Hash::HashValue typeHash(jit.key().c_str(), static_cast<uint32_t>(jit.key().length()));
             
         auto it = m_managers.find(typeHash);
         if (it != m_managers.end()) {
-            anyManagerProcessed = true;
-            if (!it->second->CreateFromJson(jit.value())) {
-                allProcessedSuccessfully = false;
+            BaseManager* manager = it->second.get();
+            const nlohmann::json* sectionData = &jit.value();
+            sections.push_back({ manager, [manager, sectionData]() { return manager->CreateFromJson(*sectionData); } });
+        }
+    }
+
+    const bool anyManagerProcessed = !sections.empty();
+    return LoadSections(sections) && anyManagerProcessed;
+}
+
+void DataManager::SetLoadThreadCount(size_t threadCount) {
+    if (threadCount != m_loadThreadCount) {
+        m_loadThreadCount = threadCount;
+        m_loadPool.reset();
+    }
+}
+
+bool DataManager::LoadSections(const std::vector<SectionLoad>& sections) {
+    const size_t count = sections.size();
+
+    // Build the dependency graph between the sections being loaded
+    FlatHashMap<Hash::HashValue, size_t> indexByType;
+    for (size_t i = 0; i < count; ++i) {
+        indexByType[sections[i].manager->GetManagedType()] = i;
+    }
+    std::vector<std::vector<size_t>> dependents(count);
+    std::vector<size_t> unmetDependencies(count, 0);
+    for (size_t i = 0; i < count; ++i) {
+        for (const Hash::HashValue& dependency : sections[i].manager->GetDependencies()) {
+            auto it = indexByType.find(dependency);
+            if (it != indexByType.end() && it->second != i) {
+                dependents[it->second].push_back(i);
+                ++unmetDependencies[i];
+            }
+        }
+    }
+
+    // Reject cycles before loading anything
+    {
+        std::vector<size_t> remaining = unmetDependencies;
+        std::vector<size_t> ready;
+        for (size_t i = 0; i < count; ++i) {
+            if (remaining[i] == 0) {
+                ready.push_back(i);
+            }
+        }
+        size_t visited = 0;
+        while (!ready.empty()) {
+            const size_t i = ready.back();
+            ready.pop_back();
+            ++visited;
+            for (size_t dependent : dependents[i]) {
+                if (--remaining[dependent] == 0) {
+                    ready.push_back(dependent);
+                }
+            }
+        }
+        if (visited != count) {
+            return false;
+        }
+    }
+
+    m_sectionTimings.assign(count, SectionTiming());
+    auto loadSection = [this, &sections](size_t i) {
+        SectionTiming& timing = m_sectionTimings[i];
+        timing.type = sections[i].manager->GetManagedType();
+        timing.name = std::string(GetString(timing.type));
+
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            timing.succeeded = sections[i].load();
+        }
+        catch (...) {
+            timing.succeeded = false;
+        }
+        // Even a failed load may have changed the manager's state
+        sections[i].manager->MarkDirty();
+        timing.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    const size_t threadCount = m_loadThreadCount > 0 ? m_loadThreadCount : ThreadPool::GetDefaultThreadCount();
+    if (threadCount <= 1 || count <= 1) {
+        // Sequential: always pick the first ready section in data order
+        std::set<size_t> ready;
+        for (size_t i = 0; i < count; ++i) {
+            if (unmetDependencies[i] == 0) {
+                ready.insert(i);
+            }
+        }
+        while (!ready.empty()) {
+            const size_t i = *ready.begin();
+            ready.erase(ready.begin());
+            loadSection(i);
+            for (size_t dependent : dependents[i]) {
+                if (--unmetDependencies[dependent] == 0) {
+                    ready.insert(dependent);
+                }
+            }
+        }
+    }
+    else {
+        if (!m_loadPool) {
+            m_loadPool = std::make_unique<ThreadPool>(threadCount);
+        }
+
+        // The graph is only touched on this thread; workers just report finished sections
+        std::mutex finishedMutex;
+        std::condition_variable finishedCondition;
+        std::vector<size_t> finished;
+        std::set<size_t> mainThreadReady;
+
+        auto dispatch = [&](size_t i) {
+            if (sections[i].manager->RequiresMainThread()) {
+                mainThreadReady.insert(i);
+                return;
+            }
+            m_loadPool->Submit([&, i]() {
+                try {
+                    loadSection(i);
+                }
+                catch (...) {
+                    m_sectionTimings[i].succeeded = false;
+                }
+                // Always reported, or the loop below would wait for the section forever
+                {
+                    std::lock_guard<std::mutex> lock(finishedMutex);
+                    finished.push_back(i);
+                }
+                finishedCondition.notify_one();
+            });
+        };
+
+        for (size_t i = 0; i < count; ++i) {
+            if (unmetDependencies[i] == 0) {
+                dispatch(i);
+            }
+        }
+
+        size_t done = 0;
+        std::vector<size_t> completed;
+        while (done < count) {
+            completed.clear();
+            if (!mainThreadReady.empty()) {
+                const size_t i = *mainThreadReady.begin();
+                mainThreadReady.erase(mainThreadReady.begin());
+                loadSection(i);
+                completed.push_back(i);
+            }
+            {
+                std::unique_lock<std::mutex> lock(finishedMutex);
+                if (completed.empty()) {
+                    finishedCondition.wait(lock, [&finished]() { return !finished.empty(); });
+                }
+                completed.insert(completed.end(), finished.begin(), finished.end());
+                finished.clear();
+            }
+
+            for (size_t i : completed) {
+                ++done;
+                for (size_t dependent : dependents[i]) {
+                    if (--unmetDependencies[dependent] == 0) {
+                        dispatch(dependent);
+                    }
+                }
             }
         }
     }
 
-    return anyManagerProcessed && allProcessedSuccessfully;
+    for (const SectionTiming& timing : m_sectionTimings) {
+        if (!timing.succeeded) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DataManager::LoadFromBakedFile(const std::string& filePath, const std::string& sourcePath) {
+    BakedFile bakedFile;
+    if (!bakedFile.Open(filePath)) {
+        return false;
+    }
+
+    // A source file that is missing, as in a shipped build, does not make the bake stale
+    Hash::HashValue64 sourceHash;
+    if (!sourcePath.empty() && Hash::HashFile(sourcePath, sourceHash) && sourceHash != bakedFile.GetSourceHash()) {
+        std::cerr << "Baked file " << filePath << " is stale: " << sourcePath << " changed since it was baked\n";
+        return false;
+    }
+    return ProcessBaked(bakedFile);
+}
+
+bool DataManager::ProcessBaked(const BakedFile& bakedFile) {
+    // Strings are pre-hashed; register them without hashing again
+    std::unique_lock<std::shared_mutex> stringLock(m_stringMutex);
+    m_stringPool.Reserve(bakedFile.GetStringCount(), bakedFile.GetStringDataSize());
+    for (size_t i = 0; i < bakedFile.GetStringCount(); ++i) {
+        Hash::HashValue hash;
+        std::string_view str = bakedFile.GetString(i, hash);
+        if (m_stringPool.Intern(hash, str) == StringPool::InternResult::Collision) {
+            std::cerr << "String hash collision in baked file: \"" << str << "\" and \"" << m_stringPool.Find(hash) << "\"\n";
+        }
+    }
+    stringLock.unlock();
+
+    std::vector<SectionLoad> sections;
+    for (size_t i = 0; i < bakedFile.GetSectionCount(); ++i) {
+        BakedSection section = bakedFile.GetSection(i);
+        auto it = m_managers.find(section.GetType());
+        if (it != m_managers.end()) {
+            BaseManager* manager = it->second.get();
+            sections.push_back({ manager, [manager, section]() { return manager->CreateFromBaked(section); } });
+        }
+    }
+
+    const bool anyManagerProcessed = !sections.empty();
+    return LoadSections(sections) && anyManagerProcessed;
+}
+
+bool DataManager::BakeJson(const nlohmann::json& jsonData, BakedWriter& writer) const {
+    if (!jsonData.is_object()) {
+        return false;
+    }
+
+    bool anyManagerBaked = false;
+    for (auto jit = jsonData.begin(); jit != jsonData.end(); ++jit) {
+        Hash::HashValue typeHash(jit.key().c_str(), static_cast<uint32_t>(jit.key().length()));
+
+        auto it = m_managers.find(typeHash);
+        if (it == m_managers.end()) {
+            continue;
+        }
+
+        writer.AddString(jit.key());
+        BakedSectionWriter& section = writer.AddSection(typeHash);
+        if (!it->second->BakeJson(jit.value(), section)) {
+            return false;
+        }
+        anyManagerBaked = true;
+    }
+
+    // A record naming either string of a collision could not be resolved when loading
+    return anyManagerBaked && writer.GetCollisionCount() == 0;
+}
+
+bool DataManager::BakeToFile(const nlohmann::json& jsonData, const std::string& filePath, Hash::HashValue64 sourceHash) {
+    try {
+        BakedWriter writer;
+        writer.SetSourceHash(sourceHash);
+        if (!BakeJson(jsonData, writer)) {
+            return false;
+        }
+
+        std::filesystem::path directory = std::filesystem::path(filePath).parent_path();
+        if (!directory.empty() && !std::filesystem::exists(directory)) {
+            std::filesystem::create_directories(directory);
+        }
+        return writer.WriteToFile(filePath);
+    }
+    catch (const std::exception&) {
+        return false;
+    }
 }
 
 bool DataManager::SaveToFile(const std::string& filePath)
 {
-	try {
-		// Create a top-level JSON object
-		nlohmann::json rootJson = nlohmann::json::object();
+	Snapshot snapshot = TakeSnapshot();
+	return WriteSnapshot(snapshot, filePath);
+}
 
-		// Iterate through all managers
-		for (const auto& [type, manager] : m_managers)
-		{
-			// Serialize the manager to JSON
-			nlohmann::json managerData = manager->SerializeToJson();
-			if (!managerData.empty())
-			{
-				// Use the type name (e.g. "sprites", "images") as a key in the root object
-				const std::string typeName = GetString(type);
-				rootJson[typeName] = managerData;
-			}
+DataManager::Snapshot DataManager::TakeSnapshot()
+{
+	Snapshot snapshot;
+	snapshot.sections.reserve(m_managers.size());
+
+	std::lock_guard<std::mutex> lock(m_savedSectionsMutex);
+	for (const auto& [type, manager] : m_managers)
+	{
+		Snapshot::Section section;
+		section.type = type;
+		// Use the type name (e.g. "sprites", "images") as a key in the root object
+		section.name = std::string(GetString(type));
+		section.tracked = manager->TracksChanges();
+		section.generation = manager->GetGeneration();
+
+		auto saved = m_savedSections.find(type);
+		if (section.tracked && saved != m_savedSections.end() && saved->second.generation == section.generation) {
+			section.text = saved->second.text;
+		}
+		else {
+			section.state = manager->CreateSnapshot();
+		}
+		snapshot.sections.push_back(std::move(section));
+	}
+	return snapshot;
+}
+
+void DataManager::SerializeSections(Snapshot& snapshot)
+{
+	// One buffer for all sections; each section's text is copied out of it
+	JsonWriter writer(ManagerSnapshot::SAVE_INDENT);
+	for (Snapshot::Section& section : snapshot.sections)
+	{
+		if (section.text) {
+			continue;
 		}
 
+		// Pretty-printed as if nested one level deep in the root object
+		writer.Reset(ManagerSnapshot::SAVE_LEVEL);
+		section.state->WriteJson(writer);
+		section.text = std::make_shared<const std::string>(writer.IsEmptyValue() ? std::string() : writer.GetBuffer());
+	}
+}
+
+void DataManager::StoreSavedSections(const Snapshot& snapshot)
+{
+	std::lock_guard<std::mutex> lock(m_savedSectionsMutex);
+	for (const Snapshot::Section& section : snapshot.sections)
+	{
+		if (!section.tracked || !section.state) {
+			continue;
+		}
+		// An older snapshot finishing late must not replace newer text
+		SavedSection& saved = m_savedSections[section.type];
+		if (!saved.text || saved.generation < section.generation) {
+			saved.generation = section.generation;
+			saved.text = section.text;
+		}
+	}
+}
+
+namespace {
+
+// Writes sections as a pretty-printed JSON object, keys sorted like nlohmann::json
+void WriteSections(std::ostream& output, std::vector<const DataManager::Snapshot::Section*> sections)
+{
+	std::sort(sections.begin(), sections.end(), [](const auto* a, const auto* b) { return a->name < b->name; });
+
+	bool first = true;
+	output << '{';
+	for (const auto* section : sections)
+	{
+		if (section->text->empty()) {
+			continue;
+		}
+		std::string key;
+		JsonWriter::AppendString(key, section->name);
+		output << (first ? "\n    " : ",\n    ") << key << ": " << *section->text;
+		first = false;
+	}
+	output << (first ? "}" : "\n}");
+}
+
+} // namespace
+
+bool DataManager::WriteSnapshot(Snapshot& snapshot, const std::string& filePath)
+{
+	try {
+		SerializeSections(snapshot);
+
 		// Ensure the directory exists
 		std::filesystem::path pathObj(filePath);
 		std::filesystem::path directory = pathObj.parent_path();
@@ -96,14 +684,85 @@ bool DataManager::SaveToFile(const std::string& filePath)
 			std::filesystem::create_directories(directory);
 		}
 
-		// Write the completed JSON to file
-		std::ofstream file(filePath);
+		// Write next to the target, then replace it, so readers never see a partial file
+		const std::string tempPath = filePath + ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::binary);
+			if (!file.is_open()) {
+				return false;
+			}
+			std::vector<const Snapshot::Section*> sections;
+			for (const Snapshot::Section& section : snapshot.sections) {
+				sections.push_back(&section);
+			}
+			WriteSections(file, std::move(sections));
+			file.close();
+			if (!file) {
+				std::filesystem::remove(tempPath);
+				return false;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, pathObj, error);
+		if (error) {
+			std::filesystem::remove(tempPath, error);
+			return false;
+		}
+
+		StoreSavedSections(snapshot);
+		return true;
+	}
+	catch (const std::exception&) {
+		return false;
+	}
+}
+
+bool DataManager::AppendDelta(Snapshot& snapshot, const std::string& deltaPath)
+{
+	try {
+		SerializeSections(snapshot);
+
+		std::vector<const Snapshot::Section*> changed;
+		for (const Snapshot::Section& section : snapshot.sections) {
+			if (section.state) {
+				changed.push_back(&section);
+			}
+		}
+		if (changed.empty()) {
+			return true;
+		}
+
+		std::filesystem::path directory = std::filesystem::path(deltaPath).parent_path();
+		if (!directory.empty() && !std::filesystem::exists(directory)) {
+			std::filesystem::create_directories(directory);
+		}
+
+		// After a record cut short by a crash, start on a new line so loading can skip it
+		bool newLine = false;
+		{
+			std::ifstream existing(deltaPath, std::ios::binary | std::ios::ate);
+			if (existing.is_open() && existing.tellg() > 0) {
+				existing.seekg(-1, std::ios::end);
+				newLine = existing.get() != '\n';
+			}
+		}
+
+		std::ofstream file(deltaPath, std::ios::binary | std::ios::app);
 		if (!file.is_open()) {
 			return false;
 		}
-		file << rootJson.dump(4); // Pretty-print with 4 spaces
+		if (newLine) {
+			file << '\n';
+		}
+		WriteSections(file, std::move(changed));
+		file << '\n';
 		file.close();
+		if (!file) {
+			return false;
+		}
 
+		StoreSavedSections(snapshot);
 		return true;
 	}
 	catch (const std::exception&) {
@@ -111,6 +770,48 @@ bool DataManager::SaveToFile(const std::string& filePath)
 	}
 }
 
+bool DataManager::LoadFromFileWithDelta(const std::string& filePath, const std::string& deltaPath)
+{
+	try {
+		nlohmann::json jsonData = nlohmann::json::object();
+		std::ifstream file(filePath);
+		const bool hasBase = file.is_open();
+		if (hasBase) {
+			file >> jsonData;
+		}
+
+		std::ifstream delta(deltaPath, std::ios::binary);
+		if (!hasBase && !delta.is_open()) {
+			return false;
+		}
+		const std::string text((std::istreambuf_iterator<char>(delta)), std::istreambuf_iterator<char>());
+
+		// Every record starts with a '{' at the start of a line, and no other line does, so a
+		// damaged record only loses itself and the records after it are still applied
+		for (size_t start = 0; start < text.size();) {
+			size_t end = text.find("\n{", start);
+			end = end == std::string::npos ? text.size() : end + 1;
+			if (text.find_first_not_of(" \t\r\n", start) < end) {
+				nlohmann::json record = nlohmann::json::parse(text.begin() + start, text.begin() + end, nullptr, false);
+				if (record.is_object()) {
+					for (auto it = record.begin(); it != record.end(); ++it) {
+						jsonData[it.key()] = std::move(it.value());
+					}
+				}
+				else {
+					std::cerr << "Skipping damaged record in " << deltaPath << " at byte " << start << std::endl;
+				}
+			}
+			start = end;
+		}
+
+		return ProcessData(jsonData);
+	}
+	catch (const std::exception&) {
+		return false;
+	}
+}
+
 BaseManager* DataManager::GetManager(const Core::Hash::HashValue& type) {
     auto it = m_managers.find(type);
     if (it != m_managers.end()) {
@@ -119,5 +820,11 @@ BaseManager* DataManager::GetManager(const Core::Hash::HashValue& type) {
     return nullptr;
 }
 
+void DataManager::ClearManagers() {
+    for (auto& [type, manager] : m_managers) {
+        manager->Clear();
+    }
+}
+
 } // namespace Core
 } // namespace ShoeEngine
@@ -1,16 +1,27 @@
 #pragma once
 
 #include "BaseManager.h"
+#include "BakedData.h"
+#include "FlatHashMap.h"
 #include "Hash.h"
+#include "StringPool.h"
 #include <nlohmann/json.hpp>
+#include <cstdint>
+#include <functional>
+#include <istream>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
 
 namespace ShoeEngine {
 namespace Core {
 
+class ThreadPool;
+
 /**
  * @class DataManager
  * @brief Central manager for loading and distributing JSON data to type-specific managers
@@ -18,9 +29,51 @@ namespace Core {
  * This class is responsible for reading JSON data files and distributing the data
  * to the appropriate managers based on object types. It also maintains a registry
  * of strings used by managers for serialization.
+ *
+ * Sections are loaded in dependency order: a manager listing other types in
+ * GetDependencies() is only run once the sections of those types have finished. Sections
+ * that do not depend on each other are loaded concurrently on a thread pool, except for
+ * managers that require the main thread, which run on the calling thread. The string
+ * registry is safe to use from the loading threads.
  */
 class DataManager {
 public:
+    /**
+     * @struct SectionTiming
+     * @brief Wall time spent loading one section
+     */
+    struct SectionTiming {
+        Hash::HashValue type;       ///< Type of the section
+        std::string name;           ///< Name of the section
+        double milliseconds = 0.0;  ///< Time spent in the manager
+        bool succeeded = false;     ///< Whether the manager reported success
+    };
+
+    /**
+     * @struct Snapshot
+     * @brief Copies of the managers' states, taken by TakeSnapshot
+     */
+    struct Snapshot {
+        /**
+         * @struct Section
+         * @brief State of one manager
+         *
+         * Holds either the manager's snapshot or, for a manager unchanged since its section
+         * was last saved, the saved text. WriteSnapshot and AppendDelta serialize snapshots
+         * into text as they go.
+         */
+        struct Section {
+            Hash::HashValue type;                    ///< Type of the manager
+            std::string name;                        ///< Type name, the key of the section
+            uint64_t generation = 0;                 ///< Manager generation at the time of the snapshot
+            bool tracked = false;                    ///< Whether the manager tracks changes
+            std::unique_ptr<ManagerSnapshot> state;  ///< Copied state; null if text came from the cache
+            std::shared_ptr<const std::string> text; ///< Serialized section; empty if the section is not saved
+        };
+
+        std::vector<Section> sections; ///< One section per manager
+    };
+
     /**
      * @brief Constructor
      */
@@ -48,10 +101,89 @@ public:
     /**
      * @brief Process JSON data directly
      * @param jsonData The JSON data to process
-     * @return bool True if processing was successful
+     * @return bool True if processing was successful; false if the dependencies form a cycle
      */
     bool ProcessData(const nlohmann::json& jsonData);
 
+    /**
+     * @brief Sets how many threads load independent sections in ProcessData and ProcessBaked
+     * @param threadCount Number of threads; 0 (the default) uses the number of hardware threads, 1 loads sequentially
+     */
+    void SetLoadThreadCount(size_t threadCount);
+
+    /**
+     * @brief Gets the configured number of section loading threads
+     * @return Thread count; 0 means hardware threads
+     */
+    size_t GetLoadThreadCount() const { return m_loadThreadCount; }
+
+    /**
+     * @brief Gets the wall time of each section of the last ProcessData or ProcessBaked call
+     * @return One entry per loaded section, in data order
+     */
+    const std::vector<SectionTiming>& GetSectionTimings() const { return m_sectionTimings; }
+
+    /**
+     * @brief Load and process a JSON file without building a tree of the whole file
+     * @param filePath Path to the JSON file
+     * @return bool True if loading and processing was successful
+     * @see ProcessStream
+     */
+    bool LoadFromFileStreaming(const std::string& filePath);
+
+    /**
+     * @brief Parse JSON from a stream, routing each top-level section to its manager as it is parsed
+     * @param input Stream containing a JSON object
+     * @return bool True if the stream parsed, at least one section had a manager and every section succeeded
+     *
+     * Sections of managers that opt in through CreateFromStream are handed over event by event.
+     * Other registered sections are collected into a JSON tree of that section only and passed
+     * to CreateFromJson. Sections without a manager are skipped without being stored.
+     *
+     * Unlike ProcessData, sections are processed in file order rather than sorted by key, and
+     * sections processed before a syntax error keep their changes.
+     */
+    bool ProcessStream(std::istream& input);
+
+    /**
+     * @brief Load and process a baked data file without parsing JSON
+     * @param filePath Path to the baked file, created by BakeToFile
+     * @param sourcePath JSON file the baked file was made from; if it exists and its content
+     *                   hash differs from the one stored when baking, the baked file is stale
+     *                   and nothing is loaded. Empty to skip the check.
+     * @return bool True if loading and processing was successful
+     *
+     * The file is memory-mapped. Its string table is added to the string registry, and
+     * every section with a registered manager is passed to that manager's CreateFromBaked.
+     */
+    bool LoadFromBakedFile(const std::string& filePath, const std::string& sourcePath = std::string());
+
+    /**
+     * @brief Process an opened baked file
+     * @param bakedFile The baked file
+     * @return bool True if processing was successful
+     */
+    bool ProcessBaked(const BakedFile& bakedFile);
+
+    /**
+     * @brief Bake JSON data into a binary file using the registered managers
+     * @param jsonData The JSON data, as passed to ProcessData
+     * @param filePath Path of the baked file to write
+     * @param sourceHash Hash::HashFile of the JSON file the data was read from, checked by
+     *                   LoadFromBakedFile; leave empty if the data has no source file
+     * @return bool True if every section with a registered manager was baked and the file was written
+     */
+    bool BakeToFile(const nlohmann::json& jsonData, const std::string& filePath,
+        Hash::HashValue64 sourceHash = Hash::HashValue64());
+
+    /**
+     * @brief Bake JSON data into a baked file writer using the registered managers
+     * @param jsonData The JSON data, as passed to ProcessData
+     * @param writer Receives one section per registered manager
+     * @return bool True if every section with a registered manager was baked
+     */
+    bool BakeJson(const nlohmann::json& jsonData, BakedWriter& writer) const;
+
     /**
      * @brief Save all managed objects to a JSON file
      * @param filePath Path to save the JSON file
@@ -59,6 +191,52 @@ public:
      */
     bool SaveToFile(const std::string& filePath);
 
+    /**
+     * @brief Copy the state of all managers for saving later
+     * @return Snapshot; serialize and write it with WriteSnapshot, from any thread
+     *
+     * Managers that track changes and whose generation has not changed since their section
+     * was last saved are not copied; their section reuses the saved text.
+     */
+    Snapshot TakeSnapshot();
+
+    /**
+     * @brief Serialize a snapshot and write it to a JSON file
+     * @param snapshot The snapshot to write; its sections are serialized in place
+     * @param filePath Path of the JSON file
+     * @return bool True if the file was written
+     *
+     * The JSON is written to filePath + ".tmp", which is then renamed over filePath, so a
+     * crash during the write leaves the previous file intact. Safe to call from another
+     * thread while the calling thread keeps taking snapshots.
+     */
+    bool WriteSnapshot(Snapshot& snapshot, const std::string& filePath);
+
+    /**
+     * @brief Append the sections that changed since the last save to a delta file
+     * @param snapshot The snapshot to save; its sections are serialized in place
+     * @param deltaPath Path of the delta file, created if missing
+     * @return bool True if the changes were appended
+     *
+     * Only sections not taken from the saved text are appended, as one JSON object per save,
+     * so a save of a mostly unchanged world writes only what changed. Load the result with
+     * LoadFromFileWithDelta, and fold the delta into the base file with WriteSnapshot
+     * followed by deleting the delta file.
+     */
+    bool AppendDelta(Snapshot& snapshot, const std::string& deltaPath);
+
+    /**
+     * @brief Load a JSON file with the changes of a delta file applied
+     * @param filePath Path of the base JSON file; may be missing if the delta file exists
+     * @param deltaPath Path of the delta file written by AppendDelta; may be missing
+     * @return bool True if loading and processing was successful
+     *
+     * Each section of the delta replaces the section of the same name, in append order. A
+     * record left incomplete by a crash during AppendDelta, or otherwise damaged, is skipped;
+     * the records appended after it still apply.
+     */
+    bool LoadFromFileWithDelta(const std::string& filePath, const std::string& deltaPath);
+
     /**
      * @brief Get a registered manager by its type
      * @param type The type of manager to retrieve
@@ -66,23 +244,80 @@ public:
      */
     BaseManager* GetManager(const Core::Hash::HashValue& type);
 
+    /**
+     * @brief Calls Clear on every registered manager
+     *
+     * Undoes a load that failed part way, e.g. before falling back from a baked file to JSON.
+     */
+    void ClearManagers();
+
     /**
      * @brief Register a string with the DataManager and get its hash
-     * @param str The string to register
+     * @param str The string to register; safe to call from several threads
      * @return HashValue The hash of the registered string
+     *
+     * Registering a string that is already registered does not copy it again. If a
+     * different string is already registered under the same hash, the collision is
+     * reported on std::cerr and counted, and the first string is kept.
      */
-    Hash::HashValue RegisterString(const std::string& str);
+    Hash::HashValue RegisterString(std::string_view str);
 
     /**
      * @brief Get the original string for a hash value
      * @param hash The hash value to look up
-     * @return const std::string& The original string, or empty string if not found
+     * @return std::string_view The original string, or an empty view if not found; valid for the lifetime of the DataManager
      */
-    const std::string& GetString(const Hash::HashValue& hash) const;
+    std::string_view GetString(const Hash::HashValue& hash) const;
+
+    /**
+     * @brief Prepare the string registry for a bulk load
+     * @param stringCount Number of strings about to be registered
+     * @param byteCount Total length of those strings
+     */
+    void ReserveStrings(size_t stringCount, size_t byteCount);
+
+    /**
+     * @brief Get the number of hash collisions detected by RegisterString
+     * @return Collision count
+     */
+    size_t GetStringCollisionCount() const;
 
 private:
-    std::unordered_map<Hash::HashValue, std::unique_ptr<BaseManager>, Hash::Hasher> m_managers;
-    std::unordered_map<Hash::HashValue, std::string, Hash::Hasher> m_stringRegistry;
+    struct SectionLoad {
+        BaseManager* manager;       ///< Manager of the section
+        std::function<bool()> load; ///< Passes the section's data to the manager
+    };
+
+    /**
+     * @brief Runs section loads in dependency order, concurrently where possible
+     * @param sections The sections to load, in data order
+     * @return bool True if every section succeeded; false if any failed or the dependencies form a cycle
+     */
+    bool LoadSections(const std::vector<SectionLoad>& sections);
+
+    struct SavedSection {
+        uint64_t generation = 0;                 ///< Manager generation the text was saved at
+        std::shared_ptr<const std::string> text; ///< Serialized section
+    };
+
+    /**
+     * @brief Serializes the sections of a snapshot that only hold copied state
+     */
+    static void SerializeSections(Snapshot& snapshot);
+
+    /**
+     * @brief Remembers the text of tracked sections after a successful save
+     */
+    void StoreSavedSections(const Snapshot& snapshot);
+
+    FlatHashMap<Hash::HashValue, std::unique_ptr<BaseManager>> m_managers;
+    FlatHashMap<Hash::HashValue, SavedSection> m_savedSections; ///< Last saved text of tracked managers
+    std::mutex m_savedSectionsMutex;                             ///< Guards m_savedSections while a save runs on another thread
+    StringPool m_stringPool;
+    mutable std::shared_mutex m_stringMutex; ///< Guards m_stringPool while sections load in parallel
+    size_t m_loadThreadCount = 0;            ///< 0 = hardware threads
+    std::unique_ptr<ThreadPool> m_loadPool;  ///< Created on first parallel load
+    std::vector<SectionTiming> m_sectionTimings;
 };
 
 } // namespace Core
@@ -0,0 +1,439 @@
+#pragma once
+
+#include "Hash.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @class FlatHashMap
+ * @brief Open-addressing hash map with Robin Hood probing, for keys that are already hashes
+ *
+ * Entries are stored in one contiguous array of key/value pairs, with a parallel array of
+ * probe distances. Lookups never allocate or chase pointers: they probe forward from the
+ * key's home bucket and stop as soon as they meet an entry closer to its own home than
+ * the key would be.
+ *
+ * Keys such as Hash::HashValue are already well-distributed hashes, so the Hasher only
+ * extracts them and a single Fibonacci multiply picks the bucket. The table never wraps
+ * around: it keeps log2(bucket count) overflow slots after the last bucket and grows
+ * when a probe would run past them. The Hasher must give distinct keys distinct hashes;
+ * many keys sharing one hash would keep the table growing.
+ *
+ * The interface follows std::unordered_map so it can replace it directly. Unlike
+ * std::unordered_map, any insertion may move entries, which invalidates iterators,
+ * references and pointers to entries. Erasing invalidates iterators and references to
+ * the erased entry and to entries after it. erase(iterator) returns an iterator that
+ * continues the iteration correctly. Keys must not be modified through an iterator.
+ *
+ * @tparam Key Key type, e.g. Hash::HashValue
+ * @tparam Value Mapped type
+ * @tparam Hasher Functor returning the hash of a key
+ */
+template<typename Key, typename Value, typename Hasher = Hash::Hasher>
+class FlatHashMap {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = size_t;
+
+private:
+    static constexpr int8_t EMPTY = -1;
+    static constexpr size_t MIN_BUCKETS = 8;
+    static constexpr float MAX_LOAD_FACTOR = 0.8f;
+
+    template<bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        Iterator() = default;
+
+        operator Iterator<true>() const { return Iterator<true>(m_slot, m_distance); }
+
+        reference operator*() const { return *m_slot; }
+        pointer operator->() const { return m_slot; }
+
+        Iterator& operator++() {
+            do {
+                ++m_slot;
+                ++m_distance;
+            } while (*m_distance == EMPTY);
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator& rhs) const { return m_slot == rhs.m_slot; }
+        bool operator!=(const Iterator& rhs) const { return m_slot != rhs.m_slot; }
+
+    private:
+        friend class FlatHashMap;
+        template<bool> friend class Iterator;
+
+        Iterator(pointer slot, const int8_t* distance) : m_slot(slot), m_distance(distance) {}
+
+        pointer m_slot = nullptr;
+        const int8_t* m_distance = nullptr;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() = default;
+
+    FlatHashMap(const FlatHashMap& other) {
+        reserve(other.size());
+        for (const value_type& entry : other) {
+            InsertUnique(value_type(entry));
+        }
+    }
+
+    FlatHashMap(FlatHashMap&& other) noexcept {
+        Swap(other);
+    }
+
+    FlatHashMap& operator=(const FlatHashMap& other) {
+        if (this != &other) {
+            FlatHashMap copy(other);
+            Swap(copy);
+        }
+        return *this;
+    }
+
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept {
+        if (this != &other) {
+            FlatHashMap moved(std::move(other));
+            Swap(moved);
+        }
+        return *this;
+    }
+
+    ~FlatHashMap() {
+        clear();
+        Deallocate();
+    }
+
+    iterator begin() { return IteratorAt(0); }
+    iterator end() { return iterator(m_slots + SlotCount(), m_distances + SlotCount()); }
+    const_iterator begin() const { return const_cast<FlatHashMap*>(this)->begin(); }
+    const_iterator end() const { return const_cast<FlatHashMap*>(this)->end(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief Gets the number of buckets, not counting the overflow slots
+     * @return Bucket count
+     */
+    size_t bucket_count() const { return m_bucketCount; }
+
+    /**
+     * @brief Gets the ratio of entries to buckets
+     * @return Load factor
+     */
+    float load_factor() const { return m_bucketCount ? static_cast<float>(m_size) / m_bucketCount : 0.0f; }
+
+    /**
+     * @brief Makes room for a number of entries so inserting them does not rehash
+     * @param count Total number of entries the map will hold
+     */
+    void reserve(size_t count) {
+        size_t buckets = MIN_BUCKETS;
+        while (buckets * MAX_LOAD_FACTOR < count) {
+            buckets *= 2;
+        }
+        if (buckets > m_bucketCount) {
+            Rehash(buckets);
+        }
+    }
+
+    /**
+     * @brief Removes all entries, keeping the allocated table
+     */
+    void clear() {
+        for (size_t i = 0; i < SlotCount(); ++i) {
+            if (m_distances[i] != EMPTY) {
+                m_slots[i].~value_type();
+                m_distances[i] = EMPTY;
+            }
+        }
+        m_size = 0;
+    }
+
+    iterator find(const Key& key) {
+        const size_t index = FindIndex(key);
+        return index == NOT_FOUND ? end() : iterator(m_slots + index, m_distances + index);
+    }
+
+    const_iterator find(const Key& key) const {
+        return const_cast<FlatHashMap*>(this)->find(key);
+    }
+
+    bool contains(const Key& key) const { return FindIndex(key) != NOT_FOUND; }
+    size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    Value& at(const Key& key) {
+        const size_t index = FindIndex(key);
+        if (index == NOT_FOUND) {
+            throw std::out_of_range("FlatHashMap::at: key not found");
+        }
+        return m_slots[index].second;
+    }
+
+    const Value& at(const Key& key) const {
+        return const_cast<FlatHashMap*>(this)->at(key);
+    }
+
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @brief Inserts a value constructed from args if the key is not present
+     * @return Iterator to the entry and whether it was inserted
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        const size_t existing = FindIndex(key);
+        if (existing != NOT_FOUND) {
+            return { iterator(m_slots + existing, m_distances + existing), false };
+        }
+        // Build the entry before growing: key or args may refer into the slots Rehash frees
+        value_type entry(std::piecewise_construct,
+            std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        if (m_size + 1 > m_bucketCount * MAX_LOAD_FACTOR) {
+            Rehash(std::max(m_bucketCount * 2, MIN_BUCKETS));
+        }
+        const size_t index = InsertUnique(std::move(entry));
+        return { iterator(m_slots + index, m_distances + index), true };
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(const Key& key, Args&&... args) {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(value_type entry) {
+        return try_emplace(entry.first, std::move(entry.second));
+    }
+
+    template<typename V>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value) {
+        auto result = try_emplace(key, std::forward<V>(value));
+        if (!result.second) {
+            result.first->second = std::forward<V>(value);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Removes an entry
+     * @param position Entry to remove
+     * @return Iterator to the entry following the removed one in iteration order
+     */
+    iterator erase(const_iterator position) {
+        const size_t index = static_cast<size_t>(position.m_slot - m_slots);
+        EraseAt(index);
+        // Backward shifting may have moved a not yet visited entry into this slot
+        return IteratorAt(index);
+    }
+
+    iterator erase(iterator position) {
+        return erase(const_iterator(position));
+    }
+
+    size_t erase(const Key& key) {
+        const size_t index = FindIndex(key);
+        if (index == NOT_FOUND) {
+            return 0;
+        }
+        EraseAt(index);
+        return 1;
+    }
+
+private:
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    // Shared end marker of empty maps, so they need no allocation
+    static int8_t* EmptyDistances() {
+        static int8_t sentinel[1] = { 0 };
+        return sentinel;
+    }
+
+    size_t SlotCount() const { return m_bucketCount + m_maxDistance; }
+
+    size_t HomeBucket(const Key& key) const {
+        // Fibonacci hashing spreads the key over the high bits, which select the bucket
+        const uint64_t hash = static_cast<uint64_t>(Hasher()(key));
+        return static_cast<size_t>((hash * 11400714819323198485ull) >> m_shift);
+    }
+
+    size_t FindIndex(const Key& key) const {
+        if (m_size == 0) {
+            return NOT_FOUND;
+        }
+        size_t index = HomeBucket(key);
+        for (int8_t distance = 0; m_distances[index] >= distance; ++index, ++distance) {
+            if (m_slots[index].first == key) {
+                return index;
+            }
+        }
+        return NOT_FOUND;
+    }
+
+    iterator IteratorAt(size_t index) {
+        while (m_distances[index] == EMPTY) {
+            ++index;
+        }
+        return iterator(m_slots + index, m_distances + index);
+    }
+
+    /**
+     * @brief Inserts an entry whose key is known to be absent, growing if needed
+     * @return Index of the entry
+     */
+    size_t InsertUnique(value_type&& entry) {
+        if (m_bucketCount == 0) {
+            Rehash(MIN_BUCKETS);
+        }
+
+        const Key key = entry.first;
+        size_t index = HomeBucket(key);
+        int8_t distance = 0;
+        size_t result = NOT_FOUND;
+        value_type carried(std::move(entry));
+
+        for (;;) {
+            if (distance == m_maxDistance) {
+                // Probed past the overflow slots: grow, then place the carried entry again
+                Rehash(m_bucketCount * 2);
+                InsertUnique(std::move(carried));
+                return FindIndex(key);
+            }
+
+            if (m_distances[index] == EMPTY) {
+                ::new (static_cast<void*>(m_slots + index)) value_type(std::move(carried));
+                m_distances[index] = distance;
+                ++m_size;
+                return result == NOT_FOUND ? index : result;
+            }
+
+            if (m_distances[index] < distance) {
+                // Robin Hood: take the slot from the entry closer to its home
+                std::swap(carried, m_slots[index]);
+                std::swap(distance, m_distances[index]);
+                if (result == NOT_FOUND) {
+                    result = index;
+                }
+            }
+
+            ++index;
+            ++distance;
+        }
+    }
+
+    void EraseAt(size_t index) {
+        m_slots[index].~value_type();
+        m_distances[index] = EMPTY;
+        --m_size;
+
+        // Shift the following entries of the probe chain back by one
+        size_t next = index + 1;
+        while (m_distances[next] > 0) {
+            ::new (static_cast<void*>(m_slots + index)) value_type(std::move(m_slots[next]));
+            m_slots[next].~value_type();
+            m_distances[index] = static_cast<int8_t>(m_distances[next] - 1);
+            m_distances[next] = EMPTY;
+            index = next;
+            ++next;
+        }
+    }
+
+    void Rehash(size_t bucketCount) {
+        value_type* oldSlots = m_slots;
+        int8_t* oldDistances = m_distances;
+        const size_t oldSlotCount = SlotCount();
+        const size_t oldBucketCount = m_bucketCount;
+
+        int log2 = 0;
+        while ((size_t{ 1 } << log2) < bucketCount) {
+            ++log2;
+        }
+        m_bucketCount = size_t{ 1 } << log2;
+        m_shift = 64 - log2;
+        m_maxDistance = static_cast<int8_t>(std::max(log2, 4));
+
+        const size_t slotCount = SlotCount();
+        m_slots = std::allocator<value_type>().allocate(slotCount);
+        m_distances = new int8_t[slotCount + 1];
+        std::fill(m_distances, m_distances + slotCount, EMPTY);
+        m_distances[slotCount] = 0; // End marker stopping iteration
+        m_size = 0;
+
+        for (size_t i = 0; i < oldSlotCount; ++i) {
+            if (oldDistances[i] != EMPTY) {
+                InsertUnique(std::move(oldSlots[i]));
+                oldSlots[i].~value_type();
+            }
+        }
+
+        if (oldBucketCount > 0) {
+            std::allocator<value_type>().deallocate(oldSlots, oldSlotCount);
+            delete[] oldDistances;
+        }
+    }
+
+    void Deallocate() {
+        if (m_bucketCount > 0) {
+            std::allocator<value_type>().deallocate(m_slots, SlotCount());
+            delete[] m_distances;
+        }
+        m_slots = nullptr;
+        m_distances = EmptyDistances();
+        m_bucketCount = 0;
+        m_maxDistance = 0;
+        m_shift = 63;
+    }
+
+    void Swap(FlatHashMap& other) noexcept {
+        std::swap(m_slots, other.m_slots);
+        std::swap(m_distances, other.m_distances);
+        std::swap(m_size, other.m_size);
+        std::swap(m_bucketCount, other.m_bucketCount);
+        std::swap(m_maxDistance, other.m_maxDistance);
+        std::swap(m_shift, other.m_shift);
+    }
+
+    value_type* m_slots = nullptr;
+    int8_t* m_distances = EmptyDistances(); ///< Probe distance of each slot, EMPTY if free
+    size_t m_size = 0;
+    size_t m_bucketCount = 0;
+    int8_t m_maxDistance = 0; ///< Overflow slots after the last bucket; no probe goes further
+    int m_shift = 63;
+};
+
+} // namespace Core
+} // namespace ShoeEngine
@@ -0,0 +1,254 @@
+#include "Hash.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// Two SSE2 lanes only beat scalar code when the compiler has no native 64x64->128-bit
+// multiply and Multiply128 falls back to four 32-bit multiplies per key (e.g. MSVC)
+#if !defined(__SIZEOF_INT128__) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SHOE_HASH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace ShoeEngine {
+namespace Core {
+
+#if defined(SHOE_HASH_SSE2)
+namespace {
+
+// Multiply128 for two lanes at once, built from 32x32->64-bit multiplies
+inline void Multiply128x2(__m128i& a, __m128i& b)
+{
+    const __m128i low32 = _mm_set1_epi64x(0xffffffff);
+    const __m128i aHigh = _mm_srli_epi64(a, 32);
+    const __m128i bHigh = _mm_srli_epi64(b, 32);
+    const __m128i lowLow = _mm_mul_epu32(a, b);
+    const __m128i highLow = _mm_mul_epu32(aHigh, b);
+    const __m128i lowHigh = _mm_mul_epu32(a, bHigh);
+    const __m128i highHigh = _mm_mul_epu32(aHigh, bHigh);
+    const __m128i middle = _mm_add_epi64(_mm_add_epi64(_mm_srli_epi64(lowLow, 32), _mm_and_si128(highLow, low32)),
+        _mm_and_si128(lowHigh, low32));
+    a = _mm_or_si128(_mm_slli_epi64(middle, 32), _mm_and_si128(lowLow, low32));
+    b = _mm_add_epi64(_mm_add_epi64(highHigh, _mm_srli_epi64(highLow, 32)),
+        _mm_add_epi64(_mm_srli_epi64(lowHigh, 32), _mm_srli_epi64(middle, 32)));
+}
+
+} // namespace
+#endif
+
+void Hash::Hash64Batch(const std::string_view* keys, size_t count, uint64_t* hashes, uint64_t seed)
+{
+    size_t i = 0;
+
+#if defined(SHOE_HASH_SSE2)
+    // Seed mixing is the same for every key, so it is done once
+    const uint64_t mixedSeed = seed ^ Mix64(seed ^ HASH64_SECRET[0], HASH64_SECRET[1]);
+    const __m128i secret0 = _mm_set1_epi64x(static_cast<long long>(HASH64_SECRET[0]));
+    const __m128i secret1 = _mm_set1_epi64x(static_cast<long long>(HASH64_SECRET[1]));
+    const __m128i seeds = _mm_set1_epi64x(static_cast<long long>(mixedSeed));
+
+    for (; i + 1 < count; i += 2) {
+        const std::string_view first = keys[i];
+        const std::string_view second = keys[i + 1];
+        if (first.size() > 16 || second.size() > 16) {
+            hashes[i] = Hash64(first.data(), first.size(), seed);
+            hashes[i + 1] = Hash64(second.data(), second.size(), seed);
+            continue;
+        }
+
+        uint64_t a0, b0, a1, b1;
+        ReadShort64(first.data(), first.size(), a0, b0);
+        ReadShort64(second.data(), second.size(), a1, b1);
+
+        // Finish64 on both lanes
+        __m128i a = _mm_xor_si128(_mm_set_epi64x(static_cast<long long>(a1), static_cast<long long>(a0)), secret1);
+        __m128i b = _mm_xor_si128(_mm_set_epi64x(static_cast<long long>(b1), static_cast<long long>(b0)), seeds);
+        Multiply128x2(a, b);
+        const __m128i lengths = _mm_set_epi64x(static_cast<long long>(second.size()), static_cast<long long>(first.size()));
+        a = _mm_xor_si128(_mm_xor_si128(a, secret0), lengths);
+        b = _mm_xor_si128(b, secret1);
+        Multiply128x2(a, b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(hashes + i), _mm_xor_si128(a, b));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        hashes[i] = Hash64(keys[i].data(), keys[i].size(), seed);
+    }
+}
+
+void Hash::FNV1aStream::Update(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint32_t hash = m_hash;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 16777619;
+    }
+    m_hash = hash;
+}
+
+void Hash::MurmurHash3Stream::Init(uint32_t seed)
+{
+    m_hash = seed;
+    m_length = 0;
+    m_tailSize = 0;
+}
+
+void Hash::MurmurHash3Stream::Update(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    m_length += size;
+
+    // Complete a block left over from the previous update
+    if (m_tailSize > 0) {
+        const size_t count = std::min(size, 4 - m_tailSize);
+        std::memcpy(m_tail + m_tailSize, bytes, count);
+        m_tailSize += count;
+        bytes += count;
+        size -= count;
+        if (m_tailSize < 4) {
+            return;
+        }
+        uint32_t block;
+        std::memcpy(&block, m_tail, 4);
+        m_hash = MurmurMixBlock(m_hash, block);
+        m_tailSize = 0;
+    }
+
+    uint32_t hash = m_hash;
+    for (; size >= 4; bytes += 4, size -= 4) {
+        uint32_t block;
+        std::memcpy(&block, bytes, 4);
+        hash = MurmurMixBlock(hash, block);
+    }
+    m_hash = hash;
+
+    std::memcpy(m_tail, bytes, size);
+    m_tailSize = size;
+}
+
+uint32_t Hash::MurmurHash3Stream::Finalize() const
+{
+    const uint32_t hash = MurmurMixTail(m_hash, m_tail, static_cast<uint32_t>(m_tailSize));
+    return MurmurFinalize(hash, static_cast<uint32_t>(m_length));
+}
+
+void Hash::Hash64Stream::Init(uint64_t seed)
+{
+    m_seed = seed ^ Mix64(seed ^ HASH64_SECRET[0], HASH64_SECRET[1]);
+    m_seed1 = m_seed;
+    m_seed2 = m_seed;
+    m_length = 0;
+    m_pendingSize = 0;
+}
+
+void Hash::Hash64Stream::ProcessBlocks(const char* blocks, size_t count)
+{
+    // Locals, since stores through the char input could otherwise alias the members
+    uint64_t seed = m_seed;
+    uint64_t seed1 = m_seed1;
+    uint64_t seed2 = m_seed2;
+    for (size_t i = 0; i < count; ++i, blocks += BLOCK_SIZE) {
+        seed = Mix64(Read64(blocks) ^ HASH64_SECRET[1], Read64(blocks + 8) ^ seed);
+        seed1 = Mix64(Read64(blocks + 16) ^ HASH64_SECRET[2], Read64(blocks + 24) ^ seed1);
+        seed2 = Mix64(Read64(blocks + 32) ^ HASH64_SECRET[3], Read64(blocks + 40) ^ seed2);
+    }
+    m_seed = seed;
+    m_seed1 = seed1;
+    m_seed2 = seed2;
+}
+
+void Hash::Hash64Stream::Update(const void* data, size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    m_length += size;
+    char* pending = m_buffer + HISTORY_SIZE;
+
+    // Hash64 consumes a 48-byte block whenever one is complete, even if it ends the input
+    if (m_pendingSize > 0) {
+        const size_t count = std::min(size, BLOCK_SIZE - m_pendingSize);
+        std::memcpy(pending + m_pendingSize, bytes, count);
+        m_pendingSize += count;
+        bytes += count;
+        size -= count;
+        if (m_pendingSize < BLOCK_SIZE) {
+            return;
+        }
+        ProcessBlocks(pending, 1);
+        std::memcpy(m_buffer, pending + BLOCK_SIZE - HISTORY_SIZE, HISTORY_SIZE);
+        m_pendingSize = 0;
+    }
+
+    if (size >= BLOCK_SIZE) {
+        const size_t blockCount = size / BLOCK_SIZE;
+        ProcessBlocks(bytes, blockCount);
+        bytes += blockCount * BLOCK_SIZE;
+        size -= blockCount * BLOCK_SIZE;
+        std::memcpy(m_buffer, bytes - HISTORY_SIZE, HISTORY_SIZE);
+    }
+
+    std::memcpy(pending, bytes, size);
+    m_pendingSize = size;
+}
+
+Hash::HashValue64 Hash::Hash64Stream::Finalize() const
+{
+    const char* pending = m_buffer + HISTORY_SIZE;
+    uint64_t seed = m_seed;
+    uint64_t a = 0;
+    uint64_t b = 0;
+
+    if (m_length <= 16) {
+        ReadShort64(pending, m_pendingSize, a, b);
+    }
+    else {
+        if (m_length >= BLOCK_SIZE) {
+            seed ^= m_seed1 ^ m_seed2;
+        }
+        const char* key = pending;
+        size_t remaining = m_pendingSize;
+        while (remaining > 16) {
+            seed = Mix64(Read64(key) ^ HASH64_SECRET[1], Read64(key + 8) ^ seed);
+            key += 16;
+            remaining -= 16;
+        }
+        // May read up to 16 bytes back into the history
+        a = Read64(key + remaining - 16);
+        b = Read64(key + remaining - 8);
+    }
+
+    return HashValue64(Finish64(a, b, seed, static_cast<size_t>(m_length)));
+}
+
+bool Hash::HashFile(const std::string& filePath, HashValue64& hash)
+{
+    Hash64Stream stream;
+
+    MappedFile mapping;
+    if (mapping.Open(filePath)) {
+        stream.Update(mapping.GetData(), mapping.GetSize());
+        hash = stream.Finalize();
+        return true;
+    }
+
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::vector<char> chunk(64 * 1024);
+    while (file) {
+        file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        stream.Update(chunk.data(), static_cast<size_t>(file.gcount()));
+    }
+    if (file.bad()) {
+        return false;
+    }
+    hash = stream.Finalize();
+    return true;
+}
+
+} // namespace Core
+} // namespace ShoeEngine
@@ -3,6 +3,7 @@
 #include <cstdint>  // for uint32_t
 #include <cstddef>  // for size_t
 #include <string>   // for std::string
+#include <string_view>
 
 namespace ShoeEngine {
 namespace Core {
@@ -29,53 +30,17 @@ public:
      */
     static constexpr std::uint32_t MurmurHash3(const char* key, std::uint32_t len, std::uint32_t seed = 0)
     {
-        constexpr std::uint32_t c1 = 0xcc9e2d51;
-        constexpr std::uint32_t c2 = 0x1b873593;
-        constexpr std::uint32_t r1 = 15;
-        constexpr std::uint32_t r2 = 13;
-        constexpr std::uint32_t m  = 5;
-        constexpr std::uint32_t n  = 0xe6546b64;
-
         std::uint32_t hash = seed;
 
         const int numBlocks = len / 4;
         const std::uint32_t* blocks = (const std::uint32_t*)(key);
 
         for (int i = 0; i < numBlocks; i++) {
-            std::uint32_t k = blocks[i];
-            k *= c1;
-            k = (k << r1) | (k >> (32 - r1)); // Rotate left
-            k *= c2;
-
-            hash ^= k;
-            hash = ((hash << r2) | (hash >> (32 - r2))) * m + n;
+            hash = MurmurMixBlock(hash, blocks[i]);
         }
 
 		const std::uint8_t* tail = (const std::uint8_t*)(key + numBlocks * 4);
-        std::uint32_t k1 = 0;
-
-        switch (len & 3) {
-        case 3: k1 ^= (tail[2] << 16);
-            [[fallthrough]];
-        case 2: k1 ^= (tail[1] << 8);
-            [[fallthrough]];
-        case 1:
-            k1 ^= tail[0];
-            k1 *= c1;
-            k1 = (k1 << r1) | (k1 >> (32 - r1));
-            k1 *= c2;
-            hash ^= k1;
-            break;
-        }
-
-        hash ^= len;
-        hash ^= (hash >> 16);
-        hash *= 0x85ebca6b;
-        hash ^= (hash >> 13);
-        hash *= 0xc2b2ae35;
-        hash ^= (hash >> 16);
-
-        return hash;
+        return MurmurFinalize(MurmurMixTail(hash, tail, len & 3), len);
     }
 
     /**
@@ -124,6 +89,66 @@ public:
         return hash;
     }
 
+    /**
+     * @brief Computes a 64-bit hash for the given data
+     * @param key Pointer to data to hash
+     * @param len Length of data in bytes
+     * @param seed Optional seed value
+     * @return 64-bit hash value
+     *
+     * Follows wyhash: up to 16 bytes are folded into two words that are mixed with one
+     * 64x64->128-bit multiply, longer inputs are consumed 48 bytes at a time in three
+     * independent lanes. Bytes are read one by one so the function stays constexpr;
+     * compilers merge the reads into plain loads.
+     */
+    static constexpr uint64_t Hash64(const char* key, size_t len, uint64_t seed = 0)
+    {
+        seed ^= Mix64(seed ^ HASH64_SECRET[0], HASH64_SECRET[1]);
+        uint64_t a = 0;
+        uint64_t b = 0;
+
+        if (len <= 16) {
+            ReadShort64(key, len, a, b);
+        }
+        else {
+            size_t remaining = len;
+            if (remaining >= 48) {
+                uint64_t seed1 = seed;
+                uint64_t seed2 = seed;
+                do {
+                    seed = Mix64(Read64(key) ^ HASH64_SECRET[1], Read64(key + 8) ^ seed);
+                    seed1 = Mix64(Read64(key + 16) ^ HASH64_SECRET[2], Read64(key + 24) ^ seed1);
+                    seed2 = Mix64(Read64(key + 32) ^ HASH64_SECRET[3], Read64(key + 40) ^ seed2);
+                    key += 48;
+                    remaining -= 48;
+                } while (remaining >= 48);
+                seed ^= seed1 ^ seed2;
+            }
+            while (remaining > 16) {
+                seed = Mix64(Read64(key) ^ HASH64_SECRET[1], Read64(key + 8) ^ seed);
+                key += 16;
+                remaining -= 16;
+            }
+            a = Read64(key + remaining - 16);
+            b = Read64(key + remaining - 8);
+        }
+
+        return Finish64(a, b, seed, len);
+    }
+
+    /**
+     * @brief Computes Hash64 for many strings at once
+     * @param keys Strings to hash
+     * @param count Number of strings
+     * @param hashes Receives one hash per string
+     * @param seed Optional seed value
+     *
+     * Gives the same results as calling Hash64 on each string. On SSE2 targets without a
+     * native 128-bit multiply, strings of up to 16 bytes, the usual length of ids, are
+     * mixed two at a time in vector lanes.
+     */
+    static void Hash64Batch(const std::string_view* keys, size_t count, uint64_t* hashes, uint64_t seed = 0);
+
     /**
      * @class HashValue
      * @brief Represents a computed hash value with comparison operations
@@ -168,9 +193,139 @@ public:
         uint32_t m_hash;
     };
 
+    /**
+     * @class HashValue64
+     * @brief 64-bit counterpart of HashValue, computed with Hash64
+     *
+     * For key sets large enough that 32-bit hashes are likely to collide.
+     */
+    class HashValue64
+    {
+    public:
+        constexpr HashValue64()
+            : m_hash(0)
+        {
+        }
+
+        constexpr HashValue64(uint64_t h)
+            : m_hash(h)
+        {
+        }
+
+        constexpr HashValue64(const char* key, size_t len)
+            : m_hash(Hash64(key, len))
+        {
+        }
+
+        constexpr HashValue64(std::string_view key)
+            : m_hash(Hash64(key.data(), key.size()))
+        {
+        }
+
+        constexpr operator uint64_t() const { return m_hash; }
+
+        constexpr bool operator==(const HashValue64& rhs) const { return m_hash == rhs.m_hash; }
+        constexpr bool operator==(uint64_t rhs)          const { return m_hash == rhs; }
+
+        // Combines this hash with a new key by seeding Hash64 with it
+        constexpr HashValue64 operator+(std::string_view key) const
+        {
+            return HashValue64(Hash64(key.data(), key.size(), m_hash));
+        }
+
+        uint64_t m_hash;
+    };
+
+    /**
+     * @class FNV1aStream
+     * @brief Computes FNV1a over data supplied in pieces
+     *
+     * Finalize gives the same value as FNV1a over all bytes passed to Update.
+     */
+    class FNV1aStream
+    {
+    public:
+        explicit FNV1aStream(uint32_t seed = 0) { Init(seed); }
+
+        void Init(uint32_t seed = 0) { m_hash = seed; }
+        void Update(const void* data, size_t size);
+        uint32_t Finalize() const { return m_hash; }
+
+    private:
+        uint32_t m_hash = 0;
+    };
+
+    /**
+     * @class MurmurHash3Stream
+     * @brief Computes MurmurHash3 over data supplied in pieces
+     *
+     * Finalize gives the same value as MurmurHash3 over all bytes passed to Update. Like
+     * MurmurHash3, only the low 32 bits of the total length enter the hash.
+     */
+    class MurmurHash3Stream
+    {
+    public:
+        explicit MurmurHash3Stream(uint32_t seed = 0) { Init(seed); }
+
+        void Init(uint32_t seed = 0);
+        void Update(const void* data, size_t size);
+        uint32_t Finalize() const;
+
+    private:
+        uint32_t m_hash = 0;
+        uint64_t m_length = 0;
+        uint8_t m_tail[4] = {};  ///< Bytes of an incomplete 4-byte block
+        size_t m_tailSize = 0;
+    };
+
+    /**
+     * @class Hash64Stream
+     * @brief Computes Hash64 over data supplied in pieces
+     *
+     * Finalize gives the same value as Hash64 over all bytes passed to Update. Input is
+     * consumed in Hash64's 48-byte blocks straight from the caller's buffers; only partial
+     * blocks are copied.
+     */
+    class Hash64Stream
+    {
+    public:
+        explicit Hash64Stream(uint64_t seed = 0) { Init(seed); }
+
+        void Init(uint64_t seed = 0);
+        void Update(const void* data, size_t size);
+        HashValue64 Finalize() const;
+
+    private:
+        static constexpr size_t BLOCK_SIZE = 48;
+        static constexpr size_t HISTORY_SIZE = 16;
+
+        void ProcessBlocks(const char* blocks, size_t count);
+
+        uint64_t m_seed = 0;
+        uint64_t m_seed1 = 0;
+        uint64_t m_seed2 = 0;
+        uint64_t m_length = 0;
+        // The last 16 processed bytes followed by the pending partial block, since the
+        // final read of Hash64 may reach back into data that was already processed
+        char m_buffer[HISTORY_SIZE + BLOCK_SIZE] = {};
+        size_t m_pendingSize = 0;
+    };
+
+    /**
+     * @brief Computes the Hash64 of a file's contents
+     * @param filePath Path of the file
+     * @param hash Receives the hash
+     * @return True if the file could be read
+     *
+     * Maps the file and hashes it in place. Files that cannot be mapped, such as empty
+     * files, are read in fixed-size chunks instead, so the file is never held in memory
+     * twice.
+     */
+    static bool HashFile(const std::string& filePath, HashValue64& hash);
+
     /**
      * @struct Hasher
-     * @brief Functor for using HashValue in STL containers
+     * @brief Functor for using HashValue and HashValue64 in STL containers
      */
     struct Hasher
     {
@@ -180,7 +335,162 @@ public:
             // (though on 64-bit systems size_t is larger).
             return static_cast<size_t>(h.m_hash);
         }
+
+        size_t operator()(const HashValue64& h) const
+        {
+            return static_cast<size_t>(h.m_hash);
+        }
+    };
+
+    /**
+     * @struct MixingHasher
+     * @brief Hasher that spreads all bits of a hash over the size_t result
+     *
+     * Hasher passes the hash through unchanged. That suits tables that reduce hashes
+     * modulo a prime, but power-of-two tables then see only its low bits, and on 64-bit
+     * targets the upper half of size_t is always zero. MixingHasher runs the hash through
+     * the MurmurHash3 64-bit finalizer first, for keys whose low bits are not random,
+     * such as ids built from counters.
+     */
+    struct MixingHasher
+    {
+        size_t operator()(const HashValue& h) const
+        {
+            return static_cast<size_t>(Mix(h.m_hash));
+        }
+
+        size_t operator()(const HashValue64& h) const
+        {
+            return static_cast<size_t>(Mix(h.m_hash));
+        }
+
+        static constexpr uint64_t Mix(uint64_t x)
+        {
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdull;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53ull;
+            x ^= x >> 33;
+            return x;
+        }
+    };
+
+private:
+    static constexpr std::uint32_t MurmurMixBlock(std::uint32_t hash, std::uint32_t k)
+    {
+        k *= 0xcc9e2d51;
+        k = (k << 15) | (k >> 17); // Rotate left
+        k *= 0x1b873593;
+
+        hash ^= k;
+        return ((hash << 13) | (hash >> 19)) * 5 + 0xe6546b64;
+    }
+
+    static constexpr std::uint32_t MurmurMixTail(std::uint32_t hash, const std::uint8_t* tail, std::uint32_t tailSize)
+    {
+        std::uint32_t k1 = 0;
+
+        switch (tailSize) {
+        case 3: k1 ^= (tail[2] << 16);
+            [[fallthrough]];
+        case 2: k1 ^= (tail[1] << 8);
+            [[fallthrough]];
+        case 1:
+            k1 ^= tail[0];
+            k1 *= 0xcc9e2d51;
+            k1 = (k1 << 15) | (k1 >> 17);
+            k1 *= 0x1b873593;
+            hash ^= k1;
+            break;
+        }
+        return hash;
+    }
+
+    static constexpr std::uint32_t MurmurFinalize(std::uint32_t hash, std::uint32_t len)
+    {
+        hash ^= len;
+        hash ^= (hash >> 16);
+        hash *= 0x85ebca6b;
+        hash ^= (hash >> 13);
+        hash *= 0xc2b2ae35;
+        hash ^= (hash >> 16);
+        return hash;
+    }
+
+    static constexpr uint64_t HASH64_SECRET[4] = {
+        0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
     };
+
+    // Full 64x64->128-bit product: low half in a, high half in b
+    static constexpr void Multiply128(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        a = static_cast<uint64_t>(product);
+        b = static_cast<uint64_t>(product >> 64);
+#else
+        const uint64_t lowLow = (a & 0xffffffff) * (b & 0xffffffff);
+        const uint64_t highLow = (a >> 32) * (b & 0xffffffff);
+        const uint64_t lowHigh = (a & 0xffffffff) * (b >> 32);
+        const uint64_t highHigh = (a >> 32) * (b >> 32);
+        const uint64_t middle = (lowLow >> 32) + (highLow & 0xffffffff) + (lowHigh & 0xffffffff);
+        a = (middle << 32) | (lowLow & 0xffffffff);
+        b = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+    }
+
+    static constexpr uint64_t Mix64(uint64_t a, uint64_t b)
+    {
+        Multiply128(a, b);
+        return a ^ b;
+    }
+
+    // Little-endian reads
+    static constexpr uint64_t Read64(const char* p)
+    {
+        uint64_t value = 0;
+        for (int i = 7; i >= 0; --i) {
+            value = (value << 8) | static_cast<uint8_t>(p[i]);
+        }
+        return value;
+    }
+
+    static constexpr uint64_t Read32(const char* p)
+    {
+        uint64_t value = 0;
+        for (int i = 3; i >= 0; --i) {
+            value = (value << 8) | static_cast<uint8_t>(p[i]);
+        }
+        return value;
+    }
+
+    // Folds up to 16 bytes into two words, reading overlapping windows instead of looping
+    static constexpr void ReadShort64(const char* p, size_t len, uint64_t& a, uint64_t& b)
+    {
+        if (len >= 4) {
+            const size_t offset = (len >> 3) << 2;
+            a = (Read32(p) << 32) | Read32(p + offset);
+            b = (Read32(p + len - 4) << 32) | Read32(p + len - 4 - offset);
+        }
+        else if (len > 0) {
+            a = (uint64_t{ static_cast<uint8_t>(p[0]) } << 16)
+                | (uint64_t{ static_cast<uint8_t>(p[len >> 1]) } << 8)
+                | static_cast<uint8_t>(p[len - 1]);
+            b = 0;
+        }
+        else {
+            a = 0;
+            b = 0;
+        }
+    }
+
+    static constexpr uint64_t Finish64(uint64_t a, uint64_t b, uint64_t seed, size_t len)
+    {
+        a ^= HASH64_SECRET[1];
+        b ^= seed;
+        Multiply128(a, b);
+        return Mix64(a ^ HASH64_SECRET[0] ^ len, b ^ HASH64_SECRET[1]);
+    }
 };
 
 } // namespace Core
@@ -194,6 +504,13 @@ namespace std {
             return static_cast<size_t>(h.m_hash);
         }
     };
+
+    template<>
+    struct hash<ShoeEngine::Core::Hash::HashValue64> {
+        size_t operator()(const ShoeEngine::Core::Hash::HashValue64& h) const {
+            return static_cast<size_t>(h.m_hash);
+        }
+    };
 }
 
 /**
@@ -209,3 +526,14 @@ constexpr ShoeEngine::Core::Hash::HashValue operator""_h(const char* key, size_t
 	// Casting size_t (often 64-bit) to uint32_t if you want 32-bit hashing
 	return ShoeEngine::Core::Hash::HashValue(key, static_cast<uint32_t>(len));
 }
+
+/**
+ * @brief User-defined literal operator for creating a HashValue64 from a string literal.
+ * @param key String literal
+ * @param len Length of the literal
+ * @return HashValue64 computed by Hash64
+ */
+constexpr ShoeEngine::Core::Hash::HashValue64 operator""_h64(const char* key, size_t len)
+{
+	return ShoeEngine::Core::Hash::HashValue64(key, len);
+}
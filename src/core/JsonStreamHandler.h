@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @class JsonStreamHandler
+ * @brief Receives the parse events of one top-level JSON section
+ *
+ * Managers that opt into streaming (BaseManager::CreateFromStream) return a handler, and
+ * DataManager::ProcessStream forwards it the events of the manager's section as the file
+ * is parsed, without building a JSON tree first. Events arrive in document order, starting
+ * with the section's value (usually StartObject) and ending with its matching end event.
+ *
+ * Every event returns true to continue. Returning false marks the section as failed and
+ * the rest of it is skipped. Unhandled events are ignored by default.
+ */
+class JsonStreamHandler {
+public:
+    virtual ~JsonStreamHandler() = default;
+
+    virtual bool Null() { return true; }
+    virtual bool Boolean(bool value) { return true; }
+    virtual bool Integer(int64_t value) { return true; }
+    virtual bool Unsigned(uint64_t value) { return true; }
+    virtual bool Float(double value) { return true; }
+    virtual bool String(const std::string& value) { return true; }
+    virtual bool StartObject() { return true; }
+    virtual bool Key(const std::string& key) { return true; }
+    virtual bool EndObject() { return true; }
+    virtual bool StartArray() { return true; }
+    virtual bool EndArray() { return true; }
+
+    /**
+     * @brief Called once the whole section has been parsed
+     * @return bool True if the section was valid and its objects were created
+     */
+    virtual bool Finish() = 0;
+};
+
+} // namespace Core
+} // namespace ShoeEngine
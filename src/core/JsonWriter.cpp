@@ -0,0 +1,280 @@
+#include "JsonWriter.h"
+#include <cassert>
+#include <charconv>
+#include <cmath>
+
+namespace ShoeEngine {
+namespace Core {
+
+JsonWriter::JsonWriter(int indent)
+    : m_indent(indent)
+{
+}
+
+JsonWriter::JsonWriter(std::ostream& output, int indent)
+    : m_output(&output)
+    , m_indent(indent)
+{
+    m_buffer.reserve(FLUSH_SIZE + 1024);
+}
+
+void JsonWriter::Reset(int baseLevel)
+{
+    m_buffer.clear();
+    m_baseLevel = static_cast<size_t>(baseLevel);
+    m_hasElements.clear();
+    m_afterKey = false;
+}
+
+void JsonWriter::NewLine(size_t level)
+{
+    if (m_indent >= 0) {
+        m_buffer += '\n';
+        m_buffer.append((m_baseLevel + level) * static_cast<size_t>(m_indent), ' ');
+    }
+}
+
+void JsonWriter::BeginValue()
+{
+    if (m_afterKey) {
+        m_afterKey = false;
+        return;
+    }
+    if (m_hasElements.empty()) {
+        return;
+    }
+    if (m_hasElements.back()) {
+        m_buffer += ',';
+    }
+    m_hasElements.back() = true;
+    NewLine(m_hasElements.size());
+}
+
+void JsonWriter::FlushIfFull()
+{
+    if (m_output && m_buffer.size() >= FLUSH_SIZE) {
+        Flush();
+    }
+}
+
+void JsonWriter::Null()
+{
+    BeginValue();
+    m_buffer += "null";
+}
+
+void JsonWriter::Boolean(bool value)
+{
+    BeginValue();
+    m_buffer += value ? "true" : "false";
+}
+
+void JsonWriter::Integer(int64_t value)
+{
+    BeginValue();
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    m_buffer.append(digits, result.ptr);
+}
+
+void JsonWriter::Unsigned(uint64_t value)
+{
+    BeginValue();
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    m_buffer.append(digits, result.ptr);
+}
+
+template <typename T>
+void JsonWriter::AppendFloat(T value)
+{
+    BeginValue();
+    if (!std::isfinite(value)) {
+        // Like nlohmann::json, which has no representation for these
+        m_buffer += "null";
+        return;
+    }
+
+    // Shortest text that reads back as the same value of type T
+    char digits[32];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    const std::string_view text(digits, static_cast<size_t>(result.ptr - digits));
+    m_buffer += text;
+    if (text.find_first_of(".e") == std::string_view::npos) {
+        m_buffer += ".0"; // Keep it a float when read back
+    }
+}
+
+void JsonWriter::Float(double value)
+{
+    AppendFloat(value);
+}
+
+void JsonWriter::Float(float value)
+{
+    AppendFloat(value);
+}
+
+void JsonWriter::String(std::string_view value)
+{
+    BeginValue();
+    AppendString(m_buffer, value);
+    FlushIfFull();
+}
+
+void JsonWriter::Key(std::string_view key)
+{
+    assert(!m_hasElements.empty() && !m_afterKey);
+    BeginValue();
+    AppendString(m_buffer, key);
+    m_buffer += m_indent >= 0 ? ": " : ":";
+    m_afterKey = true;
+}
+
+void JsonWriter::Open(char bracket)
+{
+    BeginValue();
+    m_buffer += bracket;
+    m_hasElements.push_back(false);
+}
+
+void JsonWriter::Close(char bracket)
+{
+    assert(!m_hasElements.empty() && !m_afterKey);
+    const bool hasElements = m_hasElements.back();
+    m_hasElements.pop_back();
+    if (hasElements) {
+        NewLine(m_hasElements.size());
+    }
+    m_buffer += bracket;
+    FlushIfFull();
+}
+
+void JsonWriter::StartObject()
+{
+    Open('{');
+}
+
+void JsonWriter::EndObject()
+{
+    Close('}');
+}
+
+void JsonWriter::StartArray()
+{
+    Open('[');
+}
+
+void JsonWriter::EndArray()
+{
+    Close(']');
+}
+
+void JsonWriter::Value(const nlohmann::json& value)
+{
+    switch (value.type()) {
+    case nlohmann::json::value_t::object:
+        StartObject();
+        for (auto it = value.begin(); it != value.end(); ++it) {
+            Key(it.key());
+            Value(it.value());
+        }
+        EndObject();
+        break;
+    case nlohmann::json::value_t::array:
+        StartArray();
+        for (const auto& element : value) {
+            Value(element);
+        }
+        EndArray();
+        break;
+    case nlohmann::json::value_t::string:
+        String(value.get_ref<const std::string&>());
+        break;
+    case nlohmann::json::value_t::boolean:
+        Boolean(value.get<bool>());
+        break;
+    case nlohmann::json::value_t::number_integer:
+        Integer(value.get<int64_t>());
+        break;
+    case nlohmann::json::value_t::number_unsigned:
+        Unsigned(value.get<uint64_t>());
+        break;
+    case nlohmann::json::value_t::number_float:
+        Float(value.get<double>());
+        break;
+    default:
+        Null();
+        break;
+    }
+}
+
+void JsonWriter::Raw(std::string_view json)
+{
+    BeginValue();
+    m_buffer += json;
+    FlushIfFull();
+}
+
+void JsonWriter::Flush()
+{
+    if (m_output && !m_buffer.empty()) {
+        m_output->write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+}
+
+std::string JsonWriter::TakeBuffer()
+{
+    std::string buffer = std::move(m_buffer);
+    m_buffer.clear();
+    return buffer;
+}
+
+bool JsonWriter::IsEmptyValue() const
+{
+    return m_buffer.empty() || m_buffer == "null" || m_buffer == "{}" || m_buffer == "[]";
+}
+
+void JsonWriter::AppendString(std::string& buffer, std::string_view value)
+{
+    static constexpr char HEX[] = "0123456789abcdef";
+
+    buffer += '"';
+    size_t plainStart = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        const auto c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+
+        buffer.append(value.data() + plainStart, i - plainStart);
+        plainStart = i + 1;
+        switch (c) {
+        case '"': buffer += "\\\""; break;
+        case '\\': buffer += "\\\\"; break;
+        case '\b': buffer += "\\b"; break;
+        case '\f': buffer += "\\f"; break;
+        case '\n': buffer += "\\n"; break;
+        case '\r': buffer += "\\r"; break;
+        case '\t': buffer += "\\t"; break;
+        default:
+            buffer += "\\u00";
+            buffer += HEX[c >> 4];
+            buffer += HEX[c & 0xf];
+            break;
+        }
+    }
+    buffer.append(value.data() + plainStart, value.size() - plainStart);
+    buffer += '"';
+}
+
+nlohmann::json JsonWriter::ToJson(const std::function<void(JsonWriter&)>& write)
+{
+    JsonWriter writer;
+    write(writer);
+    return nlohmann::json::parse(writer.GetBuffer());
+}
+
+} // namespace Core
+} // namespace ShoeEngine
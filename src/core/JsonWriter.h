@@ -0,0 +1,144 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @class JsonWriter
+ * @brief Writes JSON text event by event, without building a JSON tree
+ *
+ * The output counterpart of JsonStreamHandler: managers serialize by calling StartObject,
+ * Key, String, ... in document order, and the text is appended to a buffer that can be
+ * reused between documents. When constructed with a stream, the buffer is flushed to it
+ * whenever it grows past FLUSH_SIZE, so memory stays bounded for large documents.
+ *
+ * The layout matches nlohmann::json::dump with the same indent: -1 writes compact JSON,
+ * 0 or more puts every element on its own line indented by that many spaces per level.
+ * Strings are escaped the same way and numbers round-trip, but keys are written in the
+ * order given rather than sorted.
+ *
+ * Calls must form a single valid value; this is only checked with asserts.
+ */
+class JsonWriter {
+public:
+    static constexpr size_t FLUSH_SIZE = 64 * 1024;
+
+    /**
+     * @brief Constructor writing into the writer's buffer
+     * @param indent Spaces per level; -1 for compact output
+     */
+    explicit JsonWriter(int indent = -1);
+
+    /**
+     * @brief Constructor writing through the buffer into a stream
+     * @param output Stream receiving the text; written on Flush and when the buffer is full
+     * @param indent Spaces per level; -1 for compact output
+     */
+    explicit JsonWriter(std::ostream& output, int indent = -1);
+
+    /**
+     * @brief Starts a new document, keeping the buffer's capacity
+     * @param baseLevel Indentation level of the document, e.g. 1 for a value nested in an object
+     */
+    void Reset(int baseLevel = 0);
+
+    void Null();
+    void Boolean(bool value);
+    void Integer(int64_t value);
+    void Unsigned(uint64_t value);
+    void Float(double value);
+
+    /**
+     * @brief Writes a float with the fewest digits that read back as the same float
+     * @param value The value; shorter and cheaper to format than the same value as a double
+     */
+    void Float(float value);
+    void String(std::string_view value);
+    void StartObject();
+    void Key(std::string_view key);
+    void EndObject();
+    void StartArray();
+    void EndArray();
+
+    /**
+     * @brief Writes a JSON tree, for data that already is one
+     * @param value The tree
+     */
+    void Value(const nlohmann::json& value);
+
+    /**
+     * @brief Writes JSON text produced by a writer with the same indent and level
+     * @param json Complete JSON value
+     */
+    void Raw(std::string_view json);
+
+    /**
+     * @brief Writes the buffered text to the stream and empties the buffer
+     */
+    void Flush();
+
+    /**
+     * @brief Gets the text written since the last Reset or Flush
+     * @return The buffer
+     */
+    const std::string& GetBuffer() const { return m_buffer; }
+
+    /**
+     * @brief Moves the buffer out of the writer
+     * @return The text written since the last Reset or Flush
+     */
+    std::string TakeBuffer();
+
+    /**
+     * @brief Whether the document is null or an empty object or array
+     * @return True if nothing but an empty value was written; only valid without a stream
+     */
+    bool IsEmptyValue() const;
+
+    /**
+     * @brief Appends a quoted, escaped JSON string to a buffer
+     * @param buffer Text to append to
+     * @param value Unescaped UTF-8 string
+     */
+    static void AppendString(std::string& buffer, std::string_view value);
+
+    /**
+     * @brief Parses the output of a write function into a JSON tree
+     * @param write Writes one value into the writer it is given
+     * @return The tree; for callers that need nlohmann::json, like SerializeToJson
+     */
+    static nlohmann::json ToJson(const std::function<void(JsonWriter&)>& write);
+
+private:
+    /**
+     * @brief Writes the separator and line break before a value or key
+     */
+    void BeginValue();
+
+    template <typename T>
+    void AppendFloat(T value);
+
+    void Open(char bracket);
+    void Close(char bracket);
+    void NewLine(size_t level);
+    void FlushIfFull();
+
+    std::string m_buffer;
+    std::ostream* m_output = nullptr;
+    int m_indent = -1;
+    size_t m_baseLevel = 0;
+    std::vector<bool> m_hasElements; ///< One entry per open container
+    bool m_afterKey = false;         ///< A key was written and awaits its value
+};
+
+} // namespace Core
+} // namespace ShoeEngine
@@ -0,0 +1,302 @@
+#pragma once
+
+#include "Hash.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ShoeEngine {
+namespace Core {
+
+namespace Detail {
+
+constexpr size_t NextPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+/**
+ * @class PerfectHashIndex
+ * @brief Collision-free index over up to N distinct 64-bit keys, built at compile time
+ *
+ * Uses hash and displace: a first hash sorts the keys into buckets, then each bucket,
+ * largest first, is given the smallest seed for which a second, seeded hash sends all of
+ * its keys to free slots. A lookup reads one seed and one slot. The caller compares the
+ * key stored at the returned index, since keys that were never added land anywhere.
+ */
+template<size_t N>
+class PerfectHashIndex {
+public:
+    static constexpr size_t NONE = N;
+
+    /**
+     * @brief Builds the index
+     * @param keys Keys to index by position
+     * @param firstOfEqual If true, a key equal to an earlier one is left out, so Find returns
+     *        the first; if false, equal keys make the build fail
+     * @return False if two keys are equal and firstOfEqual is false, or no seed fits a bucket
+     *
+     * Linear in N apart from the seed search, so large tables stay within the compilers'
+     * constexpr step limits.
+     */
+    constexpr bool Build(const std::array<uint64_t, N>& keys, bool firstOfEqual)
+    {
+        m_slots.fill(NONE);
+        m_seeds.fill(0);
+
+        // Counting sort of the key positions by bucket, in position order within a bucket
+        std::array<size_t, N> buckets{};
+        std::array<size_t, BUCKET_COUNT + 1> starts{};
+        for (size_t i = 0; i < N; ++i) {
+            buckets[i] = Bucket(keys[i]);
+            ++starts[buckets[i] + 1];
+        }
+        for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+            starts[b + 1] += starts[b];
+        }
+        std::array<size_t, N> members{};
+        std::array<size_t, BUCKET_COUNT> sizes{};
+        for (size_t i = 0; i < N; ++i) {
+            members[starts[buckets[i]] + sizes[buckets[i]]++] = i;
+        }
+
+        // Equal keys share a bucket, so only keys within a bucket are compared
+        size_t largest = 0;
+        for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+            size_t kept = 0;
+            for (size_t m = 0; m < sizes[b]; ++m) {
+                const size_t member = members[starts[b] + m];
+                bool equal = false;
+                for (size_t k = 0; k < kept && !equal; ++k) {
+                    equal = keys[members[starts[b] + k]] == keys[member];
+                }
+                if (equal && !firstOfEqual) {
+                    return false;
+                }
+                if (!equal) {
+                    members[starts[b] + kept++] = member;
+                }
+            }
+            sizes[b] = kept;
+            largest = kept > largest ? kept : largest;
+        }
+
+        // Largest buckets first, while most slots are free
+        for (size_t size = largest; size > 0; --size) {
+            for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+                if (sizes[b] == size && !PlaceBucket(keys, members, starts[b], size, b)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Finds the index a key was built with
+     * @return Index of the key if it was built in; otherwise any index or NONE
+     */
+    constexpr size_t Find(uint64_t key) const
+    {
+        return m_slots[Slot(key, m_seeds[Bucket(key)])];
+    }
+
+private:
+    static constexpr size_t SLOT_COUNT = NextPowerOfTwo(N * 2);
+    static constexpr size_t BUCKET_COUNT = NextPowerOfTwo(N / 2 + 1);
+    static constexpr uint32_t MAX_SEED = 1 << 16;
+
+    static constexpr size_t Bucket(uint64_t key)
+    {
+        return static_cast<size_t>(Hash::MixingHasher::Mix(key) & (BUCKET_COUNT - 1));
+    }
+
+    static constexpr size_t Slot(uint64_t key, uint32_t seed)
+    {
+        return static_cast<size_t>(Hash::MixingHasher::Mix(key ^ (seed * 0x9e3779b97f4a7c15ull)) & (SLOT_COUNT - 1));
+    }
+
+    constexpr bool PlaceBucket(const std::array<uint64_t, N>& keys, const std::array<size_t, N>& members,
+        size_t first, size_t count, size_t bucket)
+    {
+        for (uint32_t seed = 1; seed < MAX_SEED; ++seed) {
+            // Take the free slots; a member hitting a slot taken by another one of this bucket fails too
+            size_t m = 0;
+            for (; m < count; ++m) {
+                size_t& slot = m_slots[Slot(keys[members[first + m]], seed)];
+                if (slot != NONE) {
+                    break;
+                }
+                slot = members[first + m];
+            }
+            if (m == count) {
+                m_seeds[bucket] = seed;
+                return true;
+            }
+            while (m > 0) {
+                --m;
+                m_slots[Slot(keys[members[first + m]], seed)] = NONE;
+            }
+        }
+        return false;
+    }
+
+    std::array<uint32_t, BUCKET_COUNT> m_seeds{};
+    std::array<size_t, SLOT_COUNT> m_slots{};
+};
+
+} // namespace Detail
+
+/**
+ * @class LiteralTable
+ * @brief Compile-time table of string literals with perfect-hash lookups
+ *
+ * Built from name/value pairs in a constexpr context. Each name is hashed with the same
+ * FNV1a as "..."_h, and lookups by hash, by name or (for integral and enum values) by
+ * value read one slot of a perfect hash, with no runtime setup or registration.
+ *
+ * Two names sharing a hash would make lookups ambiguous, so such a table is invalid.
+ * Check it where it is defined:
+ * @code
+ * constexpr auto KEYS = Core::MakeLiteralTable<sf::Keyboard::Key>({ {"A", sf::Keyboard::A}, ... });
+ * static_assert(KEYS.IsValid(), "Key names must have distinct hashes");
+ * @endcode
+ *
+ * @tparam Value Type of the values
+ * @tparam N Number of entries
+ */
+template<typename Value, size_t N>
+class LiteralTable {
+public:
+    struct Entry {
+        std::string_view name;
+        Hash::HashValue hash;
+        Value value{};
+    };
+
+    constexpr explicit LiteralTable(const std::pair<std::string_view, Value> (&entries)[N])
+    {
+        std::array<uint64_t, N> hashes{};
+        for (size_t i = 0; i < N; ++i) {
+            const std::string_view name = entries[i].first;
+            m_entries[i] = Entry{ name, Hash::HashValue(name.data(), static_cast<uint32_t>(name.size())), entries[i].second };
+            hashes[i] = m_entries[i].hash;
+        }
+        m_valid = m_byHash.Build(hashes, false);
+
+        if constexpr (HAS_VALUE_INDEX) {
+            // Several names may share a value; value lookups return the first of them
+            std::array<uint64_t, N> values{};
+            for (size_t i = 0; i < N; ++i) {
+                values[i] = ValueKey(m_entries[i].value);
+            }
+            m_valid = m_valid && m_byValue.Build(values, true);
+        }
+    }
+
+    /**
+     * @brief Checks that all names have distinct hashes
+     * @return True if the table can be used
+     */
+    constexpr bool IsValid() const { return m_valid; }
+
+    constexpr size_t size() const { return N; }
+    constexpr const Entry* begin() const { return m_entries.data(); }
+    constexpr const Entry* end() const { return m_entries.data() + N; }
+
+    /**
+     * @brief Finds the entry of a name's hash
+     * @return Entry, or nullptr if no name has this hash
+     */
+    constexpr const Entry* FindEntry(Hash::HashValue hash) const
+    {
+        const size_t index = m_byHash.Find(hash);
+        return index < N && m_entries[index].hash == hash ? &m_entries[index] : nullptr;
+    }
+
+    /**
+     * @brief Finds the value of a name's hash
+     * @return Value, or nullptr if no name has this hash
+     */
+    constexpr const Value* Find(Hash::HashValue hash) const
+    {
+        const Entry* entry = FindEntry(hash);
+        return entry ? &entry->value : nullptr;
+    }
+
+    /**
+     * @brief Finds the value of a name
+     * @return Value, or nullptr if the name is not in the table
+     */
+    constexpr const Value* Find(std::string_view name) const
+    {
+        const Entry* entry = FindEntry(Hash::HashValue(name.data(), static_cast<uint32_t>(name.size())));
+        return entry && entry->name == name ? &entry->value : nullptr;
+    }
+
+    /**
+     * @brief Gets the name of a hash
+     * @return Name, or an empty view if no name has this hash
+     */
+    constexpr std::string_view GetName(Hash::HashValue hash) const
+    {
+        const Entry* entry = FindEntry(hash);
+        return entry ? entry->name : std::string_view();
+    }
+
+    /**
+     * @brief Finds the first entry with a value
+     * @return Entry, or nullptr if no entry has this value
+     *
+     * Constant time for integral and enum values, a linear search otherwise.
+     */
+    constexpr const Entry* FindValue(const Value& value) const
+    {
+        if constexpr (HAS_VALUE_INDEX) {
+            const size_t index = m_byValue.Find(ValueKey(value));
+            return index < N && m_entries[index].value == value ? &m_entries[index] : nullptr;
+        }
+        else {
+            for (const Entry& entry : m_entries) {
+                if (entry.value == value) {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+    }
+
+private:
+    static constexpr bool HAS_VALUE_INDEX = std::is_integral_v<Value> || std::is_enum_v<Value>;
+
+    static constexpr uint64_t ValueKey(const Value& value)
+    {
+        return static_cast<uint64_t>(value);
+    }
+
+    std::array<Entry, N> m_entries{};
+    Detail::PerfectHashIndex<N> m_byHash{};
+    Detail::PerfectHashIndex<N> m_byValue{};
+    bool m_valid = false;
+};
+
+/**
+ * @brief Builds a LiteralTable, deducing its size from the list of entries
+ * @param entries Name/value pairs
+ * @return The table; check IsValid() with static_assert
+ */
+template<typename Value, size_t N>
+constexpr LiteralTable<Value, N> MakeLiteralTable(const std::pair<std::string_view, Value> (&entries)[N])
+{
+    return LiteralTable<Value, N>(entries);
+}
+
+} // namespace Core
+} // namespace ShoeEngine
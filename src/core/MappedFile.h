@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file
+ *
+ * Maps a file into the address space so its contents can be used in place without
+ * reading or copying them. The mapping is released when the object is destroyed or
+ * another file is opened.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Default constructor creating an empty mapping
+     */
+    MappedFile() = default;
+
+    /**
+     * @brief Destructor; unmaps the file
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps a file, replacing any previous mapping
+     * @param filePath Path of the file to map
+     * @return True if the file was mapped; empty files cannot be mapped
+     */
+    bool Open(const std::string& filePath);
+
+    /**
+     * @brief Unmaps the file
+     */
+    void Close();
+
+    /**
+     * @brief Gets the mapped bytes
+     * @return Pointer to the start of the file, or nullptr if nothing is mapped
+     */
+    const uint8_t* GetData() const { return m_data; }
+
+    /**
+     * @brief Gets the size of the mapped file
+     * @return Size in bytes
+     */
+    size_t GetSize() const { return m_size; }
+
+    /**
+     * @brief Checks whether a file is mapped
+     * @return True if a file is mapped
+     */
+    bool IsOpen() const { return m_data != nullptr; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;    ///< HANDLE of the open file
+    void* m_mappingHandle = nullptr; ///< HANDLE of the file mapping
+#endif
+};
+
+} // namespace Core
+} // namespace ShoeEngine
@@ -0,0 +1,78 @@
+#include "RadixSort.h"
+#include <array>
+#include <cstring>
+
+namespace ShoeEngine {
+namespace Core {
+
+namespace {
+
+constexpr size_t KEY_BYTES = sizeof(uint64_t);
+constexpr size_t BUCKETS = 256;
+
+void InsertionSort(std::vector<SortEntry>& entries)
+{
+    for (size_t i = 1; i < entries.size(); ++i) {
+        const SortEntry entry = entries[i];
+        size_t j = i;
+        // Strictly greater, so equal keys keep their order
+        for (; j > 0 && entries[j - 1].key > entry.key; --j) {
+            entries[j] = entries[j - 1];
+        }
+        entries[j] = entry;
+    }
+}
+
+} // namespace
+
+void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch)
+{
+    const size_t count = entries.size();
+    if (count <= INSERTION_SORT_LIMIT) {
+        InsertionSort(entries);
+        return;
+    }
+
+    // Histograms of every key byte in one read of the input
+    std::array<std::array<uint32_t, BUCKETS>, KEY_BYTES> histograms{};
+    for (const SortEntry& entry : entries) {
+        for (size_t byte = 0; byte < KEY_BYTES; ++byte) {
+            ++histograms[byte][(entry.key >> (byte * 8)) & 0xFF];
+        }
+    }
+
+    scratch.resize(count);
+    for (size_t byte = 0; byte < KEY_BYTES; ++byte) {
+        std::array<uint32_t, BUCKETS>& histogram = histograms[byte];
+        const int shift = static_cast<int>(byte * 8);
+
+        // A byte shared by every key would leave the order unchanged
+        if (histogram[(entries[0].key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram) {
+            const uint32_t size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+        for (const SortEntry& entry : entries) {
+            scratch[histogram[(entry.key >> shift) & 0xFF]++] = entry;
+        }
+        entries.swap(scratch);
+    }
+}
+
+uint32_t ToSortableBits(float value)
+{
+    value += 0.0f; // -0 becomes +0
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // Negative floats order backwards by magnitude, so flip all their bits; set the sign
+    // bit of the others so they follow
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+} // namespace Core
+} // namespace ShoeEngine
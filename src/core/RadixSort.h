@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @struct SortEntry
+ * @brief A 64-bit sort key with a 32-bit payload, e.g. a slot index
+ */
+struct SortEntry {
+    uint64_t key;
+    uint32_t value;
+};
+
+/**
+ * @brief Sorts entries by key with a stable LSD radix sort, one pass per key byte
+ *
+ * Entries with equal keys keep their relative order, so the result only depends on the
+ * input order and never on addresses. Bytes that are equal in every key are skipped, so
+ * keys using only their low bits cost fewer passes. Runs of up to INSERTION_SORT_LIMIT
+ * entries are insertion sorted instead.
+ *
+ * @param entries Entries to sort
+ * @param scratch Buffer of the same kind, reused between calls to avoid allocating; its
+ *                contents are replaced
+ */
+void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
+
+/**
+ * @brief Inputs this short are insertion sorted by RadixSort
+ */
+constexpr size_t INSERTION_SORT_LIMIT = 32;
+
+/**
+ * @brief Maps a float to an unsigned integer with the same order, for use in sort keys
+ * @param value Any value but NaN; -0 and +0 map to the same integer
+ * @return Integer that compares like the float
+ */
+uint32_t ToSortableBits(float value);
+
+} // namespace Core
+} // namespace ShoeEngine
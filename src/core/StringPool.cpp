@@ -0,0 +1,68 @@
+#include "StringPool.h"
+#include <algorithm>
+#include <cstring>
+
+namespace ShoeEngine {
+namespace Core {
+
+StringPool::StringPool(size_t chunkSize)
+    : m_chunkSize(std::max<size_t>(chunkSize, 1))
+{
+}
+
+StringPool::InternResult StringPool::Intern(Hash::HashValue hash, std::string_view str)
+{
+    auto it = m_index.find(hash);
+    if (it != m_index.end()) {
+        if (it->second == str) {
+            return InternResult::Existing;
+        }
+        ++m_collisionCount;
+        return InternResult::Collision;
+    }
+
+    m_index.emplace(hash, Store(str));
+    return InternResult::Added;
+}
+
+std::string_view StringPool::Find(Hash::HashValue hash) const
+{
+    auto it = m_index.find(hash);
+    return it != m_index.end() ? it->second : std::string_view();
+}
+
+void StringPool::Reserve(size_t stringCount, size_t byteCount)
+{
+    m_index.reserve(m_index.size() + stringCount);
+    if (byteCount > m_chunkRemaining) {
+        // One chunk holding the whole batch keeps it contiguous
+        AddChunk(std::max(byteCount, m_chunkSize));
+    }
+}
+
+std::string_view StringPool::Store(std::string_view str)
+{
+    if (str.empty()) {
+        return std::string_view();
+    }
+    if (str.size() > m_chunkRemaining) {
+        AddChunk(std::max(str.size(), m_chunkSize));
+    }
+
+    char* destination = m_chunkPosition;
+    std::memcpy(destination, str.data(), str.size());
+    m_chunkPosition += str.size();
+    m_chunkRemaining -= str.size();
+    return std::string_view(destination, str.size());
+}
+
+void StringPool::AddChunk(size_t size)
+{
+    m_chunks.push_back(std::make_unique<char[]>(size));
+    m_chunkPosition = m_chunks.back().get();
+    m_chunkRemaining = size;
+    m_capacityBytes += size;
+}
+
+} // namespace Core
+} // namespace ShoeEngine
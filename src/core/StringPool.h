@@ -0,0 +1,113 @@
+#pragma once
+
+#include "FlatHashMap.h"
+#include "Hash.h"
+#include <memory>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @class StringPool
+ * @brief Interned strings keyed by their HashValue, stored contiguously in arena chunks
+ *
+ * Each distinct string is copied once into a chunk of arena memory and never moved, so
+ * the views returned by Intern() and Find() stay valid for the lifetime of the pool.
+ * Interning a string that is already in the pool only costs a lookup.
+ *
+ * Two different strings with the same hash are a collision: the first string keeps the
+ * hash, the second is not stored and the collision is counted.
+ *
+ * The pool is not thread-safe; DataManager guards it with its own lock.
+ */
+class StringPool {
+public:
+    /// Default size of an arena chunk; longer strings get a chunk of their own
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+    /**
+     * @brief Result of interning a string
+     */
+    enum class InternResult {
+        Added,     ///< The string was new and has been stored
+        Existing,  ///< The same string was already in the pool
+        Collision  ///< A different string with the same hash is in the pool
+    };
+
+    /**
+     * @brief Constructor
+     * @param chunkSize Size of each arena chunk in bytes
+     */
+    explicit StringPool(size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /**
+     * @brief Adds a string to the pool
+     * @param hash HashValue of the string
+     * @param str The string
+     * @return Whether the string was added, already present or collided with another string
+     */
+    InternResult Intern(Hash::HashValue hash, std::string_view str);
+
+    /**
+     * @brief Looks up a string by hash
+     * @param hash HashValue of the string
+     * @return View of the interned string, or an empty view if the hash is unknown
+     */
+    std::string_view Find(Hash::HashValue hash) const;
+
+    /**
+     * @brief Prepares the pool for a bulk load
+     * @param stringCount Number of strings that will be added
+     * @param byteCount Total length of those strings
+     */
+    void Reserve(size_t stringCount, size_t byteCount);
+
+    /**
+     * @brief Gets the number of interned strings
+     * @return String count
+     */
+    size_t GetCount() const { return m_index.size(); }
+
+    /**
+     * @brief Gets the number of collisions detected so far
+     * @return Collision count
+     */
+    size_t GetCollisionCount() const { return m_collisionCount; }
+
+    /**
+     * @brief Gets the arena memory allocated for string data
+     * @return Allocated bytes
+     */
+    size_t GetCapacityBytes() const { return m_capacityBytes; }
+
+private:
+    /**
+     * @brief Copies a string into the arena
+     * @param str The string
+     * @return View of the copy
+     */
+    std::string_view Store(std::string_view str);
+
+    /**
+     * @brief Starts a new chunk
+     * @param size Size of the chunk in bytes
+     */
+    void AddChunk(size_t size);
+
+    size_t m_chunkSize;
+    std::vector<std::unique_ptr<char[]>> m_chunks;
+    char* m_chunkPosition = nullptr;  ///< Next free byte of the current chunk
+    size_t m_chunkRemaining = 0;      ///< Free bytes left in the current chunk
+    size_t m_capacityBytes = 0;
+    size_t m_collisionCount = 0;
+    FlatHashMap<Hash::HashValue, std::string_view> m_index;
+};
+
+} // namespace Core
+} // namespace ShoeEngine
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+
+namespace ShoeEngine {
+namespace Core {
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads executing submitted tasks in FIFO order
+ *
+ * Tasks are queued with Submit() and picked up by the first idle worker. Every
+ * submission returns a std::future, so results and exceptions thrown by a task are
+ * delivered to the thread that waits on it.
+ *
+ * The destructor finishes all queued tasks before joining the workers.
+ *
+ * @example
+ * ThreadPool pool(4);
+ * auto result = pool.Submit([] { return DecodeSomething(); });
+ * Use(result.get());
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Constructor starting the worker threads
+     * @param threadCount Number of workers; 0 uses the number of hardware threads
+     */
+    explicit ThreadPool(size_t threadCount = 0);
+
+    /**
+     * @brief Destructor; runs the remaining queued tasks and joins the workers
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queues a task for execution on a worker thread
+     * @param task Callable taking no arguments
+     * @return Future receiving the task's result or the exception it threw
+     */
+    template<typename Task>
+    auto Submit(Task&& task) -> std::future<std::invoke_result_t<std::decay_t<Task>>> {
+        using Result = std::invoke_result_t<std::decay_t<Task>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+        std::future<Result> future = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.emplace([packaged]() { (*packaged)(); });
+        }
+        m_condition.notify_one();
+        return future;
+    }
+
+    /**
+     * @brief Gets the number of worker threads
+     * @return Worker count
+     */
+    size_t GetThreadCount() const { return m_workers.size(); }
+
+    /**
+     * @brief Gets the number of hardware threads, at least 1
+     * @return Default worker count
+     */
+    static size_t GetDefaultThreadCount();
+
+private:
+    /**
+     * @brief Worker loop: runs queued tasks until the pool is stopped and the queue is empty
+     */
+    void WorkerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stopping = false;
+};
+
+} // namespace Core
+} // namespace ShoeEngine
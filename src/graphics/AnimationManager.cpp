@@ -0,0 +1,549 @@
+#include "AnimationManager.h"
+#include "core/BakedData.h"
+#include "core/Hash.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+AnimationManager::AnimationManager(Core::DataManager& dataManager, ImageManager& imageManager, SpriteManager& spriteManager)
+    : Core::BaseManager(dataManager)
+    , m_imageManager(imageManager)
+    , m_spriteManager(spriteManager)
+{
+    m_dataManager.RegisterString("animations");
+}
+
+bool AnimationManager::ParseLoopMode(std::string_view name, LoopMode& loop) {
+    if (name == "loop") {
+        loop = LoopMode::Loop;
+    }
+    else if (name == "once") {
+        loop = LoopMode::Once;
+    }
+    else if (name == "pingpong") {
+        loop = LoopMode::PingPong;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+const char* AnimationManager::GetLoopModeName(LoopMode loop) {
+    switch (loop) {
+    case LoopMode::Once:
+        return "once";
+    case LoopMode::PingPong:
+        return "pingpong";
+    default:
+        return "loop";
+    }
+}
+
+bool AnimationManager::ParseDefinition(const nlohmann::json& data, Definition& definition) {
+    definition.image = data.at("image").get<std::string>();
+    if (data.contains("loop") && !ParseLoopMode(data["loop"].get<std::string>(), definition.loop)) {
+        return false;
+    }
+
+    const float frameDuration = data.value("frameDuration", DEFAULT_FRAME_DURATION);
+    const auto& frames = data.at("frames");
+    if (!frames.is_array() || frames.empty()) {
+        return false;
+    }
+    for (const auto& frame : frames) {
+        definition.rects.emplace_back(frame.at("x").get<int>(), frame.at("y").get<int>(),
+            frame.at("width").get<int>(), frame.at("height").get<int>());
+        const float duration = frame.value("duration", frameDuration);
+        if (!(duration > 0.0f) || !std::isfinite(duration)) {
+            return false;
+        }
+        definition.durations.push_back(duration);
+    }
+
+    if (data.contains("sprites")) {
+        for (const auto& sprite : data["sprites"]) {
+            definition.sprites.push_back(sprite.get<std::string>());
+        }
+    }
+    return true;
+}
+
+bool AnimationManager::CreateFromJson(const nlohmann::json& jsonData) {
+    try {
+        for (const auto& [animationId, animationData] : jsonData.items()) {
+            Definition definition;
+            if (!ParseDefinition(animationData, definition) || !AddAnimation(animationId, definition)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool AnimationManager::BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const {
+    try {
+        for (const auto& [animationId, animationData] : jsonData.items()) {
+            Definition definition;
+            if (!ParseDefinition(animationData, definition)) {
+                return false;
+            }
+
+            BakedAnimation record{};
+            record.animation = writer.AddString(animationId);
+            record.loop = writer.AddString(GetLoopModeName(definition.loop));
+            record.type = writer.AddString("frame");
+            record.name = writer.AddString(definition.image);
+            for (size_t i = 0; i < definition.rects.size(); ++i) {
+                record.x = definition.rects[i].left;
+                record.y = definition.rects[i].top;
+                record.width = definition.rects[i].width;
+                record.height = definition.rects[i].height;
+                record.duration = definition.durations[i];
+                writer.AddRecord(record);
+            }
+
+            record = BakedAnimation{ record.animation, writer.AddString("sprite"), 0, record.loop };
+            for (const std::string& sprite : definition.sprites) {
+                record.name = writer.AddString(sprite);
+                writer.AddRecord(record);
+            }
+        }
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool AnimationManager::CreateFromBaked(const Core::BakedSection& section) {
+    const BakedAnimation* records = section.GetRecords<BakedAnimation>();
+    if (!records && section.GetRecordCount() > 0) {
+        return false;
+    }
+
+    // The records of an animation are consecutive: its frames, then its sprites
+    size_t i = 0;
+    while (i < section.GetRecordCount()) {
+        const uint32_t animation = records[i].animation;
+        Definition definition;
+        if (!ParseLoopMode(section.GetString(records[i].loop), definition.loop)) {
+            return false;
+        }
+        for (; i < section.GetRecordCount() && records[i].animation == animation; ++i) {
+            const BakedAnimation& record = records[i];
+            const std::string name(section.GetString(record.name));
+            if (record.type == "sprite"_h) {
+                definition.sprites.push_back(name);
+            }
+            else {
+                definition.image = name;
+                definition.rects.emplace_back(record.x, record.y, record.width, record.height);
+                definition.durations.push_back(record.duration);
+            }
+        }
+        if (!AddAnimation(std::string(section.GetString(animation)), definition)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AnimationManager::AddAnimation(const std::string& animationId, const Definition& definition) {
+    if (definition.rects.empty()) {
+        return false;
+    }
+
+    const Core::Hash::HashValue imageHash = m_dataManager.RegisterString(definition.image);
+    auto region = m_imageManager.AcquireTexture(imageHash);
+    if (!region.texture) {
+        return false;
+    }
+
+    // Frames must lie within the image
+    const int imageWidth = std::abs(region.rect.width);
+    const int imageHeight = std::abs(region.rect.height);
+    for (const sf::IntRect& rect : definition.rects) {
+        if (rect.left < 0 || rect.top < 0 || rect.width <= 0 || rect.height <= 0
+            || rect.left + rect.width > imageWidth || rect.top + rect.height > imageHeight) {
+            return false;
+        }
+    }
+
+    std::vector<SpriteHandle> sprites;
+    for (const std::string& spriteId : definition.sprites) {
+        const SpriteHandle sprite = m_spriteManager.GetSprite(m_dataManager.RegisterString(spriteId));
+        if (!m_spriteManager.IsValid(sprite)) {
+            return false;
+        }
+        sprites.push_back(sprite);
+    }
+
+    const Core::Hash::HashValue name = m_dataManager.RegisterString(animationId);
+    auto [it, inserted] = m_animationsByName.try_emplace(name, static_cast<uint32_t>(m_animations.size()));
+    if (inserted) {
+        m_animations.emplace_back();
+    }
+    else {
+        // Remove the old frames, keeping the frames of every animation contiguous
+        const Animation& old = m_animations[it->second];
+        m_frames.erase(m_frames.begin() + old.firstFrame, m_frames.begin() + old.firstFrame + old.frameCount);
+        for (Animation& animation : m_animations) {
+            if (animation.firstFrame > old.firstFrame) {
+                animation.firstFrame -= old.frameCount;
+            }
+        }
+        // Sprites playing the old version start the new one from the beginning
+        for (size_t i = 0; i < m_players.sprites.size(); ++i) {
+            if (m_players.animations[i] == it->second && m_spriteManager.IsValid(m_players.sprites[i])) {
+                sprites.push_back(m_players.sprites[i]);
+            }
+        }
+    }
+
+    Animation& animation = m_animations[it->second];
+    animation.name = name;
+    animation.image = imageHash;
+    animation.texture = std::move(region.texture);
+    animation.imageRect = region.rect;
+    animation.firstFrame = static_cast<uint32_t>(m_frames.size());
+    animation.frameCount = static_cast<uint32_t>(definition.rects.size());
+    animation.loop = definition.loop;
+
+    float total = 0.0f;
+    for (size_t i = 0; i < definition.rects.size(); ++i) {
+        const sf::IntRect& rect = definition.rects[i];
+        m_frames.push_back({ sf::IntRect(region.rect.left + rect.left, region.rect.top + rect.top, rect.width, rect.height),
+            definition.durations[i] });
+        total += definition.durations[i];
+    }
+    if (animation.loop == LoopMode::Once) {
+        animation.cycleDuration = 0.0f;
+    }
+    else if (animation.loop == LoopMode::PingPong && animation.frameCount > 1) {
+        // Forwards, then backwards without repeating the end frames
+        animation.cycleDuration = 2.0f * total - definition.durations.front() - definition.durations.back();
+    }
+    else {
+        animation.cycleDuration = total;
+    }
+
+    for (SpriteHandle sprite : sprites) {
+        Play(sprite, name);
+    }
+    return true;
+}
+
+std::vector<Core::Hash::HashValue> AnimationManager::GetDependencies() const {
+    return { "images"_h, "sprites"_h };
+}
+
+Core::Hash::HashValue AnimationManager::GetManagedType() const {
+    return "animations"_h;
+}
+
+uint32_t AnimationManager::FindPlayer(SpriteHandle sprite) const {
+    if (sprite.index >= m_playersBySlot.size()) {
+        return NO_PLAYER;
+    }
+    const uint32_t player = m_playersBySlot[sprite.index];
+    return player != NO_PLAYER && m_players.sprites[player] == sprite ? player : NO_PLAYER;
+}
+
+bool AnimationManager::Play(SpriteHandle sprite, Core::Hash::HashValue animationName) {
+    SpriteStorage& storage = m_spriteManager.GetStorage();
+    auto it = m_animationsByName.find(animationName);
+    if (!storage.IsValid(sprite) || it == m_animationsByName.end()) {
+        return false;
+    }
+
+    // Only the first frame of an animation changes the sprite's image; later frames change its texture rectangle
+    const Animation& animation = m_animations[it->second];
+    const Frame& first = m_frames[animation.firstFrame];
+    if (storage.GetImage(sprite) != animation.image || storage.GetTexture(sprite) != animation.texture.get()) {
+        storage.SetImage(sprite, animation.image, animation.texture, first.rect);
+    }
+    else {
+        storage.SetTextureRect(sprite, first.rect);
+    }
+
+    // A slot has at most one player; it is reused if the slot's previous sprite was destroyed
+    if (sprite.index >= m_playersBySlot.size()) {
+        m_playersBySlot.resize(static_cast<size_t>(sprite.index) + 1, NO_PLAYER);
+    }
+    uint32_t& player = m_playersBySlot[sprite.index];
+    if (player == NO_PLAYER) {
+        player = static_cast<uint32_t>(m_players.sprites.size());
+        m_players.sprites.emplace_back();
+        m_players.animations.emplace_back();
+        m_players.frames.emplace_back();
+        m_players.timeLeft.emplace_back();
+        m_players.directions.emplace_back();
+    }
+    m_players.sprites[player] = sprite;
+    m_players.animations[player] = it->second;
+    m_players.frames[player] = 0;
+    m_players.timeLeft[player] = first.duration;
+    m_players.directions[player] = 1;
+    MarkDirty();
+    return true;
+}
+
+bool AnimationManager::Stop(SpriteHandle sprite) {
+    const uint32_t player = FindPlayer(sprite);
+    if (player == NO_PLAYER) {
+        return false;
+    }
+    RemovePlayer(player);
+    MarkDirty();
+    return true;
+}
+
+uint32_t AnimationManager::GetFrame(SpriteHandle sprite) const {
+    const uint32_t player = FindPlayer(sprite);
+    return player != NO_PLAYER ? m_players.frames[player] : 0;
+}
+
+void AnimationManager::RemovePlayer(uint32_t player) {
+    // Move the last player into the gap
+    const uint32_t last = static_cast<uint32_t>(m_players.sprites.size() - 1);
+    m_playersBySlot[m_players.sprites[player].index] = NO_PLAYER;
+    if (player != last) {
+        m_players.sprites[player] = m_players.sprites[last];
+        m_players.animations[player] = m_players.animations[last];
+        m_players.frames[player] = m_players.frames[last];
+        m_players.timeLeft[player] = m_players.timeLeft[last];
+        m_players.directions[player] = m_players.directions[last];
+        m_playersBySlot[m_players.sprites[player].index] = player;
+    }
+    m_players.sprites.pop_back();
+    m_players.animations.pop_back();
+    m_players.frames.pop_back();
+    m_players.timeLeft.pop_back();
+    m_players.directions.pop_back();
+}
+
+size_t AnimationManager::Update(float seconds) {
+    size_t changed = 0;
+    std::vector<float>& timeLeft = m_players.timeLeft;
+    for (uint32_t player = 0; player < timeLeft.size();) {
+        timeLeft[player] -= seconds;
+        if (timeLeft[player] > 0.0f || AdvanceFrame(player, changed)) {
+            ++player;
+        }
+        // Otherwise the player was removed, and the last one moved into its place
+    }
+    return changed;
+}
+
+bool AnimationManager::AdvanceFrame(uint32_t player, size_t& changed) {
+    SpriteStorage& storage = m_spriteManager.GetStorage();
+    const SpriteHandle sprite = m_players.sprites[player];
+    if (!storage.IsValid(sprite)) {
+        RemovePlayer(player);
+        MarkDirty();
+        return false;
+    }
+
+    // A sprite given another image since Play no longer shows the animation's texture
+    const Animation& animation = m_animations[m_players.animations[player]];
+    if (storage.GetImage(sprite) != animation.image || storage.GetTexture(sprite) != animation.texture.get()) {
+        RemovePlayer(player);
+        MarkDirty();
+        return false;
+    }
+    float time = m_players.timeLeft[player];
+    uint32_t frame = m_players.frames[player];
+    int8_t direction = m_players.directions[player];
+
+    // After a long pause, skip the whole cycles first
+    if (animation.cycleDuration > 0.0f && -time >= animation.cycleDuration) {
+        time = -std::fmod(-time, animation.cycleDuration);
+    }
+
+    bool finished = false;
+    while (time <= 0.0f) {
+        if (animation.frameCount == 1) {
+            finished = animation.loop == LoopMode::Once;
+        }
+        else if (animation.loop == LoopMode::Loop) {
+            frame = frame + 1 < animation.frameCount ? frame + 1 : 0;
+        }
+        else if (animation.loop == LoopMode::Once) {
+            if (frame + 1 == animation.frameCount) {
+                finished = true;
+            }
+            else {
+                ++frame;
+            }
+        }
+        else {
+            if ((direction > 0 && frame + 1 == animation.frameCount) || (direction < 0 && frame == 0)) {
+                direction = -direction;
+            }
+            frame += direction;
+        }
+        if (finished) {
+            break;
+        }
+        time += m_frames[animation.firstFrame + frame].duration;
+    }
+
+    if (frame != m_players.frames[player]) {
+        storage.SetTextureRect(sprite, m_frames[animation.firstFrame + frame].rect);
+        ++changed;
+    }
+    if (finished) {
+        // Stays on the last frame, and is no longer saved as playing
+        RemovePlayer(player);
+        MarkDirty();
+        return false;
+    }
+    m_players.timeLeft[player] = time;
+    m_players.frames[player] = frame;
+    m_players.directions[player] = direction;
+    return true;
+}
+
+void AnimationManager::Clear() {
+    m_animations.clear();
+    m_frames.clear();
+    m_animationsByName.clear();
+    m_players = Players();
+    m_playersBySlot.clear();
+    MarkDirty();
+}
+
+namespace {
+
+// What AnimationManager saves of one frame
+struct FrameRecord {
+    sf::IntRect rect; ///< Within the image
+    float duration;
+};
+
+// What AnimationManager saves of one animation
+struct AnimationRecord {
+    Core::Hash::HashValue animation;
+    Core::Hash::HashValue image;
+    const char* loop;
+    std::vector<FrameRecord> frames;
+    std::vector<Core::Hash::HashValue> sprites; ///< Names of the sprites playing it, in slot order
+};
+
+// Copy of the animations and the sprites playing them, written by the autosave worker
+class AnimationSnapshot : public Core::ManagerSnapshot {
+public:
+    AnimationSnapshot(std::vector<AnimationRecord> records, const Core::DataManager& dataManager)
+        : m_records(std::move(records))
+        , m_dataManager(dataManager)
+    {
+    }
+
+    void WriteJson(Core::JsonWriter& writer) const override {
+        // Sorted by animation id like the keys of a dumped tree
+        std::vector<std::pair<std::string_view, const AnimationRecord*>> sorted;
+        sorted.reserve(m_records.size());
+        for (const AnimationRecord& record : m_records) {
+            sorted.emplace_back(m_dataManager.GetString(record.animation), &record);
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        writer.StartObject();
+        for (const auto& [name, animation] : sorted) {
+            const AnimationRecord& record = *animation;
+            writer.Key(name);
+            writer.StartObject();
+            writer.Key("frames");
+            writer.StartArray();
+            for (const FrameRecord& frame : record.frames) {
+                writer.StartObject();
+                writer.Key("duration");
+                writer.Float(frame.duration);
+                writer.Key("height");
+                writer.Integer(frame.rect.height);
+                writer.Key("width");
+                writer.Integer(frame.rect.width);
+                writer.Key("x");
+                writer.Integer(frame.rect.left);
+                writer.Key("y");
+                writer.Integer(frame.rect.top);
+                writer.EndObject();
+            }
+            writer.EndArray();
+            writer.Key("image");
+            writer.String(m_dataManager.GetString(record.image));
+            writer.Key("loop");
+            writer.String(record.loop);
+            writer.Key("sprites");
+            writer.StartArray();
+            for (Core::Hash::HashValue sprite : record.sprites) {
+                writer.String(m_dataManager.GetString(sprite));
+            }
+            writer.EndArray();
+            writer.EndObject();
+        }
+        writer.EndObject();
+    }
+
+private:
+    std::vector<AnimationRecord> m_records;
+    const Core::DataManager& m_dataManager;
+};
+
+} // namespace
+
+uint64_t AnimationManager::GetGeneration() const {
+    // Both counters only grow, so their sum changes whenever either does; destroying or
+    // renaming a sprite changes the saved "sprites" lists before its player is removed
+    return m_generation + m_spriteManager.GetGeneration();
+}
+
+nlohmann::json AnimationManager::SerializeToJson() {
+    return Core::JsonWriter::ToJson([this](Core::JsonWriter& writer) { WriteJson(writer); });
+}
+
+void AnimationManager::WriteJson(Core::JsonWriter& writer) {
+    CreateSnapshot()->WriteJson(writer);
+}
+
+std::unique_ptr<Core::ManagerSnapshot> AnimationManager::CreateSnapshot() {
+    // Sprites listed in slot order, so saves do not depend on the order Play was called in
+    std::vector<std::pair<uint32_t, uint32_t>> playing; // Animation and slot
+    for (size_t i = 0; i < m_players.sprites.size(); ++i) {
+        if (m_spriteManager.IsValid(m_players.sprites[i])) {
+            playing.emplace_back(m_players.animations[i], m_players.sprites[i].index);
+        }
+    }
+    std::sort(playing.begin(), playing.end());
+
+    const SpriteStorage& storage = m_spriteManager.GetStorage();
+    auto next = playing.begin();
+    std::vector<AnimationRecord> records;
+    records.reserve(m_animations.size());
+    for (uint32_t index = 0; index < m_animations.size(); ++index) {
+        const Animation& animation = m_animations[index];
+        AnimationRecord record{ animation.name, animation.image, GetLoopModeName(animation.loop), {}, {} };
+        record.frames.reserve(animation.frameCount);
+        for (uint32_t i = 0; i < animation.frameCount; ++i) {
+            const Frame& frame = m_frames[animation.firstFrame + i];
+            const sf::IntRect rect(frame.rect.left - animation.imageRect.left, frame.rect.top - animation.imageRect.top,
+                frame.rect.width, frame.rect.height);
+            record.frames.push_back({ rect, frame.duration });
+        }
+        for (; next != playing.end() && next->first == index; ++next) {
+            record.sprites.push_back(storage.GetNames()[next->second]);
+        }
+        records.push_back(std::move(record));
+    }
+    return std::make_unique<AnimationSnapshot>(std::move(records), m_dataManager);
+}
+
+} // namespace Graphics
+} // namespace ShoeEngine
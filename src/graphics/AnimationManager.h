@@ -0,0 +1,277 @@
+#pragma once
+
+#include "core/BaseManager.h"
+#include "graphics/ImageManager.h"
+#include "graphics/SpriteManager.h"
+#include "core/DataManager.h"
+#include "core/FlatHashMap.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+/**
+ * @class AnimationManager
+ * @brief Plays sprite-sheet animations, defined in JSON, on the sprites of a SpriteManager
+ *
+ * An animation is a sequence of frames within one image, each a rectangle of the image
+ * shown for a duration, and a loop mode. Playing an animation on a sprite makes it show the
+ * animation's image; from then on, changing frames only changes the sprite's texture
+ * rectangle, so textures are never uploaded again.
+ *
+ * The state of every playing sprite lives in parallel arrays, and Update advances all of
+ * them in one pass. Sprites whose frame does not change only cost a subtraction.
+ *
+ * @example
+ * animationManager.Play(spriteManager.GetSprite("hero"_h), "hero_walk"_h);
+ * // Every frame:
+ * animationManager.Update(elapsedSeconds);
+ * spriteManager.Render(window);
+ */
+class AnimationManager : public Core::BaseManager {
+public:
+    /**
+     * @enum LoopMode
+     * @brief What an animation does after its last frame
+     */
+    enum class LoopMode : uint8_t {
+        Loop,    ///< Starts again from the first frame
+        Once,    ///< Stops on the last frame
+        PingPong ///< Plays backwards to the first frame, then forwards again
+    };
+
+    /**
+     * @struct BakedAnimation
+     * @brief Fixed-layout record of one frame, or one sprite playing the animation, in a baked data file
+     */
+    struct BakedAnimation {
+        uint32_t animation; ///< Hash of the animation id
+        uint32_t type;      ///< Hash of "frame", or of "sprite" for a sprite that starts playing the animation
+        uint32_t name;      ///< Hash of the image id for frames, of the sprite id for sprites
+        uint32_t loop;      ///< Hash of the loop mode
+        int32_t x = 0;      ///< Frame rectangle within the image, in pixels
+        int32_t y = 0;
+        int32_t width = 0;
+        int32_t height = 0;
+        float duration = 0.0f; ///< Frame duration in seconds
+    };
+
+    /**
+     * @brief Duration of frames that set none, and of animations that set no "frameDuration"
+     */
+    static constexpr float DEFAULT_FRAME_DURATION = 0.1f;
+
+    /**
+     * @brief Constructor taking references to required managers
+     * @param dataManager Reference to the DataManager for string registration
+     * @param imageManager Reference to the ImageManager providing the animations' textures
+     * @param spriteManager Reference to the SpriteManager whose sprites are animated
+     */
+    AnimationManager(Core::DataManager& dataManager, ImageManager& imageManager, SpriteManager& spriteManager);
+
+    /**
+     * @brief Creates animations from JSON data, replacing animations with the same id
+     * @param jsonData JSON object of animation definitions keyed by animation id
+     * @return bool True if all animations were valid and created
+     */
+    bool CreateFromJson(const nlohmann::json& jsonData) override;
+
+    /**
+     * @brief Creates animations from a baked "animations" section
+     * @param section Section of BakedAnimation records
+     * @return bool True if all animations were created
+     */
+    bool CreateFromBaked(const Core::BakedSection& section) override;
+
+    /**
+     * @brief Bakes an "animations" JSON section into BakedAnimation records
+     * @param jsonData JSON object of animation definitions
+     * @param writer Receives the records
+     * @return bool True if the section was valid
+     */
+    bool BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const override;
+
+    /**
+     * @brief Animations use images, and may start playing on sprites when loaded
+     * @return Hashes of "images" and "sprites"
+     */
+    std::vector<Core::Hash::HashValue> GetDependencies() const override;
+
+    /**
+     * @brief Animations acquire their textures, so they load on the main thread
+     * @return true
+     */
+    bool RequiresMainThread() const override { return true; }
+
+    /**
+     * @brief Get the type of objects this manager handles
+     * @return Core::Hash::HashValue Hash of "animations"
+     */
+    Core::Hash::HashValue GetManagedType() const override;
+
+    /**
+     * @brief Whether an animation exists
+     * @param animation Hash of the animation id
+     * @return bool True if it was created
+     */
+    bool HasAnimation(Core::Hash::HashValue animation) const { return m_animationsByName.find(animation) != m_animationsByName.end(); }
+
+    /**
+     * @brief Gets the number of animations
+     * @return Animation count
+     */
+    size_t GetAnimationCount() const { return m_animations.size(); }
+
+    /**
+     * @brief Starts playing an animation on a sprite from its first frame
+     * @param sprite The sprite; any animation it was playing stops
+     * @param animation Hash of the animation id
+     * @return bool False if the sprite or the animation does not exist
+     */
+    bool Play(SpriteHandle sprite, Core::Hash::HashValue animation);
+
+    /**
+     * @brief Stops the animation of a sprite, which keeps showing its current frame
+     * @param sprite The sprite
+     * @return bool True if the sprite was playing an animation
+     */
+    bool Stop(SpriteHandle sprite);
+
+    /**
+     * @brief Whether a sprite is playing an animation
+     * @param sprite The sprite
+     * @return bool False once an animation played Once has finished, or the sprite was destroyed
+     */
+    bool IsPlaying(SpriteHandle sprite) const { return FindPlayer(sprite) != NO_PLAYER && m_spriteManager.IsValid(sprite); }
+
+    /**
+     * @brief Gets the frame a sprite shows
+     * @param sprite A sprite playing an animation
+     * @return Index of the frame within the animation, or 0 if the sprite is not playing
+     */
+    uint32_t GetFrame(SpriteHandle sprite) const;
+
+    /**
+     * @brief Gets the number of sprites playing an animation
+     * @return Sprite count
+     */
+    size_t GetPlayingCount() const { return m_players.sprites.size(); }
+
+    /**
+     * @brief Advances every playing animation
+     * @param seconds Time since the last update
+     * @return Number of sprites whose frame changed
+     *
+     * Sprites destroyed through the SpriteManager, or given another image, stop playing at
+     * their next frame change.
+     */
+    size_t Update(float seconds);
+
+    /**
+     * @brief Removes all animations and stops all sprites
+     */
+    void Clear() override;
+
+    /**
+     * @brief Serialize all animations to JSON
+     * @return nlohmann::json JSON object in the format read by CreateFromJson
+     */
+    nlohmann::json SerializeToJson() override;
+
+    /**
+     * @brief Write all animations straight into a JSON writer
+     * @param writer Receives an object keyed by animation id; "sprites" lists the sprites playing each
+     */
+    void WriteJson(Core::JsonWriter& writer) override;
+
+    /**
+     * @brief Copies the animations' frames and the names of the sprites playing them
+     * @return Snapshot writing the same JSON as WriteJson
+     */
+    std::unique_ptr<Core::ManagerSnapshot> CreateSnapshot() override;
+
+    /**
+     * @brief Creating animations and starting or stopping them bump the generation; frame changes do not
+     * @return true
+     */
+    bool TracksChanges() const override { return true; }
+
+    /**
+     * @brief Follows the SpriteManager's generation too, since the saved sprite lists name its sprites
+     * @return Sum of both generations
+     */
+    uint64_t GetGeneration() const override;
+
+private:
+    static constexpr uint32_t NO_PLAYER = UINT32_MAX;
+
+    struct Frame {
+        sf::IntRect rect; ///< Area of the texture, including the image's offset in its atlas
+        float duration;
+    };
+
+    struct Animation {
+        Core::Hash::HashValue name;
+        Core::Hash::HashValue image;
+        std::shared_ptr<const sf::Texture> texture;
+        sf::IntRect imageRect; ///< Area of the texture covered by the image
+        uint32_t firstFrame;   ///< Index of the first frame in m_frames
+        uint32_t frameCount;
+        float cycleDuration;   ///< Time until the animation repeats; 0 for Once
+        LoopMode loop;
+    };
+
+    /**
+     * @struct Definition
+     * @brief An animation as read from JSON or baked records
+     */
+    struct Definition {
+        std::string image;
+        LoopMode loop = LoopMode::Loop;
+        std::vector<sf::IntRect> rects; ///< Within the image
+        std::vector<float> durations;
+        std::vector<std::string> sprites;
+    };
+
+    // Playing sprites, one entry per sprite in each array
+    struct Players {
+        std::vector<SpriteHandle> sprites;
+        std::vector<uint32_t> animations; ///< Index in m_animations
+        std::vector<uint32_t> frames;     ///< Frame within the animation
+        std::vector<float> timeLeft;      ///< Time until the next frame
+        std::vector<int8_t> directions;   ///< 1 forwards, -1 backwards in PingPong
+    };
+
+    static bool ParseDefinition(const nlohmann::json& data, Definition& definition);
+    static bool ParseLoopMode(std::string_view name, LoopMode& loop);
+    static const char* GetLoopModeName(LoopMode loop);
+
+    /**
+     * @brief Creates or replaces an animation and starts it on its sprites
+     */
+    bool AddAnimation(const std::string& animationId, const Definition& definition);
+
+    uint32_t FindPlayer(SpriteHandle sprite) const;
+    void RemovePlayer(uint32_t player);
+
+    /**
+     * @brief Moves a player whose frame has run out to the frame its time falls in
+     * @param changed Incremented if the sprite's frame changed
+     * @return bool False if the player was removed, because its animation finished or its sprite is gone
+     */
+    bool AdvanceFrame(uint32_t player, size_t& changed);
+
+    ImageManager& m_imageManager;
+    SpriteManager& m_spriteManager;
+    std::vector<Animation> m_animations;
+    std::vector<Frame> m_frames; ///< Frames of all animations, each animation's contiguous
+    Core::FlatHashMap<Core::Hash::HashValue, uint32_t> m_animationsByName;
+    Players m_players;
+    std::vector<uint32_t> m_playersBySlot; ///< Player of each sprite slot, or NO_PLAYER
+};
+
+} // namespace Graphics
+} // namespace ShoeEngine
@@ -0,0 +1,153 @@
+#include "AtlasPacker.h"
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+AtlasPacker::AtlasPacker()
+    : m_settings()
+{
+}
+
+AtlasPacker::AtlasPacker(const Settings& settings)
+    : m_settings(settings)
+{
+}
+
+bool AtlasPacker::Pack(const std::vector<sf::Vector2u>& sizes)
+{
+    m_placements.assign(sizes.size(), Placement{});
+    m_pages.clear();
+
+    // Padding is added to the right and bottom of every rectangle and the whole packing
+    // area is offset by one padding, so every rectangle is surrounded by empty pixels.
+    const int padding = static_cast<int>(m_settings.padding);
+    const int area = static_cast<int>(m_settings.maxPageSize) - padding;
+
+    std::vector<size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), size_t{ 0 });
+    std::stable_sort(order.begin(), order.end(), [&sizes](size_t lhs, size_t rhs) {
+        if (sizes[lhs].y != sizes[rhs].y) {
+            return sizes[lhs].y > sizes[rhs].y;
+        }
+        return sizes[lhs].x > sizes[rhs].x;
+    });
+
+    std::vector<std::vector<SkylineNode>> skylines;
+    for (size_t index : order) {
+        if (!Fits(sizes[index])) {
+            m_placements.clear();
+            m_pages.clear();
+            return false;
+        }
+        const int width = static_cast<int>(sizes[index].x) + padding;
+        const int height = static_cast<int>(sizes[index].y) + padding;
+
+        size_t page = 0;
+        size_t node = 0;
+        int y = 0;
+        while (page < skylines.size() && !FindPosition(skylines[page], width, height, node, y)) {
+            ++page;
+        }
+        if (page == skylines.size()) {
+            skylines.push_back({ SkylineNode{ 0, 0, area } });
+            m_pages.push_back(Page{});
+            FindPosition(skylines[page], width, height, node, y);
+        }
+
+        const int x = skylines[page][node].x;
+        AddToSkyline(skylines[page], node, y, width, height);
+
+        Placement& placement = m_placements[index];
+        placement.page = static_cast<uint32_t>(page);
+        placement.rect = sf::IntRect(x + padding, y + padding,
+            static_cast<int>(sizes[index].x), static_cast<int>(sizes[index].y));
+
+        Page& used = m_pages[page];
+        used.width = std::max(used.width, static_cast<unsigned int>(x + width + padding));
+        used.height = std::max(used.height, static_cast<unsigned int>(y + height + padding));
+    }
+
+    return true;
+}
+
+bool AtlasPacker::Fits(const sf::Vector2u& size) const
+{
+    // The rectangle and its padding must fit in the page minus its border padding
+    const unsigned int area = m_settings.maxPageSize - std::min(m_settings.padding, m_settings.maxPageSize);
+    return size.x + m_settings.padding <= area && size.y + m_settings.padding <= area;
+}
+
+bool AtlasPacker::FindPosition(const std::vector<SkylineNode>& skyline, int width, int height,
+    size_t& bestIndex, int& bestY) const
+{
+    const int area = static_cast<int>(m_settings.maxPageSize) - static_cast<int>(m_settings.padding);
+    int bestBottom = std::numeric_limits<int>::max();
+    int bestWidth = std::numeric_limits<int>::max();
+    bool found = false;
+
+    for (size_t i = 0; i < skyline.size(); ++i) {
+        if (skyline[i].x + width > area) {
+            break;
+        }
+
+        // The rectangle rests on the highest node it spans.
+        int y = 0;
+        int remaining = width;
+        for (size_t j = i; remaining > 0; ++j) {
+            y = std::max(y, skyline[j].y);
+            remaining -= skyline[j].width;
+        }
+        if (y + height > area) {
+            continue;
+        }
+
+        const int bottom = y + height;
+        if (bottom < bestBottom || (bottom == bestBottom && skyline[i].width < bestWidth)) {
+            bestBottom = bottom;
+            bestWidth = skyline[i].width;
+            bestIndex = i;
+            bestY = y;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void AtlasPacker::AddToSkyline(std::vector<SkylineNode>& skyline, size_t index, int y, int width, int height)
+{
+    const SkylineNode node{ skyline[index].x, y + height, width };
+    skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(index), node);
+
+    // Trim or remove the nodes now covered by the new one.
+    for (size_t i = index + 1; i < skyline.size();) {
+        const int coveredUntil = skyline[i - 1].x + skyline[i - 1].width;
+        if (skyline[i].x >= coveredUntil) {
+            break;
+        }
+        const int shrink = coveredUntil - skyline[i].x;
+        if (skyline[i].width <= shrink) {
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        skyline[i].x += shrink;
+        skyline[i].width -= shrink;
+        break;
+    }
+
+    // Merge neighbours at the same height.
+    for (size_t i = 0; i + 1 < skyline.size();) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else {
+            ++i;
+        }
+    }
+}
+
+} // namespace Graphics
+} // namespace ShoeEngine
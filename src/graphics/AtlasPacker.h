@@ -0,0 +1,135 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+/**
+ * @class AtlasPacker
+ * @brief Packs rectangles into one or more texture atlas pages
+ *
+ * Uses a skyline bottom-left packer: each page keeps the upper contour of the rectangles
+ * placed so far, and every new rectangle goes where its top edge ends up lowest. Rectangles
+ * are packed tallest first. Ties are broken by width and then by input order, so the same
+ * input always produces the same placements and the output can be cached.
+ *
+ * A rectangle that does not fit on any open page opens a new page. Pages are trimmed to
+ * the area actually used.
+ *
+ * @example
+ * AtlasPacker packer;
+ * if (packer.Pack({ { 32, 32 }, { 64, 16 } })) {
+ *     const auto& placement = packer.GetPlacements()[0];
+ * }
+ */
+class AtlasPacker {
+public:
+    /**
+     * @struct Settings
+     * @brief Limits applied to every atlas page
+     */
+    struct Settings {
+        unsigned int maxPageSize = 2048; ///< Maximum width and height of a page in pixels
+        unsigned int padding = 1;        ///< Empty pixels between rectangles and around the page border
+    };
+
+    /**
+     * @struct Placement
+     * @brief Where a rectangle ended up
+     */
+    struct Placement {
+        uint32_t page = 0; ///< Index of the page holding the rectangle
+        sf::IntRect rect;  ///< Position and size of the rectangle on the page in pixels
+    };
+
+    /**
+     * @struct Page
+     * @brief Size of a packed page
+     */
+    struct Page {
+        unsigned int width = 0;  ///< Width of the used area including padding
+        unsigned int height = 0; ///< Height of the used area including padding
+    };
+
+    /**
+     * @brief Default constructor using the default page limits
+     */
+    AtlasPacker();
+
+    /**
+     * @brief Constructor
+     * @param settings Page limits used by Pack()
+     */
+    explicit AtlasPacker(const Settings& settings);
+
+    /**
+     * @brief Packs rectangles, replacing the result of any previous call
+     * @param sizes Width and height of every rectangle in pixels
+     * @return True if every rectangle was placed, false if one is larger than a page
+     */
+    bool Pack(const std::vector<sf::Vector2u>& sizes);
+
+    /**
+     * @brief Checks whether a rectangle fits on a page
+     * @param size Width and height of the rectangle in pixels
+     * @return True if Pack() can place it; Pack() fails exactly when one of its rectangles does not fit
+     */
+    bool Fits(const sf::Vector2u& size) const;
+
+    /**
+     * @brief Gets the placement of each rectangle, in the order passed to Pack()
+     * @return Placements of the last successful Pack()
+     */
+    const std::vector<Placement>& GetPlacements() const { return m_placements; }
+
+    /**
+     * @brief Gets the pages created by the last Pack()
+     * @return Page sizes, indexed by Placement::page
+     */
+    const std::vector<Page>& GetPages() const { return m_pages; }
+
+    /**
+     * @brief Gets the settings used by the packer
+     * @return Page limits
+     */
+    const Settings& GetSettings() const { return m_settings; }
+
+private:
+    struct SkylineNode {
+        int x;
+        int y;
+        int width;
+    };
+
+    /**
+     * @brief Finds the lowest position where a rectangle fits on a page
+     * @param skyline Contour of the page
+     * @param width Padded width of the rectangle
+     * @param height Padded height of the rectangle
+     * @param bestIndex Output index of the skyline node the rectangle starts at
+     * @param bestY Output top of the rectangle
+     * @return True if the rectangle fits on the page
+     */
+    bool FindPosition(const std::vector<SkylineNode>& skyline, int width, int height,
+        size_t& bestIndex, int& bestY) const;
+
+    /**
+     * @brief Raises the skyline of a page over a newly placed rectangle
+     * @param skyline Contour of the page
+     * @param index Skyline node the rectangle starts at
+     * @param y Top of the rectangle
+     * @param width Padded width of the rectangle
+     * @param height Padded height of the rectangle
+     */
+    static void AddToSkyline(std::vector<SkylineNode>& skyline, size_t index, int y, int width, int height);
+
+    Settings m_settings;
+    std::vector<Placement> m_placements;
+    std::vector<Page> m_pages;
+};
+
+} // namespace Graphics
+} // namespace ShoeEngine
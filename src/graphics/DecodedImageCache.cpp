@@ -0,0 +1,170 @@
+#include "DecodedImageCache.h"
+#include "core/Hash.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+namespace {
+
+constexpr char BLOB_MAGIC[8] = { 'S', 'H', 'O', 'E', 'I', 'M', 'G', '1' };
+
+/**
+ * @brief Fixed-size blob header, followed by the source path and the RGBA pixels
+ */
+struct BlobHeader {
+    char magic[8];
+    uint64_t sourceSize;
+    int64_t sourceModifiedTime;
+    uint32_t width;
+    uint32_t height;
+    uint32_t pathLength;
+    uint32_t reserved;
+};
+static_assert(sizeof(BlobHeader) == 40, "Blob header layout must not depend on the compiler");
+
+} // namespace
+
+DecodedImageCache::DecodedImageCache(const std::filesystem::path& directory)
+    : m_directory(directory)
+{
+}
+
+bool DecodedImageCache::GetSourceKey(const std::string& sourcePath, SourceKey& key)
+{
+    std::error_code error;
+    const auto fileSize = std::filesystem::file_size(sourcePath, error);
+    if (error) {
+        return false;
+    }
+    const auto modifiedTime = std::filesystem::last_write_time(sourcePath, error);
+    if (error) {
+        return false;
+    }
+    key.fileSize = static_cast<uint64_t>(fileSize);
+    key.modifiedTime = static_cast<int64_t>(modifiedTime.time_since_epoch().count());
+    return true;
+}
+
+std::filesystem::path DecodedImageCache::GetEntryPath(const std::string& sourcePath) const
+{
+    char name[16];
+    std::snprintf(name, sizeof(name), "%08x", static_cast<uint32_t>(Core::Hash::HashValue(sourcePath)));
+    return m_directory / (std::string(name) + ".rgba");
+}
+
+bool DecodedImageCache::Load(const std::string& sourcePath, Image& image)
+{
+    SourceKey key;
+    if (!GetSourceKey(sourcePath, key)) {
+        ++m_misses;
+        return false;
+    }
+
+    std::ifstream file(GetEntryPath(sourcePath), std::ios::binary | std::ios::ate);
+    if (!file) {
+        ++m_misses;
+        return false;
+    }
+
+    // Read the whole blob with one call
+    const std::streamoff blobSize = file.tellg();
+    std::vector<uint8_t> blob(blobSize > 0 ? static_cast<size_t>(blobSize) : 0);
+    file.seekg(0);
+    const bool readOk = !blob.empty() && file.read(reinterpret_cast<char*>(blob.data()), blobSize);
+
+    BlobHeader header{};
+    bool valid = readOk && blob.size() >= sizeof(BlobHeader);
+    if (valid) {
+        std::memcpy(&header, blob.data(), sizeof(BlobHeader));
+        const uint64_t pixelBytes = static_cast<uint64_t>(header.width) * header.height * 4;
+        valid = std::memcmp(header.magic, BLOB_MAGIC, sizeof(BLOB_MAGIC)) == 0
+            && header.width > 0 && header.height > 0
+            && blob.size() == sizeof(BlobHeader) + header.pathLength + pixelBytes
+            && header.pathLength == sourcePath.size()
+            && std::memcmp(blob.data() + sizeof(BlobHeader), sourcePath.data(), sourcePath.size()) == 0
+            && header.sourceSize == key.fileSize
+            && header.sourceModifiedTime == key.modifiedTime;
+    }
+    if (!valid) {
+        ++m_misses;
+        ++m_stale;
+        return false;
+    }
+
+    const uint8_t* pixels = blob.data() + sizeof(BlobHeader) + header.pathLength;
+    if (!image.LoadFromPixels(pixels, header.width, header.height)) {
+        ++m_misses;
+        ++m_stale;
+        return false;
+    }
+    image.SetFilePath(sourcePath);
+    ++m_hits;
+    return true;
+}
+
+bool DecodedImageCache::Store(const std::string& sourcePath, const Image& image)
+{
+    SourceKey key;
+    if (!GetSourceKey(sourcePath, key) || !image.GetPixels() || image.GetWidth() == 0 || image.GetHeight() == 0) {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+    if (error) {
+        return false;
+    }
+
+    BlobHeader header{};
+    std::memcpy(header.magic, BLOB_MAGIC, sizeof(BLOB_MAGIC));
+    header.sourceSize = key.fileSize;
+    header.sourceModifiedTime = key.modifiedTime;
+    header.width = image.GetWidth();
+    header.height = image.GetHeight();
+    header.pathLength = static_cast<uint32_t>(sourcePath.size());
+
+    // Write next to the final entry and rename, so readers never see a partial blob
+    const std::filesystem::path entryPath = GetEntryPath(sourcePath);
+    std::filesystem::path tempPath = entryPath;
+    tempPath += ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(sourcePath.data(), static_cast<std::streamsize>(sourcePath.size()));
+        file.write(reinterpret_cast<const char*>(image.GetPixels()),
+            static_cast<std::streamsize>(static_cast<size_t>(header.width) * header.height * 4));
+        if (!file) {
+            file.close();
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, entryPath, error);
+    if (error) {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    ++m_stores;
+    return true;
+}
+
+DecodedImageCache::Stats DecodedImageCache::GetStats() const
+{
+    Stats stats;
+    stats.hits = m_hits.load();
+    stats.misses = m_misses.load();
+    stats.stale = m_stale.load();
+    stats.stores = m_stores.load();
+    return stats;
+}
+
+} // namespace Graphics
+} // namespace ShoeEngine
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Image.h"
+#include <atomic>
+#include <filesystem>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+/**
+ * @class DecodedImageCache
+ * @brief On-disk cache of decoded RGBA pixels that lets startup skip image decoding
+ *
+ * Every source file gets one blob in the cache directory, named after the hash of its
+ * path. The blob header stores the source path, file size and modification time next to
+ * the image dimensions. An entry is only used if all of them still match the source file
+ * and the blob has exactly the expected size. Otherwise Load() reports a miss and the
+ * caller decodes the source as usual.
+ *
+ * Blobs are read with a single read call straight into one buffer. They are written
+ * to a temporary file and renamed into place, so a crash mid-write never leaves a
+ * partial entry behind.
+ *
+ * Load() and Store() may be called concurrently for different source files.
+ *
+ * @example
+ * DecodedImageCache cache("data/cache/images");
+ * if (!cache.Load(path, image) && image.LoadFromFile(path)) {
+ *     cache.Store(path, image);
+ * }
+ */
+class DecodedImageCache {
+public:
+    /**
+     * @struct Stats
+     * @brief Counters since construction
+     */
+    struct Stats {
+        size_t hits = 0;    ///< Entries loaded from the cache
+        size_t misses = 0;  ///< Lookups without a usable entry (missing, stale or corrupt)
+        size_t stale = 0;   ///< Misses caused by an out-of-date or corrupt entry
+        size_t stores = 0;  ///< Entries written
+    };
+
+    /**
+     * @brief Constructor
+     * @param directory Directory holding the cache blobs; created on first Store()
+     */
+    explicit DecodedImageCache(const std::filesystem::path& directory);
+
+    /**
+     * @brief Loads the cached pixels of a source file
+     * @param sourcePath Path of the source image file
+     * @param image Receives the pixels and source path on success; untouched otherwise
+     * @return True on a cache hit, false if the source must be decoded
+     */
+    bool Load(const std::string& sourcePath, Image& image);
+
+    /**
+     * @brief Writes the decoded pixels of a source file to the cache
+     * @param sourcePath Path of the source image file
+     * @param image The decoded image
+     * @return True if the entry was written
+     */
+    bool Store(const std::string& sourcePath, const Image& image);
+
+    /**
+     * @brief Gets the path of the blob caching a source file
+     * @param sourcePath Path of the source image file
+     * @return Path of the cache blob
+     */
+    std::filesystem::path GetEntryPath(const std::string& sourcePath) const;
+
+    /**
+     * @brief Gets the cache directory
+     * @return Directory holding the cache blobs
+     */
+    const std::filesystem::path& GetDirectory() const { return m_directory; }
+
+    /**
+     * @brief Gets the counters since construction
+     * @return Snapshot of the cache statistics
+     */
+    Stats GetStats() const;
+
+private:
+    /**
+     * @brief Identity of a source file an entry was created from
+     */
+    struct SourceKey {
+        uint64_t fileSize = 0;
+        int64_t modifiedTime = 0;
+    };
+
+    /**
+     * @brief Reads the size and modification time of a source file
+     * @param sourcePath Path of the source image file
+     * @param key Receives the identity of the file
+     * @return True if the file exists
+     */
+    static bool GetSourceKey(const std::string& sourcePath, SourceKey& key);
+
+    std::filesystem::path m_directory;
+    std::atomic<size_t> m_hits{ 0 };
+    std::atomic<size_t> m_misses{ 0 };
+    std::atomic<size_t> m_stale{ 0 };
+    std::atomic<size_t> m_stores{ 0 };
+};
+
+} // namespace Graphics
+} // namespace ShoeEngine
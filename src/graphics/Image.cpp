@@ -34,6 +34,27 @@ bool Image::LoadFromFile(const std::string& filePath)
 	return m_image->loadFromFile(filePath);
 }
 
+bool Image::LoadFromPixels(const uint8_t* pixels, unsigned int width, unsigned int height)
+{
+    if (!pixels || width == 0 || height == 0) {
+        return false;
+    }
+    m_image->create(width, height, pixels);
+    return true;
+}
+
+void Image::Unload()
+{
+    // Emptied in place, so references from GetSFMLImage() stay valid; creating a 0x0
+    // image frees the pixel buffer
+    m_image->create(0, 0);
+}
+
+bool Image::IsLoaded() const
+{
+    return m_image->getSize().x > 0 && m_image->getSize().y > 0;
+}
+
 bool Image::SaveToFile(const std::string& filePath) const
 {
     return m_image->saveToFile(filePath);
@@ -47,6 +47,29 @@ public:
      */
     bool LoadFromFile(const std::string& filePath);
 
+    /**
+     * @brief Replaces the image content with raw pixel data
+     * @param pixels Array of pixel data in RGBA format
+     * @param width Width of the image in pixels
+     * @param height Height of the image in pixels
+     * @return true if the data was valid, false otherwise
+     */
+    bool LoadFromPixels(const uint8_t* pixels, unsigned int width, unsigned int height);
+
+    /**
+     * @brief Releases the pixel data, keeping the id and file path
+     *
+     * The image has a size of 0x0 until new pixels are loaded. The SFML image is emptied
+     * in place, so references returned by GetSFMLImage() remain valid.
+     */
+    void Unload();
+
+    /**
+     * @brief Checks whether the image holds pixel data
+     * @return true if the image has a non-zero size
+     */
+    bool IsLoaded() const;
+
     /**
      * @brief Saves the image to a file
      * @param filePath Path where to save the image
@@ -102,6 +125,12 @@ public:
 	 */
 	Core::Hash::HashValue GetFilePathHash() const { return m_filePathHash; }
 
+	/**
+	 * @brief Sets the file path the image content originates from
+	 * @param filePath Path of the source file
+	 */
+	void SetFilePath(const std::string& filePath) { m_filePathHash = Core::Hash::HashValue(filePath); }
+
 private:
     std::unique_ptr<sf::Image> m_image; ///< Underlying SFML image
     Core::Hash::HashValue m_id; ///< Image identifier
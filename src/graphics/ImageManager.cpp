@@ -1,7 +1,12 @@
 #include "ImageManager.h"
 #include "core/DataManager.h"
+#include "core/BakedData.h"
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <unordered_set>
 
 namespace ShoeEngine {
 namespace Graphics {
@@ -13,26 +18,49 @@ ImageManager::ImageManager(Core::DataManager& dataManager)
 
 bool ImageManager::CreateFromJson(const nlohmann::json& jsonData) {
     try {
+        // Collect the entries first so the files can be decoded in parallel
+        std::vector<PendingImage> pending;
+        pending.reserve(jsonData.size());
         for (const auto& [imageId, imageData] : jsonData.items()) {
-            // Get the file path for the image
-            std::string filePath = imageData.at("file").get<std::string>();
-			Core::Hash::HashValue filePathHash = m_dataManager.RegisterString(filePath);
-
-            // Create a new image
-            auto image = std::make_unique<Image>();
-            
-            // Load the image from file
-            if (!image->LoadFromFile(filePath)) {
-                throw std::runtime_error("Failed to load image: " + filePath);
-            }
-            
-            // Create hash from image ID
-            Core::Hash::HashValue hashId(imageId.c_str(), static_cast<uint32_t>(imageId.length()));
-			image->SetId(hashId);
+            PendingImage entry;
+            entry.imageId = imageId;
+            entry.filePath = imageData.at("file").get<std::string>();
+            entry.atlasName = imageData.value("atlas", std::string());
+            entry.image = std::make_unique<Image>();
+            pending.push_back(std::move(entry));
+        }
+
+        LoadPending(pending);
+        return true;
+    }
+    catch (const std::exception& e) {
+		std::cerr << "Error loading images: " << e.what() << "\n";
+        return false;
+    }
+}
+
+bool ImageManager::CreateFromBaked(const Core::BakedSection& section) {
+    const BakedImage* records = section.GetRecords<BakedImage>();
+    if (!records && section.GetRecordCount() > 0) {
+        return false;
+    }
 
-            // Store the image
-            m_images[hashId] = std::move(image);
+    try {
+        std::vector<PendingImage> pending;
+        pending.reserve(section.GetRecordCount());
+        for (size_t i = 0; i < section.GetRecordCount(); ++i) {
+            const BakedImage& record = records[i];
+            PendingImage entry;
+            entry.imageId = std::string(section.GetString(record.id));
+            entry.filePath = std::string(section.GetString(record.file));
+            if (record.atlas != 0) {
+                entry.atlasName = std::string(section.GetString(record.atlas));
+            }
+            entry.image = std::make_unique<Image>();
+            pending.push_back(std::move(entry));
         }
+
+        LoadPending(pending);
         return true;
     }
     catch (const std::exception& e) {
@@ -41,35 +69,556 @@ bool ImageManager::CreateFromJson(const nlohmann::json& jsonData) {
     }
 }
 
+bool ImageManager::BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const {
+    if (!jsonData.is_object()) {
+        return false;
+    }
+
+    try {
+        for (const auto& [imageId, imageData] : jsonData.items()) {
+            if (!imageId.empty() && imageId.front() == ATLAS_PAGE_PREFIX) {
+                return false;
+            }
+            BakedImage record{};
+            record.id = writer.AddString(imageId);
+            record.file = writer.AddString(imageData.at("file").get<std::string>());
+            if (imageData.contains("atlas")) {
+                record.atlas = writer.AddString(imageData["atlas"].get<std::string>());
+            }
+            writer.AddRecord(record);
+        }
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+void ImageManager::LoadPending(std::vector<PendingImage>& pending) {
+    if (!m_lazyLoading) {
+        DecodeImages(pending);
+    }
+    else {
+        // Atlas members are packed right away, so they are decoded even in lazy mode
+        for (auto& entry : pending) {
+            if (!entry.atlasName.empty()) {
+                DecodeImage(entry);
+            }
+        }
+    }
+
+    // Insert in data order, stopping at the first failed file
+    size_t loadedCount = 0;
+    while (loadedCount < pending.size()
+        && (pending[loadedCount].loaded || (m_lazyLoading && pending[loadedCount].atlasName.empty()))) {
+        ++loadedCount;
+    }
+
+    // Throws before anything is inserted, so an atlas is never left half rebuilt
+    ValidateAtlases(pending, loadedCount);
+
+    // Atlases gaining, losing or reloading a member are repacked once all images are loaded
+    std::set<std::string> dirtyAtlases;
+
+    for (size_t i = 0; i < loadedCount; ++i) {
+        PendingImage& entry = pending[i];
+		m_dataManager.RegisterString(entry.filePath);
+
+        // Create hash from image ID
+        Core::Hash::HashValue hashId = m_dataManager.RegisterString(entry.imageId);
+		entry.image->SetId(hashId);
+		entry.image->SetFilePath(entry.filePath);
+
+        // A reloaded image replaces the old one, so its texture must be uploaded again
+        m_textureCache.Invalidate(hashId);
+
+        // Track atlas membership
+        auto member = m_atlasMembers.find(hashId);
+        if (member != m_atlasMembers.end()) {
+            dirtyAtlases.insert(member->second.atlasName);
+            m_atlasMembers.erase(member);
+        }
+        if (!entry.atlasName.empty()) {
+            m_dataManager.RegisterString(entry.atlasName);
+            m_atlasMembers[hashId] = AtlasMember{ entry.imageId, entry.atlasName, entry.image->GetSFMLImage().getSize() };
+            dirtyAtlases.insert(entry.atlasName);
+        }
+
+        // Store the image
+        StoreImage(hashId, std::move(entry.image), entry.filePath);
+    }
+
+    for (const auto& atlasName : dirtyAtlases) {
+        BuildAtlas(atlasName);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_residencyMutex);
+        EnforceMemoryBudget(Core::Hash::HashValue());
+    }
+
+    if (loadedCount < pending.size()) {
+        m_dataManager.RegisterString(pending[loadedCount].filePath);
+        throw std::runtime_error("Failed to load image: " + pending[loadedCount].filePath);
+    }
+}
+
+void ImageManager::ValidateAtlases(const std::vector<PendingImage>& pending, size_t count) const {
+    const AtlasPacker packer(m_atlasSettings);
+    std::set<std::string> atlases;
+    std::unordered_set<Core::Hash::HashValue> replaced;
+    for (size_t i = 0; i < count; ++i) {
+        const PendingImage& entry = pending[i];
+        if (!entry.imageId.empty() && entry.imageId.front() == ATLAS_PAGE_PREFIX) {
+            throw std::runtime_error("Image id is reserved for atlas pages: " + entry.imageId);
+        }
+        const Core::Hash::HashValue hashId(entry.imageId);
+        replaced.insert(hashId);
+        auto member = m_atlasMembers.find(hashId);
+        if (member != m_atlasMembers.end()) {
+            atlases.insert(member->second.atlasName);
+        }
+        if (!entry.atlasName.empty()) {
+            if (!packer.Fits(entry.image->GetSFMLImage().getSize())) {
+                throw std::runtime_error("Image does not fit on a page of atlas: " + entry.atlasName);
+            }
+            atlases.insert(entry.atlasName);
+        }
+    }
+
+    // The members that stay are packed again too, possibly with changed settings
+    for (const auto& [imageId, member] : m_atlasMembers) {
+        if (atlases.count(member.atlasName) && !replaced.count(imageId) && !packer.Fits(member.size)) {
+            throw std::runtime_error("Image does not fit on a page of atlas: " + member.atlasName);
+        }
+    }
+}
+
+void ImageManager::SetDecodeThreadCount(size_t threadCount) {
+    if (threadCount != m_decodeThreadCount) {
+        m_decodeThreadCount = threadCount;
+        m_decodePool.reset();
+    }
+}
+
+void ImageManager::SetDecodedCacheDirectory(const std::string& directory) {
+    if (directory.empty()) {
+        m_decodedCache.reset();
+    }
+    else {
+        m_decodedCache = std::make_unique<DecodedImageCache>(directory);
+    }
+}
+
+void ImageManager::DecodeImage(PendingImage& entry) {
+    entry.loaded = LoadPixels(entry.filePath, *entry.image);
+}
+
+bool ImageManager::LoadPixels(const std::string& filePath, Image& image) const {
+    if (m_decodedCache && m_decodedCache->Load(filePath, image)) {
+        return true;
+    }
+
+    if (!image.LoadFromFile(filePath)) {
+        return false;
+    }
+    if (m_decodedCache) {
+        m_decodedCache->Store(filePath, image);
+    }
+    return true;
+}
+
+void ImageManager::DecodeImages(std::vector<PendingImage>& pending) {
+    const size_t threadCount = m_decodeThreadCount > 0 ? m_decodeThreadCount : Core::ThreadPool::GetDefaultThreadCount();
+    if (threadCount <= 1 || pending.size() <= 1) {
+        for (auto& entry : pending) {
+            DecodeImage(entry);
+        }
+        return;
+    }
+
+    if (!m_decodePool) {
+        m_decodePool = std::make_unique<Core::ThreadPool>(threadCount);
+    }
+
+    std::vector<std::future<void>> decoded;
+    decoded.reserve(pending.size());
+    for (auto& entry : pending) {
+        decoded.push_back(m_decodePool->Submit([this, &entry]() {
+            DecodeImage(entry);
+        }));
+    }
+
+    // Every task references an entry, so all of them must finish before anything can throw
+    for (auto& future : decoded) {
+        future.wait();
+    }
+    for (auto& future : decoded) {
+        future.get();
+    }
+}
+
 Core::Hash::HashValue ImageManager::GetManagedType() const {
     return "images"_h;
 }
 
-const Image* ImageManager::GetImage(const Core::Hash::HashValue& imageId) const {
+std::shared_ptr<const Image> ImageManager::GetImage(const Core::Hash::HashValue& imageId) const {
+    std::unique_lock<std::mutex> lock(m_residencyMutex);
+    return EnsureResident(imageId, lock);
+}
+
+ImageManager::Stats ImageManager::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_residencyMutex);
+    return m_stats;
+}
+
+void ImageManager::SetMemoryBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(m_residencyMutex);
+    m_memoryBudget = bytes;
+    EnforceMemoryBudget(Core::Hash::HashValue());
+}
+
+void ImageManager::StoreImage(const Core::Hash::HashValue& imageId, std::shared_ptr<Image> image, const std::string& filePath) {
+    std::lock_guard<std::mutex> lock(m_residencyMutex);
     auto it = m_images.find(imageId);
-    return it != m_images.end() ? it->second.get() : nullptr;
+    if (it != m_images.end()) {
+        if (it->second.bytes > 0) {
+            m_stats.residentBytes -= it->second.bytes;
+            m_lru.erase(it->second.lruPosition);
+        }
+        m_images.erase(it);
+    }
+
+    ImageEntry entry;
+    entry.image = std::move(image);
+    entry.filePath = filePath;
+    if (entry.image->IsLoaded()) {
+        entry.bytes = static_cast<size_t>(entry.image->GetWidth()) * entry.image->GetHeight() * 4;
+        m_stats.residentBytes += entry.bytes;
+        entry.lruPosition = m_lru.insert(m_lru.begin(), imageId);
+    }
+    m_images.emplace(imageId, std::move(entry));
+}
+
+std::shared_ptr<Image> ImageManager::EnsureResident(const Core::Hash::HashValue& imageId, std::unique_lock<std::mutex>& lock) const {
+    for (;;) {
+        auto it = m_images.find(imageId);
+        if (it == m_images.end()) {
+            return nullptr;
+        }
+        ImageEntry& entry = it->second;
+        if (entry.bytes > 0) {
+            ++m_stats.hits;
+            m_lru.splice(m_lru.begin(), m_lru, entry.lruPosition);
+            return entry.image;
+        }
+        if (entry.loading) {
+            m_residencyChanged.wait(lock);
+            continue;
+        }
+
+        // Decode without the lock, so other images can be requested meanwhile. A loading entry is
+        // not in m_lru, so nothing evicts it, but it may be replaced or cleared before the decode ends.
+        ++m_stats.misses;
+        entry.loading = true;
+        std::shared_ptr<Image> image = entry.image;
+        const std::string filePath = entry.filePath;
+        lock.unlock();
+        const bool loaded = LoadPixels(filePath, *image);
+        lock.lock();
+        m_residencyChanged.notify_all();
+
+        it = m_images.find(imageId);
+        if (it == m_images.end() || it->second.image != image) {
+            continue;
+        }
+        ImageEntry& loadedEntry = it->second;
+        loadedEntry.loading = false;
+        if (!loaded) {
+            std::cerr << "Error loading images: Failed to load image: " << filePath << "\n";
+            return nullptr;
+        }
+
+        loadedEntry.bytes = static_cast<size_t>(image->GetWidth()) * image->GetHeight() * 4;
+        m_stats.residentBytes += loadedEntry.bytes;
+        loadedEntry.lruPosition = m_lru.insert(m_lru.begin(), imageId);
+        EnforceMemoryBudget(imageId);
+        return image;
+    }
+}
+
+void ImageManager::EnforceMemoryBudget(const Core::Hash::HashValue& keep) const {
+    if (m_memoryBudget == 0) {
+        return;
+    }
+
+    auto it = m_lru.end();
+    while (m_stats.residentBytes > m_memoryBudget && it != m_lru.begin()) {
+        --it;
+        ImageEntry& entry = m_images.at(*it);
+        // Pinned images are shared outside the manager and keep their pixels
+        if (*it == keep || entry.image.use_count() > 1) {
+            continue;
+        }
+
+        ++it;
+        ReleasePixels(entry);
+        ++m_stats.evictions;
+    }
+}
+
+void ImageManager::ReleasePixels(ImageEntry& entry) const {
+    entry.image->Unload();
+    m_stats.residentBytes -= entry.bytes;
+    entry.bytes = 0;
+    m_lru.erase(entry.lruPosition);
+}
+
+ImageManager::TextureRegion ImageManager::AcquireTexture(const Image& image) {
+    TextureRegion atlasTexture = AcquireAtlasTexture(image.GetId());
+    if (atlasTexture.texture) {
+        return atlasTexture;
+    }
+
+    // The texture of an evicted image is uploaded from freshly decoded pixels
+    if (!image.IsLoaded() && !m_textureCache.Find(image.GetId())) {
+        GetImage(image.GetId());
+    }
+
+    const sf::IntRect fullImage(0, 0, static_cast<int>(image.GetWidth()), static_cast<int>(image.GetHeight()));
+    return TextureRegion{ m_textureCache.Acquire(image), fullImage };
+}
+
+ImageManager::TextureRegion ImageManager::AcquireTexture(const Core::Hash::HashValue& imageId) {
+    TextureRegion atlasTexture = AcquireAtlasTexture(imageId);
+    if (atlasTexture.texture) {
+        return atlasTexture;
+    }
+
+    auto image = GetImage(imageId);
+    return image ? AcquireTexture(*image) : TextureRegion{};
+}
+
+ImageManager::TextureRegion ImageManager::AcquireAtlasTexture(const Core::Hash::HashValue& imageId) {
+    const std::optional<AtlasRegion> region = GetAtlasRegion(imageId);
+    if (region) {
+        const Image* page = GetAtlasPage(region->atlasId, region->page);
+        if (page) {
+            return TextureRegion{ m_textureCache.Acquire(*page), region->rect };
+        }
+    }
+    return TextureRegion{};
+}
+
+std::optional<ImageManager::AtlasRegion> ImageManager::GetAtlasRegion(const Core::Hash::HashValue& imageId) const {
+    // Returned by value, as rebuilding any atlas moves the regions of all of them
+    auto it = m_atlasRegions.find(imageId);
+    if (it == m_atlasRegions.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+const Image* ImageManager::GetAtlasPage(const Core::Hash::HashValue& atlasId, uint32_t page) const {
+    auto it = m_atlasPages.find(atlasId);
+    if (it == m_atlasPages.end() || page >= it->second.size()) {
+        return nullptr;
+    }
+    return it->second[page].get();
+}
+
+size_t ImageManager::GetAtlasPageCount(const Core::Hash::HashValue& atlasId) const {
+    auto it = m_atlasPages.find(atlasId);
+    return it != m_atlasPages.end() ? it->second.size() : 0;
+}
+
+void ImageManager::BuildAtlas(const std::string& atlasName) {
+    const Core::Hash::HashValue atlasId(atlasName);
+    RemoveAtlas(atlasId);
+
+    // Pack in image id order so the result does not depend on hash map iteration order
+    // Members are pinned so that loading one of them cannot evict another
+    std::vector<std::pair<const AtlasMember*, std::shared_ptr<const Image>>> members;
+    for (const auto& [imageId, member] : m_atlasMembers) {
+        if (member.atlasName == atlasName) {
+            if (auto image = GetImage(imageId)) {
+                members.emplace_back(&member, std::move(image));
+            }
+        }
+    }
+    if (members.empty()) {
+        return;
+    }
+    std::sort(members.begin(), members.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first->imageName < rhs.first->imageName;
+    });
+
+    std::vector<sf::Vector2u> sizes;
+    sizes.reserve(members.size());
+    for (const auto& [member, image] : members) {
+        sizes.emplace_back(image->GetWidth(), image->GetHeight());
+    }
+
+    AtlasPacker packer(m_atlasSettings);
+    if (!packer.Pack(sizes)) {
+        throw std::runtime_error("Image does not fit on a page of atlas: " + atlasName);
+    }
+
+    // Compose the page pixels
+    const auto& pages = packer.GetPages();
+    std::vector<std::vector<uint8_t>> pagePixels(pages.size());
+    for (size_t page = 0; page < pages.size(); ++page) {
+        pagePixels[page].assign(static_cast<size_t>(pages[page].width) * pages[page].height * 4, 0);
+    }
+    const auto& placements = packer.GetPlacements();
+    for (size_t i = 0; i < members.size(); ++i) {
+        const Image* image = members[i].second.get();
+        const AtlasPacker::Placement& placement = placements[i];
+        const size_t pageStride = static_cast<size_t>(pages[placement.page].width) * 4;
+        const size_t rowBytes = static_cast<size_t>(image->GetWidth()) * 4;
+        uint8_t* destination = pagePixels[placement.page].data()
+            + placement.rect.top * pageStride + static_cast<size_t>(placement.rect.left) * 4;
+        const uint8_t* source = image->GetPixels();
+        for (unsigned int row = 0; row < image->GetHeight(); ++row) {
+            std::memcpy(destination + row * pageStride, source + row * rowBytes, rowBytes);
+        }
+    }
+
+    auto& atlasPages = m_atlasPages[atlasId];
+    for (size_t page = 0; page < pages.size(); ++page) {
+        auto pageImage = std::make_unique<Image>(pagePixels[page].data(), pages[page].width, pages[page].height);
+        pageImage->SetId(m_dataManager.RegisterString(ATLAS_PAGE_PREFIX + atlasName + "#" + std::to_string(page)));
+        atlasPages.push_back(std::move(pageImage));
+    }
+
+    // Record the regions
+    for (size_t i = 0; i < members.size(); ++i) {
+        const AtlasPacker::Placement& placement = placements[i];
+        const float pageWidth = static_cast<float>(pages[placement.page].width);
+        const float pageHeight = static_cast<float>(pages[placement.page].height);
+
+        AtlasRegion region;
+        region.atlasId = atlasId;
+        region.pageImageId = atlasPages[placement.page]->GetId();
+        region.page = placement.page;
+        region.rect = placement.rect;
+        region.u0 = placement.rect.left / pageWidth;
+        region.v0 = placement.rect.top / pageHeight;
+        region.u1 = (placement.rect.left + placement.rect.width) / pageWidth;
+        region.v1 = (placement.rect.top + placement.rect.height) / pageHeight;
+        m_atlasRegions[members[i].second->GetId()] = region;
+    }
+
+    // The pages hold the pixels now; members pinned elsewhere keep theirs
+    std::lock_guard<std::mutex> lock(m_residencyMutex);
+    for (auto& [member, image] : members) {
+        ImageEntry& entry = m_images.at(image->GetId());
+        image.reset();
+        if (entry.image.use_count() == 1 && entry.bytes > 0) {
+            ReleasePixels(entry);
+        }
+    }
+}
+
+void ImageManager::RemoveAtlas(const Core::Hash::HashValue& atlasId) {
+    auto pages = m_atlasPages.find(atlasId);
+    if (pages != m_atlasPages.end()) {
+        for (const auto& page : pages->second) {
+            m_textureCache.Invalidate(page->GetId());
+        }
+        m_atlasPages.erase(pages);
+    }
+
+    for (auto it = m_atlasRegions.begin(); it != m_atlasRegions.end();) {
+        if (it->second.atlasId == atlasId) {
+            it = m_atlasRegions.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
 }
 
 void ImageManager::Clear() {
-    m_images.clear();
+    m_textureCache.Clear();
+    m_atlasRegions.clear();
+    m_atlasPages.clear();
+    m_atlasMembers.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_residencyMutex);
+        m_images.clear();
+        m_lru.clear();
+        m_stats.residentBytes = 0;
+    }
+    MarkDirty();
 }
 
-nlohmann::json ImageManager::SerializeToJson() {
-	nlohmann::json imagesObject = nlohmann::json::object();
-
-	// Iterate through all images
-	for (const auto& [imageHash, image] : m_images) {
-		nlohmann::json imageJson;
-		// Set the "file" property for each image. 
-		// This assumes that Image has a method GetFile() returning the file path.
-		imageJson["file"] = m_dataManager.GetString(image->GetFilePathHash());
-
-		// Get the original image ID string using the DataManager, which is used as the key.
-		std::string imageName = m_dataManager.GetString(imageHash);
-		imagesObject[imageName] = imageJson;
+namespace {
+
+// What ImageManager saves of one image
+struct ImageRecord {
+	Core::Hash::HashValue image;
+	std::string file;
+	std::string atlas; ///< Empty if the image is not in an atlas
+};
+
+// Copy of the images' saved state, written by the autosave worker
+class ImageSnapshot : public Core::ManagerSnapshot {
+public:
+	ImageSnapshot(std::vector<ImageRecord> records, const Core::DataManager& dataManager)
+		: m_records(std::move(records))
+		, m_dataManager(dataManager)
+	{
 	}
 
-	return imagesObject;
+	void WriteJson(Core::JsonWriter& writer) const override {
+		// Sorted by image ID like the keys of a dumped tree
+		std::vector<std::pair<std::string_view, const ImageRecord*>> sorted;
+		sorted.reserve(m_records.size());
+		for (const ImageRecord& record : m_records) {
+			sorted.emplace_back(m_dataManager.GetString(record.image), &record);
+		}
+		std::sort(sorted.begin(), sorted.end());
+
+		writer.StartObject();
+		for (const auto& [name, record] : sorted) {
+			// The original image ID string is the key
+			writer.Key(name);
+			writer.StartObject();
+			if (!record->atlas.empty()) {
+				writer.Key("atlas");
+				writer.String(record->atlas);
+			}
+			writer.Key("file");
+			writer.String(record->file);
+			writer.EndObject();
+		}
+		writer.EndObject();
+	}
+
+private:
+	std::vector<ImageRecord> m_records;
+	const Core::DataManager& m_dataManager;
+};
+
+} // namespace
+
+nlohmann::json ImageManager::SerializeToJson() {
+	return Core::JsonWriter::ToJson([this](Core::JsonWriter& writer) { WriteJson(writer); });
+}
+
+void ImageManager::WriteJson(Core::JsonWriter& writer) {
+	CreateSnapshot()->WriteJson(writer);
+}
+
+std::unique_ptr<Core::ManagerSnapshot> ImageManager::CreateSnapshot() {
+	std::vector<ImageRecord> records;
+	records.reserve(m_images.size());
+	for (const auto& [imageHash, entry] : m_images) {
+		auto member = m_atlasMembers.find(imageHash);
+		records.push_back({ imageHash, entry.filePath,
+			member != m_atlasMembers.end() ? member->second.atlasName : std::string() });
+	}
+	return std::make_unique<ImageSnapshot>(std::move(records), m_dataManager);
 }
 
 } // namespace Graphics
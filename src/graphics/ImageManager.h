@@ -2,9 +2,18 @@
 
 #include "core/BaseManager.h"
 #include "Graphics/Image.h"
-#include <unordered_map>
+#include "graphics/TextureCache.h"
+#include "graphics/AtlasPacker.h"
+#include "graphics/DecodedImageCache.h"
+#include "core/ThreadPool.h"
+#include "core/FlatHashMap.h"
+#include <condition_variable>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace ShoeEngine {
 namespace Graphics {
@@ -15,9 +24,76 @@ namespace Graphics {
  *
  * This class handles loading and managing Image objects, providing a centralized
  * way to create and access images throughout the engine.
+ *
+ * Images may name an atlas in their JSON entry ("atlas": "<name>"). All images of an
+ * atlas are packed into one or more atlas pages, and sprites display them as
+ * sub-rectangles of the shared page texture, so they can be drawn in a single batch.
+ * Members are packed in image id order with a deterministic packer, so the same JSON
+ * always produces the same pages. Once packed, a member's own pixels are released, as the
+ * page holds a copy; they are decoded again if the image itself is requested.
+ *
+ * In lazy mode CreateFromJson only records the file of each image, and the pixels are
+ * decoded the first time the image is requested. With a memory budget, the pixel buffers
+ * of the least recently used images are released once the budget is exceeded. Images are
+ * handed out as shared pointers, and an image is never released while one is held. A
+ * released image keeps its id and address, and its pixels are decoded again on the next
+ * request. GetImage() may be called from several threads.
  */
 class ImageManager : public Core::BaseManager {
 public:
+    /**
+     * @struct AtlasRegion
+     * @brief Location of an image inside its atlas
+     */
+    struct AtlasRegion {
+        Core::Hash::HashValue atlasId;     ///< Hash of the atlas name
+        Core::Hash::HashValue pageImageId; ///< Id of the page image holding the region
+        uint32_t page = 0;                 ///< Index of the page within the atlas
+        sf::IntRect rect;                  ///< Region on the page in pixels
+        float u0 = 0.0f;                   ///< Left texture coordinate, normalized
+        float v0 = 0.0f;                   ///< Top texture coordinate, normalized
+        float u1 = 0.0f;                   ///< Right texture coordinate, normalized
+        float v1 = 0.0f;                   ///< Bottom texture coordinate, normalized
+    };
+
+    /**
+     * @brief First character of atlas page ids, "#<atlas>#<page>"; image ids may not start with it
+     *
+     * Keeps page ids apart from image ids, as both key the shared TextureCache.
+     */
+    static constexpr char ATLAS_PAGE_PREFIX = '#';
+
+    /**
+     * @struct TextureRegion
+     * @brief Texture and sub-rectangle a sprite uses to display an image
+     */
+    struct TextureRegion {
+        std::shared_ptr<const sf::Texture> texture; ///< Image texture or atlas page texture
+        sf::IntRect rect;                           ///< Area of the texture covered by the image
+    };
+
+    /**
+     * @struct BakedImage
+     * @brief Fixed-layout record of one image in a baked data file
+     */
+    struct BakedImage {
+        uint32_t id;       ///< Hash of the image id
+        uint32_t file;     ///< Hash of the file path
+        uint32_t atlas;    ///< Hash of the atlas name, 0 for none
+        uint32_t reserved; ///< Padding, always 0
+    };
+
+    /**
+     * @struct Stats
+     * @brief Image residency counters
+     */
+    struct Stats {
+        size_t hits = 0;          ///< Requests for images whose pixels were resident
+        size_t misses = 0;        ///< Requests that had to decode the pixels
+        size_t evictions = 0;     ///< Pixel buffers released to stay within the budget
+        size_t residentBytes = 0; ///< Bytes of pixel data currently held
+    };
+
     /**
      * @brief Constructor
      * @param dataManager Reference to the DataManager for string registration
@@ -31,6 +107,21 @@ public:
      */
     bool CreateFromJson(const nlohmann::json& jsonData) override;
 
+    /**
+     * @brief Creates Image objects from a baked "images" section
+     * @param section Section of BakedImage records
+     * @return bool True if all images were created successfully
+     */
+    bool CreateFromBaked(const Core::BakedSection& section) override;
+
+    /**
+     * @brief Bakes an "images" JSON section into BakedImage records
+     * @param jsonData JSON data containing image configurations
+     * @param writer Receives the records
+     * @return bool True if the section was valid
+     */
+    bool BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const override;
+
     /**
      * @brief Get the type of objects this manager handles
      * @return Core::Hash::HashValue Hash of "images" as the managed type
@@ -38,16 +129,132 @@ public:
     Core::Hash::HashValue GetManagedType() const override;
 
     /**
-     * @brief Get an image by its ID
+     * @brief Get an image by its ID, decoding its pixels if they are not resident
      * @param imageId The ID of the image to retrieve
-     * @return const Image* Pointer to the image, or nullptr if not found
+     * @return Shared image whose pixels stay resident while it is held, or nullptr if not
+     *         found or decoding failed
+     */
+    std::shared_ptr<const Image> GetImage(const Core::Hash::HashValue& imageId) const;
+
+    /**
+     * @brief Enables or disables lazy loading for images created afterwards
+     * @param enabled True to decode images on first request instead of in CreateFromJson
+     */
+    void SetLazyLoading(bool enabled) { m_lazyLoading = enabled; }
+
+    /**
+     * @brief Checks whether lazy loading is enabled
+     * @return True if images are decoded on first request
+     */
+    bool IsLazyLoading() const { return m_lazyLoading; }
+
+    /**
+     * @brief Sets the number of bytes of pixel data the manager may keep resident
+     * @param bytes Byte budget; 0 means unlimited
+     */
+    void SetMemoryBudget(size_t bytes);
+
+    /**
+     * @brief Gets the number of bytes of pixel data the manager may keep resident
+     * @return Byte budget; 0 means unlimited
+     */
+    size_t GetMemoryBudget() const { return m_memoryBudget; }
+
+    /**
+     * @brief Gets the image residency counters
+     * @return Hits, misses, evictions and resident bytes
+     */
+    Stats GetStats() const;
+
+    /**
+     * @brief Gets the texture a sprite should use to display an image
+     * @param image A managed image
+     * @return The atlas page texture and region if the image belongs to an atlas,
+     *         otherwise the image's own texture covering the whole image
+     */
+    TextureRegion AcquireTexture(const Image& image);
+
+    /**
+     * @brief Gets the texture a sprite should use to display an image, by id
+     * @param imageId The ID of the image
+     * @return As AcquireTexture(const Image&), or an empty region if the image does not exist
+     *
+     * Atlas members are served from their page without decoding the member's pixels.
+     */
+    TextureRegion AcquireTexture(const Core::Hash::HashValue& imageId);
+
+    /**
+     * @brief Gets where an image was placed in its atlas
+     * @param imageId The ID of the image
+     * @return Copy of the region, or nothing if the image is not in an atlas
+     */
+    std::optional<AtlasRegion> GetAtlasRegion(const Core::Hash::HashValue& imageId) const;
+
+    /**
+     * @brief Gets a page of an atlas
+     * @param atlasId Hash of the atlas name
+     * @param page Index of the page
+     * @return Pointer to the page image, or nullptr if it does not exist
+     */
+    const Image* GetAtlasPage(const Core::Hash::HashValue& atlasId, uint32_t page) const;
+
+    /**
+     * @brief Gets the number of pages of an atlas
+     * @param atlasId Hash of the atlas name
+     * @return Page count, 0 if the atlas does not exist
+     */
+    size_t GetAtlasPageCount(const Core::Hash::HashValue& atlasId) const;
+
+    /**
+     * @brief Sets how many threads decode image files during CreateFromJson
+     * @param threadCount Number of decode threads; 0 uses the number of hardware threads
+     *                    and 1 decodes on the calling thread
+     */
+    void SetDecodeThreadCount(size_t threadCount);
+
+    /**
+     * @brief Gets the configured number of decode threads
+     * @return Decode thread count; 0 means the number of hardware threads
+     */
+    size_t GetDecodeThreadCount() const { return m_decodeThreadCount; }
+
+    /**
+     * @brief Enables the on-disk cache of decoded pixels
+     * @param directory Cache directory; an empty path disables the cache
+     *
+     * With the cache enabled, CreateFromJson loads pixels from the cache when the source
+     * file is unchanged and decodes (and caches) it otherwise.
+     */
+    void SetDecodedCacheDirectory(const std::string& directory);
+
+    /**
+     * @brief Gets the on-disk cache of decoded pixels
+     * @return Pointer to the cache, or nullptr if it is disabled
+     */
+    const DecodedImageCache* GetDecodedCache() const { return m_decodedCache.get(); }
+
+    /**
+     * @brief Sets the page limits used when atlases are packed
+     * @param settings Maximum page size and padding; applies to atlases packed afterwards
+     */
+    void SetAtlasSettings(const AtlasPacker::Settings& settings) { m_atlasSettings = settings; }
+
+    /**
+     * @brief Get the cache that shares uploaded textures between sprites
+     * @return Reference to the texture cache owned by this manager
+     */
+    TextureCache& GetTextureCache() { return m_textureCache; }
+
+    /**
+     * @brief Get the cache that shares uploaded textures between sprites
+     * @return Const reference to the texture cache owned by this manager
      */
-    const Image* GetImage(const Core::Hash::HashValue& imageId) const;
+    const TextureCache& GetTextureCache() const { return m_textureCache; }
 
     /**
-     * @brief Clear all managed images
+     * @brief Clear all managed images and their cached textures
      */
-    void Clear();
+    void Clear() override;
 
 	/**
 	 * @brief Serialize all managed images to JSON
@@ -55,8 +262,159 @@ public:
 	 */
 	nlohmann::json SerializeToJson() override;
 
+	/**
+	 * @brief Write all managed images straight into a JSON writer
+	 * @param writer Receives an object keyed by image id
+	 */
+	void WriteJson(Core::JsonWriter& writer) override;
+
+	/**
+	 * @brief Copies the ids, files and atlases of the images, not their pixels
+	 * @return Snapshot writing the same JSON as WriteJson
+	 */
+	std::unique_ptr<Core::ManagerSnapshot> CreateSnapshot() override;
+
+	/**
+	 * @brief Images only change when loaded or cleared, which bumps the generation
+	 * @return true
+	 */
+	bool TracksChanges() const override { return true; }
+
 private:
-    std::unordered_map<Core::Hash::HashValue, std::unique_ptr<Image>, Core::Hash::Hasher> m_images;
+    struct AtlasMember {
+        std::string imageName; ///< Image id string, used to order members deterministically
+        std::string atlasName; ///< Name of the atlas the image belongs to
+        sf::Vector2u size;     ///< Size of the image, kept while its pixels are released
+    };
+
+    struct PendingImage {
+        std::string imageId;                  ///< Image id string from the JSON key
+        std::string filePath;                 ///< File to decode
+        std::string atlasName;                ///< Atlas the image is packed into, empty for none
+        std::unique_ptr<Image> image;         ///< Image being decoded
+        bool loaded = false;                  ///< Whether decoding succeeded
+    };
+
+    /**
+     * @brief Decodes and stores pending images, then repacks the atlases they touch
+     * @param pending Images from CreateFromJson or CreateFromBaked, in data order
+     * @throws std::runtime_error if an image cannot be loaded or does not fit on an atlas page
+     *
+     * Images before the first one that fails to load are stored. If an image does not fit
+     * on its atlas page, nothing is stored.
+     */
+    void LoadPending(std::vector<PendingImage>& pending);
+
+    /**
+     * @brief Checks that every atlas touched by pending images can be packed again
+     * @param pending Images about to be stored
+     * @param count Number of leading pending images that will be stored
+     * @throws std::runtime_error if an image id starts with ATLAS_PAGE_PREFIX, or an image
+     *         does not fit on an atlas page
+     */
+    void ValidateAtlases(const std::vector<PendingImage>& pending, size_t count) const;
+
+    /**
+     * @brief Decodes the files of pending images, in parallel if more than one thread is configured
+     *
+     * Pixels come from the decoded cache when it has a valid entry; freshly decoded images
+     * are written back to it.
+     * @param pending Images to decode; each entry's loaded flag receives the result
+     */
+    void DecodeImages(std::vector<PendingImage>& pending);
+
+    /**
+     * @brief Loads one pending image from the decoded cache or from its file
+     * @param entry The image to load; its loaded flag receives the result
+     */
+    void DecodeImage(PendingImage& entry);
+
+    /**
+     * @brief Loads pixels from the decoded cache or by decoding the file
+     * @param filePath Source file of the image
+     * @param image Receives the pixels
+     * @return True if the pixels were loaded
+     */
+    bool LoadPixels(const std::string& filePath, Image& image) const;
+
+    struct ImageEntry {
+        std::shared_ptr<Image> image;                           ///< The image; pinned while shared elsewhere
+        std::string filePath;                                   ///< Source file used to reload evicted pixels
+        size_t bytes = 0;                                       ///< Resident pixel bytes, 0 while unloaded
+        std::list<Core::Hash::HashValue>::iterator lruPosition; ///< Position in m_lru while resident
+        bool loading = false;                                   ///< Pixels are being decoded without the lock
+    };
+
+    /**
+     * @brief Adds or replaces an image entry
+     * @param imageId The ID of the image
+     * @param image The image, loaded or not
+     * @param filePath Source file of the image
+     */
+    void StoreImage(const Core::Hash::HashValue& imageId, std::shared_ptr<Image> image, const std::string& filePath);
+
+    // The residency helpers below expect m_residencyMutex to be held
+
+    /**
+     * @brief Makes the pixels of an image resident and marks it most recently used
+     * @param imageId The ID of the image
+     * @param lock Lock on m_residencyMutex; released while the pixels are decoded
+     * @return The image, or nullptr if it does not exist or fails to load
+     *
+     * Only one caller decodes an image; others requesting it wait for the result.
+     */
+    std::shared_ptr<Image> EnsureResident(const Core::Hash::HashValue& imageId, std::unique_lock<std::mutex>& lock) const;
+
+    /**
+     * @brief Releases least recently used, unpinned pixel buffers until the budget is met
+     * @param keep Image that must stay resident (typically the one just requested)
+     */
+    void EnforceMemoryBudget(const Core::Hash::HashValue& keep) const;
+
+    /**
+     * @brief Releases the pixels of a resident entry
+     * @param entry The image entry; it is decoded again on its next request
+     */
+    void ReleasePixels(ImageEntry& entry) const;
+
+    /**
+     * @brief Gets the page texture and region of an atlas member
+     * @param imageId The ID of the image
+     * @return The region, or an empty region if the image is not in an atlas
+     */
+    TextureRegion AcquireAtlasTexture(const Core::Hash::HashValue& imageId);
+
+    /**
+     * @brief Packs all member images of an atlas and rebuilds its pages and regions
+     * @param atlasName Name of the atlas
+     * @throws std::runtime_error if an image does not fit on an atlas page
+     *
+     * Releases the pixels of every member that is not pinned once they are on a page.
+     */
+    void BuildAtlas(const std::string& atlasName);
+
+    /**
+     * @brief Removes the pages and regions of an atlas
+     * @param atlasId Hash of the atlas name
+     */
+    void RemoveAtlas(const Core::Hash::HashValue& atlasId);
+
+    // Residency state changes on every request, including through the const accessors
+    mutable std::mutex m_residencyMutex; ///< Guards the entries, m_lru and m_stats
+    mutable std::condition_variable m_residencyChanged; ///< Signalled when a decode finishes
+    mutable Core::FlatHashMap<Core::Hash::HashValue, ImageEntry> m_images;
+    mutable std::list<Core::Hash::HashValue> m_lru; ///< Resident images, most recently used first
+    mutable Stats m_stats;
+    bool m_lazyLoading = false;
+    size_t m_memoryBudget = 0; ///< 0 = unlimited
+    Core::FlatHashMap<Core::Hash::HashValue, AtlasMember> m_atlasMembers;
+    Core::FlatHashMap<Core::Hash::HashValue, AtlasRegion> m_atlasRegions;
+    Core::FlatHashMap<Core::Hash::HashValue, std::vector<std::unique_ptr<Image>>> m_atlasPages;
+    AtlasPacker::Settings m_atlasSettings;
+    std::unique_ptr<DecodedImageCache> m_decodedCache; ///< Optional on-disk cache of decoded pixels
+    size_t m_decodeThreadCount = 0;                 ///< 0 = hardware threads
+    std::unique_ptr<Core::ThreadPool> m_decodePool; ///< Created on first parallel decode
+    TextureCache m_textureCache; ///< Textures uploaded from the managed images
 };
 
 } // namespace Graphics
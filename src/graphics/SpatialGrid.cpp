@@ -0,0 +1,228 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+namespace {
+
+// Keeps cell coordinates and range sizes far from integer overflow
+constexpr float MAX_CELL = 1073741824.0f; // 2^30
+
+void RemoveId(std::vector<uint32_t>& ids, uint32_t id)
+{
+    auto it = std::find(ids.begin(), ids.end(), id);
+    assert(it != ids.end());
+    if (it != ids.end()) {
+        *it = ids.back();
+        ids.pop_back();
+    }
+}
+
+} // namespace
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : m_cellSize(cellSize)
+    , m_inverseCellSize(1.0f / cellSize)
+{
+    assert(cellSize > 0.0f);
+}
+
+size_t SpatialGrid::CellRange::GetCellCount() const
+{
+    if (maxX < minX || maxY < minY) {
+        return 0;
+    }
+    return static_cast<size_t>(static_cast<int64_t>(maxX) - minX + 1) * static_cast<size_t>(static_cast<int64_t>(maxY) - minY + 1);
+}
+
+int32_t SpatialGrid::ToCell(float coordinate) const
+{
+    const float cell = std::floor(coordinate * m_inverseCellSize);
+    if (!(cell > -MAX_CELL)) {
+        return cell < 0.0f ? static_cast<int32_t>(-MAX_CELL) : 0; // Also catches NaN
+    }
+    return static_cast<int32_t>(std::min(cell, MAX_CELL));
+}
+
+SpatialGrid::CellRange SpatialGrid::GetCellRange(float left, float top, float right, float bottom) const
+{
+    return { ToCell(left), ToCell(top), ToCell(right), ToCell(bottom) };
+}
+
+uint64_t SpatialGrid::GetCellKey(int32_t x, int32_t y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+void SpatialGrid::Update(uint32_t id, const sf::FloatRect& bounds)
+{
+    if (!(bounds.width > 0.0f && bounds.height > 0.0f)) {
+        Remove(id);
+        return;
+    }
+
+    if (id >= m_items.size()) {
+        m_items.resize(static_cast<size_t>(id) + 1);
+    }
+
+    const float right = bounds.left + bounds.width;
+    const float bottom = bounds.top + bounds.height;
+    const CellRange cells = GetCellRange(bounds.left, bounds.top, right, bottom);
+    const bool large = cells.GetCellCount() > MAX_ITEM_CELLS;
+
+    Item& item = m_items[id];
+    const bool relink = !item.present || item.large != large || (!large && item.cells != cells);
+    if (relink && item.present) {
+        Unlink(id);
+    }
+    if (!item.present) {
+        ++m_count;
+    }
+
+    item.left = bounds.left;
+    item.top = bounds.top;
+    item.right = right;
+    item.bottom = bottom;
+    item.cells = cells;
+    item.present = true;
+    item.large = large;
+    if (relink) {
+        Link(id);
+    }
+}
+
+bool SpatialGrid::Remove(uint32_t id)
+{
+    if (!Contains(id)) {
+        return false;
+    }
+    Unlink(id);
+    m_items[id] = Item();
+    --m_count;
+    return true;
+}
+
+void SpatialGrid::Clear()
+{
+    m_items.clear();
+    m_cells.clear();
+    m_largeItems.clear();
+    m_count = 0;
+}
+
+void SpatialGrid::Link(uint32_t id)
+{
+    const Item& item = m_items[id];
+    if (item.large) {
+        m_largeItems.push_back(id);
+        return;
+    }
+
+    for (int32_t y = item.cells.minY; y <= item.cells.maxY; ++y) {
+        for (int32_t x = item.cells.minX; x <= item.cells.maxX; ++x) {
+            m_cells[GetCellKey(x, y)].push_back(id);
+        }
+    }
+}
+
+void SpatialGrid::Unlink(uint32_t id)
+{
+    const Item& item = m_items[id];
+    if (item.large) {
+        RemoveId(m_largeItems, id);
+        return;
+    }
+
+    for (int32_t y = item.cells.minY; y <= item.cells.maxY; ++y) {
+        for (int32_t x = item.cells.minX; x <= item.cells.maxX; ++x) {
+            auto it = m_cells.find(GetCellKey(x, y));
+            assert(it != m_cells.end());
+            if (it == m_cells.end()) {
+                continue;
+            }
+            RemoveId(it->second, id);
+            if (it->second.empty()) {
+                m_cells.erase(it);
+            }
+        }
+    }
+}
+
+void SpatialGrid::QueryRect(const sf::FloatRect& area, std::vector<uint32_t>& results) const
+{
+    if (!(area.width > 0.0f && area.height > 0.0f)) {
+        return;
+    }
+
+    const float right = area.left + area.width;
+    const float bottom = area.top + area.height;
+    const CellRange range = GetCellRange(area.left, area.top, right, bottom);
+    const auto overlaps = [&](const Item& item) {
+        return item.left < right && area.left < item.right && item.top < bottom && area.top < item.bottom;
+    };
+
+    const auto visitCell = [&](const std::vector<uint32_t>& ids, int32_t x, int32_t y) {
+        for (uint32_t id : ids) {
+            const Item& item = m_items[id];
+            // An item listed in several cells is reported only from the first cell it shares with the area
+            if (x == std::max(item.cells.minX, range.minX) && y == std::max(item.cells.minY, range.minY) && overlaps(item)) {
+                results.push_back(id);
+            }
+        }
+    };
+
+    if (range.GetCellCount() <= m_cells.size()) {
+        for (int32_t y = range.minY; y <= range.maxY; ++y) {
+            for (int32_t x = range.minX; x <= range.maxX; ++x) {
+                auto it = m_cells.find(GetCellKey(x, y));
+                if (it != m_cells.end()) {
+                    visitCell(it->second, x, y);
+                }
+            }
+        }
+    }
+    else {
+        // The area spans more cells than are occupied, so visit the occupied ones instead
+        for (const auto& [key, ids] : m_cells) {
+            const auto x = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+            const auto y = static_cast<int32_t>(static_cast<uint32_t>(key));
+            if (x >= range.minX && x <= range.maxX && y >= range.minY && y <= range.maxY) {
+                visitCell(ids, x, y);
+            }
+        }
+    }
+
+    for (uint32_t id : m_largeItems) {
+        if (overlaps(m_items[id])) {
+            results.push_back(id);
+        }
+    }
+}
+
+void SpatialGrid::QueryPoint(float x, float y, std::vector<uint32_t>& results) const
+{
+    const auto contains = [&](const Item& item) {
+        return item.left <= x && x < item.right && item.top <= y && y < item.bottom;
+    };
+
+    auto it = m_cells.find(GetCellKey(ToCell(x), ToCell(y)));
+    if (it != m_cells.end()) {
+        for (uint32_t id : it->second) {
+            if (contains(m_items[id])) {
+                results.push_back(id);
+            }
+        }
+    }
+
+    for (uint32_t id : m_largeItems) {
+        if (contains(m_items[id])) {
+            results.push_back(id);
+        }
+    }
+}
+
+} // namespace Graphics
+} // namespace ShoeEngine
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "core/FlatHashMap.h"
+#include "core/Hash.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+/**
+ * @class SpatialGrid
+ * @brief Uniform grid over axis-aligned bounds, for finding the items in an area or under a point
+ *
+ * Items are small integer ids, such as SpriteStorage slots, each with one rectangle. Every
+ * item is listed in the grid cells its rectangle overlaps, and only cells that hold items
+ * are stored, in a hash map keyed by cell coordinates, so the grid needs no world size.
+ * Queries visit the cells under the query and test the rectangles listed there, so their
+ * cost follows the number of items nearby rather than the number of items in the grid.
+ *
+ * Update moves an item only if its rectangle moved to other cells. Items covering more
+ * than MAX_ITEM_CELLS cells are kept in a separate list that every query tests.
+ */
+class SpatialGrid {
+public:
+    /**
+     * @brief Items covering more cells than this are not listed in cells
+     */
+    static constexpr size_t MAX_ITEM_CELLS = 64;
+
+    /**
+     * @brief Constructor
+     * @param cellSize Width and height of a cell; around the size of a typical item works best
+     */
+    explicit SpatialGrid(float cellSize = 128.0f);
+
+    /**
+     * @brief Inserts an item or moves it to new bounds
+     * @param id Id of the item
+     * @param bounds Rectangle of the item; items with an empty rectangle are removed
+     */
+    void Update(uint32_t id, const sf::FloatRect& bounds);
+
+    /**
+     * @brief Removes an item
+     * @param id Id of the item
+     * @return bool True if the item was in the grid
+     */
+    bool Remove(uint32_t id);
+
+    /**
+     * @brief Removes all items
+     */
+    void Clear();
+
+    /**
+     * @brief Whether an item is in the grid
+     * @param id Id of the item
+     * @return bool True if it was added and not removed
+     */
+    bool Contains(uint32_t id) const { return id < m_items.size() && m_items[id].present; }
+
+    /**
+     * @brief Gets the number of items in the grid
+     * @return Item count
+     */
+    size_t GetCount() const { return m_count; }
+
+    /**
+     * @brief Gets the width and height of a cell
+     * @return Cell size
+     */
+    float GetCellSize() const { return m_cellSize; }
+
+    /**
+     * @brief Finds the items whose rectangle overlaps an area
+     * @param area The area
+     * @param results Receives the ids of the items, each once, in no particular order; not cleared
+     */
+    void QueryRect(const sf::FloatRect& area, std::vector<uint32_t>& results) const;
+
+    /**
+     * @brief Finds the items whose rectangle contains a point
+     * @param x X coordinate of the point
+     * @param y Y coordinate of the point
+     * @param results Receives the ids of the items, in no particular order; not cleared
+     */
+    void QueryPoint(float x, float y, std::vector<uint32_t>& results) const;
+
+private:
+    struct CellRange {
+        int32_t minX = 0;
+        int32_t minY = 0;
+        int32_t maxX = -1;
+        int32_t maxY = -1;
+
+        bool operator==(const CellRange& other) const = default;
+        size_t GetCellCount() const;
+    };
+
+    struct Item {
+        float left = 0.0f;
+        float top = 0.0f;
+        float right = 0.0f;
+        float bottom = 0.0f;
+        CellRange cells;
+        bool present = false;
+        bool large = false; ///< Listed in m_largeItems instead of cells
+    };
+
+    struct CellHasher {
+        size_t operator()(uint64_t key) const { return static_cast<size_t>(Core::Hash::MixingHasher::Mix(key)); }
+    };
+
+    CellRange GetCellRange(float left, float top, float right, float bottom) const;
+    int32_t ToCell(float coordinate) const;
+    static uint64_t GetCellKey(int32_t x, int32_t y);
+
+    /**
+     * @brief Lists an item in the cells of its range, or in the large item list
+     */
+    void Link(uint32_t id);
+
+    /**
+     * @brief Removes an item from the cells of its range, or from the large item list
+     */
+    void Unlink(uint32_t id);
+
+    float m_cellSize;
+    float m_inverseCellSize;
+    std::vector<Item> m_items; ///< Indexed by id
+    Core::FlatHashMap<uint64_t, std::vector<uint32_t>, CellHasher> m_cells; ///< Ids listed in each cell
+    std::vector<uint32_t> m_largeItems;
+    size_t m_count = 0;
+};
+
+} // namespace Graphics
+} // namespace ShoeEngine
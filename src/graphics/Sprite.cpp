@@ -5,19 +5,31 @@ namespace Graphics {
 
 Sprite::Sprite()
     : m_sprite(std::make_unique<sf::Sprite>())
-    , m_texture(std::make_shared<sf::Texture>())
     , m_image(nullptr)
 {
 }
 
 Sprite::Sprite(const Image& image)
     : m_sprite(std::make_unique<sf::Sprite>())
-    , m_texture(std::make_shared<sf::Texture>())
     , m_image(&image)
 {
     SetImage(image);
 }
 
+Sprite::Sprite(const Image& image, std::shared_ptr<const sf::Texture> texture)
+    : m_sprite(std::make_unique<sf::Sprite>())
+    , m_image(&image)
+{
+    SetImage(image, std::move(texture));
+}
+
+Sprite::Sprite(const Image& image, std::shared_ptr<const sf::Texture> texture, const sf::IntRect& textureRect)
+    : m_sprite(std::make_unique<sf::Sprite>())
+    , m_image(&image)
+{
+    SetImage(image, std::move(texture), textureRect);
+}
+
 void Sprite::SetPosition(float x, float y)
 {
     m_sprite->setPosition(x, y);
@@ -79,10 +91,33 @@ std::tuple<float, float, float, float> Sprite::GetGlobalBounds() const
 }
 
 void Sprite::SetImage(const Image& image)
+{
+    auto texture = std::make_shared<sf::Texture>();
+    texture->loadFromImage(image.GetSFMLImage());
+    SetImage(image, std::move(texture));
+}
+
+void Sprite::SetImage(const Image& image, std::shared_ptr<const sf::Texture> texture)
 {
     m_image = &image;
-    m_texture->loadFromImage(image.GetSFMLImage());
-    m_sprite->setTexture(*m_texture, true);
+    m_texture = std::move(texture);
+    if (m_texture) {
+        m_sprite->setTexture(*m_texture, true);
+    }
+    else {
+        // Drop the reference to any previous texture but keep the transform
+        sf::Sprite untextured;
+        static_cast<sf::Transformable&>(untextured) = *m_sprite;
+        *m_sprite = untextured;
+    }
+}
+
+void Sprite::SetImage(const Image& image, std::shared_ptr<const sf::Texture> texture, const sf::IntRect& textureRect)
+{
+    SetImage(image, std::move(texture));
+    if (m_texture) {
+        m_sprite->setTextureRect(textureRect);
+    }
 }
 
 const sf::Sprite& Sprite::GetSFMLSprite() const
@@ -28,6 +28,21 @@ public:
      */
     explicit Sprite(const Image& image);
 
+    /**
+     * @brief Constructor that creates a sprite from an Image and an already uploaded texture
+     * @param image The source image the texture was created from
+     * @param texture Shared texture to display (typically obtained from a TextureCache)
+     */
+    Sprite(const Image& image, std::shared_ptr<const sf::Texture> texture);
+
+    /**
+     * @brief Constructor that creates a sprite showing part of an already uploaded texture
+     * @param image The source image displayed by the sprite
+     * @param texture Shared texture containing the image (e.g. an atlas page)
+     * @param textureRect Area of the texture covered by the image, in pixels
+     */
+    Sprite(const Image& image, std::shared_ptr<const sf::Texture> texture, const sf::IntRect& textureRect);
+
     /**
      * @brief Sets the sprite's position
      * @param x X coordinate
@@ -101,9 +116,39 @@ public:
     /**
      * @brief Sets a new image for the sprite
      * @param image The new image to use
+     *
+     * @note This uploads a texture owned by this sprite. Sprites that share images
+     *       should use the overload taking a texture from the TextureCache instead.
      */
     void SetImage(const Image& image);
 
+    /**
+     * @brief Sets a new image for the sprite using an already uploaded texture
+     * @param image The new image to use
+     * @param texture Shared texture created from the image
+     */
+    void SetImage(const Image& image, std::shared_ptr<const sf::Texture> texture);
+
+    /**
+     * @brief Sets a new image for the sprite that occupies part of a shared texture
+     * @param image The new image to use
+     * @param texture Shared texture containing the image (e.g. an atlas page)
+     * @param textureRect Area of the texture covered by the image, in pixels
+     */
+    void SetImage(const Image& image, std::shared_ptr<const sf::Texture> texture, const sf::IntRect& textureRect);
+
+    /**
+     * @brief Get the area of the texture displayed by this sprite
+     * @return Texture sub-rectangle in pixels
+     */
+    const sf::IntRect& GetTextureRect() const { return m_sprite->getTextureRect(); }
+
+    /**
+     * @brief Get the texture displayed by this sprite
+     * @return Pointer to the texture, or nullptr if the sprite has no image
+     */
+    const sf::Texture* GetTexture() const { return m_texture.get(); }
+
     /**
      * @brief Get the underlying SFML sprite
      * @return Reference to the internal SFML sprite
@@ -118,7 +163,7 @@ public:
 
 private:
     std::unique_ptr<sf::Sprite> m_sprite; ///< Underlying SFML sprite
-    std::shared_ptr<sf::Texture> m_texture; ///< Texture used by the sprite
+    std::shared_ptr<const sf::Texture> m_texture; ///< Texture used by the sprite, possibly shared
     const Image* m_image; ///< Reference to the source image
 };
 
@@ -0,0 +1,118 @@
+#include "SpriteBatch.h"
+#include <cstdlib>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+void SpriteBatch::AppendQuad(const sf::Transform& transform, const sf::IntRect& textureRect,
+    const sf::Color& color, std::vector<sf::Vertex>& vertices)
+{
+    const float width = static_cast<float>(std::abs(textureRect.width));
+    const float height = static_cast<float>(std::abs(textureRect.height));
+
+    const float left = static_cast<float>(textureRect.left);
+    const float right = left + static_cast<float>(textureRect.width);
+    const float top = static_cast<float>(textureRect.top);
+    const float bottom = top + static_cast<float>(textureRect.height);
+
+    const sf::Vector2f topLeft = transform.transformPoint(0.0f, 0.0f);
+    const sf::Vector2f topRight = transform.transformPoint(width, 0.0f);
+    const sf::Vector2f bottomRight = transform.transformPoint(width, height);
+    const sf::Vector2f bottomLeft = transform.transformPoint(0.0f, height);
+
+    vertices.emplace_back(topLeft, color, sf::Vector2f(left, top));
+    vertices.emplace_back(topRight, color, sf::Vector2f(right, top));
+    vertices.emplace_back(bottomRight, color, sf::Vector2f(right, bottom));
+    vertices.emplace_back(topLeft, color, sf::Vector2f(left, top));
+    vertices.emplace_back(bottomRight, color, sf::Vector2f(right, bottom));
+    vertices.emplace_back(bottomLeft, color, sf::Vector2f(left, bottom));
+}
+
+void SpriteBatch::Begin(SortMode sortMode)
+{
+    m_sortMode = sortMode;
+    m_entries.clear();
+    m_textureSlots.clear();
+    m_built = false;
+}
+
+void SpriteBatch::Draw(const Sprite& sprite, int layer)
+{
+    const sf::Sprite& sfSprite = sprite.GetSFMLSprite();
+    if (!sfSprite.getTexture()) {
+        return;
+    }
+    Draw(sfSprite.getTexture(), sfSprite.getTransform(), sfSprite.getTextureRect(), sfSprite.getColor(), layer);
+}
+
+void SpriteBatch::Draw(const sf::Texture* texture, const sf::Transform& transform, const sf::IntRect& textureRect,
+    const sf::Color& color, int layer)
+{
+    m_entries.push_back(Entry{ texture, GetTextureSlot(texture), layer, transform, textureRect, color });
+    m_built = false;
+}
+
+uint32_t SpriteBatch::GetTextureSlot(const sf::Texture* texture)
+{
+    // Most submissions repeat the previous texture, so check the newest slots first.
+    for (size_t i = m_textureSlots.size(); i > 0; --i) {
+        if (m_textureSlots[i - 1] == texture) {
+            return static_cast<uint32_t>(i - 1);
+        }
+    }
+    m_textureSlots.push_back(texture);
+    return static_cast<uint32_t>(m_textureSlots.size() - 1);
+}
+
+void SpriteBatch::Build()
+{
+    m_vertices.clear();
+    m_batches.clear();
+    m_stats = Stats{};
+    m_stats.sprites = m_entries.size();
+
+    // Layer in the high half of the key, flipped so negative layers sort first; entries
+    // with equal keys keep their submission order
+    m_order.resize(m_entries.size());
+    for (size_t i = 0; i < m_order.size(); ++i) {
+        uint64_t key = 0;
+        if (m_sortMode == SortMode::LayerTexture) {
+            const uint32_t layer = static_cast<uint32_t>(m_entries[i].layer) ^ 0x80000000u;
+            key = (static_cast<uint64_t>(layer) << 32) | m_entries[i].textureSlot;
+        }
+        m_order[i] = { key, static_cast<uint32_t>(i) };
+    }
+    if (m_sortMode == SortMode::LayerTexture) {
+        Core::RadixSort(m_order, m_sortScratch);
+    }
+
+    m_vertices.reserve(m_entries.size() * VERTICES_PER_SPRITE);
+    for (const Core::SortEntry& sorted : m_order) {
+        const Entry& entry = m_entries[sorted.value];
+        if (m_batches.empty() || m_batches.back().texture != entry.texture || m_batches.back().layer != entry.layer) {
+            m_batches.push_back(Batch{ entry.texture, entry.layer, m_vertices.size(), 0 });
+        }
+        AppendQuad(entry.transform, entry.textureRect, entry.color, m_vertices);
+        m_batches.back().vertexCount += VERTICES_PER_SPRITE;
+    }
+
+    m_stats.batches = m_batches.size();
+    m_built = true;
+}
+
+void SpriteBatch::End(sf::RenderTarget& target, sf::RenderStates states)
+{
+    if (!m_built) {
+        Build();
+    }
+
+    m_stats.drawCalls = 0;
+    for (const Batch& batch : m_batches) {
+        states.texture = batch.texture;
+        target.draw(&m_vertices[batch.firstVertex], batch.vertexCount, sf::Triangles, states);
+        ++m_stats.drawCalls;
+    }
+}
+
+} // namespace Graphics
+} // namespace ShoeEngine
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Sprite.h"
+#include "core/RadixSort.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+/**
+ * @class SpriteBatch
+ * @brief Collects sprites and draws all sprites sharing a texture with one draw call
+ *
+ * Sprites submitted between Begin() and End() are turned into textured quads on the CPU.
+ * Quads are grouped into batches of consecutive sprites that share a texture and layer,
+ * and every batch is submitted to the render target with a single draw call.
+ *
+ * Quad generation (Build) never touches the GPU or dereferences textures, so batching can
+ * be unit-tested and benchmarked without a window.
+ *
+ * @example
+ * batch.Begin();
+ * for (const auto& sprite : sprites) {
+ *     batch.Draw(sprite);
+ * }
+ * batch.End(window.GetRenderWindow());
+ */
+class SpriteBatch {
+public:
+    /**
+     * @enum SortMode
+     * @brief How submitted sprites are ordered before batching
+     */
+    enum class SortMode {
+        Deferred,     ///< Keep submission order; only adjacent sprites with the same texture are merged
+        LayerTexture  ///< Stable radix sort by layer, then by texture, to minimise draw calls
+    };
+
+    /**
+     * @struct Batch
+     * @brief A run of vertices drawn with one texture in one draw call
+     */
+    struct Batch {
+        const sf::Texture* texture = nullptr; ///< Texture bound for the draw call
+        int layer = 0;                        ///< Layer of all sprites in the batch
+        size_t firstVertex = 0;               ///< Index of the first vertex in GetVertices()
+        size_t vertexCount = 0;               ///< Number of vertices (6 per sprite)
+    };
+
+    /**
+     * @struct Stats
+     * @brief Counters describing the most recent End() or Build()
+     */
+    struct Stats {
+        size_t sprites = 0;   ///< Sprites submitted
+        size_t batches = 0;   ///< Batches built
+        size_t drawCalls = 0; ///< Draw calls issued to the render target
+    };
+
+    /**
+     * @brief Number of vertices generated per sprite (two triangles)
+     */
+    static constexpr size_t VERTICES_PER_SPRITE = 6;
+
+    /**
+     * @brief Appends the two triangles of a textured quad to a vertex buffer
+     *
+     * Matches the geometry sf::Sprite generates: the quad covers (0, 0)..(|width|, |height|)
+     * in local space, is transformed by @p transform and samples @p textureRect in pixels.
+     *
+     * @param transform Local-to-world transform of the sprite
+     * @param textureRect Texture sub-rectangle in pixels; negative sizes flip the image
+     * @param color Vertex color multiplied with the texture
+     * @param vertices Buffer receiving VERTICES_PER_SPRITE vertices
+     */
+    static void AppendQuad(const sf::Transform& transform, const sf::IntRect& textureRect,
+        const sf::Color& color, std::vector<sf::Vertex>& vertices);
+
+    /**
+     * @brief Starts collecting a new set of sprites, discarding the previous one
+     * @param sortMode How sprites are ordered before batching
+     */
+    void Begin(SortMode sortMode = SortMode::LayerTexture);
+
+    /**
+     * @brief Submits a sprite
+     * @param sprite The sprite to draw; sprites without a texture are ignored
+     * @param layer Layer of the sprite; lower layers are drawn first in LayerTexture mode
+     */
+    void Draw(const Sprite& sprite, int layer = 0);
+
+    /**
+     * @brief Submits a textured quad
+     * @param texture Texture of the quad, used as the batching key
+     * @param transform Local-to-world transform of the quad
+     * @param textureRect Texture sub-rectangle in pixels
+     * @param color Vertex color
+     * @param layer Layer of the quad
+     */
+    void Draw(const sf::Texture* texture, const sf::Transform& transform, const sf::IntRect& textureRect,
+        const sf::Color& color = sf::Color::White, int layer = 0);
+
+    /**
+     * @brief Sorts the submitted sprites and generates the batched vertices without drawing
+     */
+    void Build();
+
+    /**
+     * @brief Builds the batches and submits one draw call per batch
+     * @param target The render target to draw on
+     * @param states Render states applied to every batch; the texture is replaced per batch
+     */
+    void End(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default);
+
+    /**
+     * @brief Gets the batches produced by the last Build() or End()
+     * @return Batches in draw order
+     */
+    const std::vector<Batch>& GetBatches() const { return m_batches; }
+
+    /**
+     * @brief Gets the vertices produced by the last Build() or End()
+     * @return Vertex buffer shared by all batches (sf::Triangles)
+     */
+    const std::vector<sf::Vertex>& GetVertices() const { return m_vertices; }
+
+    /**
+     * @brief Gets the counters of the last Build() or End()
+     * @return Batch statistics
+     */
+    const Stats& GetLastStats() const { return m_stats; }
+
+private:
+    struct Entry {
+        const sf::Texture* texture;
+        uint32_t textureSlot; ///< Texture index in first-submission order, for deterministic sorting
+        int layer;
+        sf::Transform transform;
+        sf::IntRect textureRect;
+        sf::Color color;
+    };
+
+    /**
+     * @brief Gets the slot of a texture, assigning the next one on first use
+     * @param texture The texture
+     * @return Slot index of the texture for the current frame
+     */
+    uint32_t GetTextureSlot(const sf::Texture* texture);
+
+    SortMode m_sortMode = SortMode::LayerTexture;
+    std::vector<Entry> m_entries;
+    std::vector<Core::SortEntry> m_order; ///< Entry indices in draw order
+    std::vector<Core::SortEntry> m_sortScratch;
+    std::vector<const sf::Texture*> m_textureSlots;
+    std::vector<sf::Vertex> m_vertices;
+    std::vector<Batch> m_batches;
+    bool m_built = false;
+    Stats m_stats;
+};
+
+} // namespace Graphics
+} // namespace ShoeEngine
@@ -0,0 +1,64 @@
+#include "SpriteDrawOrder.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+uint64_t SpriteDrawOrder::MakeKey(int layer, uint32_t texture, float depth)
+{
+    // Biased so negative layers sort before positive ones
+    const uint64_t biasedLayer = static_cast<uint64_t>(std::clamp(layer, INT16_MIN, INT16_MAX) - INT16_MIN);
+    const uint64_t clampedTexture = std::min<uint32_t>(texture, UINT16_MAX);
+    return (biasedLayer << 48) | (clampedTexture << 32) | Core::ToSortableBits(depth);
+}
+
+bool SpriteDrawOrder::Update(const SpriteStorage& storage)
+{
+    if (storage.GetOrderVersion() == m_version && m_ranks.size() == storage.GetSlotCount()) {
+        return false;
+    }
+
+    const auto& textures = storage.GetTextures();
+    const auto& layers = storage.GetLayers();
+    const auto& depths = storage.GetDepths();
+    m_textureNumbers.clear();
+    m_entries.clear();
+    for (size_t i = 0; i < storage.GetSlotCount(); ++i) {
+        if (!storage.IsAlive(i) || !textures[i]) {
+            continue;
+        }
+        const uint32_t nextNumber = static_cast<uint32_t>(m_textureNumbers.size());
+        const uint32_t texture = m_textureNumbers.try_emplace(textures[i].get(), nextNumber).first->second;
+        m_entries.push_back({ MakeKey(layers[i], texture, depths[i]), static_cast<uint32_t>(i) });
+    }
+    Core::RadixSort(m_entries, m_scratch);
+
+    m_slots.resize(m_entries.size());
+    m_ranks.assign(storage.GetSlotCount(), NOT_DRAWN);
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        m_slots[i] = m_entries[i].value;
+        m_ranks[m_entries[i].value] = static_cast<uint32_t>(i);
+    }
+
+    m_version = storage.GetOrderVersion();
+    ++m_sortCount;
+    return true;
+}
+
+void SpriteDrawOrder::Sort(std::vector<uint32_t>& slots)
+{
+    m_entries.clear();
+    for (uint32_t slot : slots) {
+        assert(m_ranks[slot] != NOT_DRAWN);
+        m_entries.push_back({ m_ranks[slot], slot });
+    }
+    // Ranks are unique and below 2^32, so only the low four key bytes take passes
+    Core::RadixSort(m_entries, m_scratch);
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        slots[i] = m_entries[i].value;
+    }
+}
+
+} // namespace Graphics
+} // namespace ShoeEngine
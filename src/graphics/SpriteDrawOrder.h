@@ -0,0 +1,95 @@
+#pragma once
+
+#include "graphics/SpriteStorage.h"
+#include "core/FlatHashMap.h"
+#include "core/Hash.h"
+#include "core/RadixSort.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+/**
+ * @class SpriteDrawOrder
+ * @brief Draw order of the sprites in a SpriteStorage, sorted by layer, texture and depth
+ *
+ * Every drawable sprite gets a 64-bit key packing its layer, its texture and its depth, and
+ * the keys are radix sorted. Sprites sharing a texture within a layer end up next to each
+ * other, so a SpriteBatch draws them with one draw call; lay out overlapping sprites with
+ * different textures in different layers. Equal keys keep slot order, and textures are
+ * numbered in slot order of first use, so the order is the same on every run.
+ *
+ * Moving sprites does not change the order, so Update only sorts again after sprites
+ * were created or destroyed or their image, layer or depth changed.
+ */
+class SpriteDrawOrder {
+public:
+    /**
+     * @brief Packs a sort key: layer in the top 16 bits, then texture, then depth
+     * @param layer Layer, clamped to -32768..32767
+     * @param texture Texture number, clamped to 65535
+     * @param depth Depth; all 32 bits are kept
+     * @return Key comparing like (layer, texture, depth)
+     */
+    static uint64_t MakeKey(int layer, uint32_t texture, float depth);
+
+    /**
+     * @brief Sorts the sprites again if anything affecting their order changed
+     * @param storage The storage; use one SpriteDrawOrder per storage
+     * @return bool True if the sprites were sorted, false if the previous order still held
+     */
+    bool Update(const SpriteStorage& storage);
+
+    /**
+     * @brief Gets the drawable sprites, those with a texture, in draw order
+     * @return Slots as of the last Update
+     */
+    const std::vector<uint32_t>& GetSlots() const { return m_slots; }
+
+    /**
+     * @brief Gets the position of a slot in GetSlots()
+     * @param slot Slot below the slot count as of the last Update
+     * @return Position, or NOT_DRAWN for slots that were not drawable
+     */
+    uint32_t GetRank(size_t slot) const { return m_ranks[slot]; }
+
+    /**
+     * @brief Rank of slots without a texture
+     */
+    static constexpr uint32_t NOT_DRAWN = UINT32_MAX;
+
+    /**
+     * @brief Sorts some of the drawable slots, e.g. the visible ones, into draw order
+     * @param slots Slots that were drawable as of the last Update
+     *
+     * Sorts by rank, so it costs a radix sort of the given slots and does not look at
+     * the others.
+     */
+    void Sort(std::vector<uint32_t>& slots);
+
+    /**
+     * @brief Gets how many times Update sorted all sprites
+     * @return Sort count
+     */
+    size_t GetSortCount() const { return m_sortCount; }
+
+private:
+    struct PointerHasher {
+        size_t operator()(const sf::Texture* texture) const {
+            return static_cast<size_t>(Core::Hash::MixingHasher::Mix(reinterpret_cast<uintptr_t>(texture)));
+        }
+    };
+
+    uint64_t m_version = 0; ///< SpriteStorage::GetOrderVersion() as of the last sort
+    std::vector<uint32_t> m_slots;
+    std::vector<uint32_t> m_ranks; ///< Indexed by slot
+    std::vector<Core::SortEntry> m_entries;
+    std::vector<Core::SortEntry> m_scratch;
+    Core::FlatHashMap<const sf::Texture*, uint32_t, PointerHasher> m_textureNumbers;
+    size_t m_sortCount = 0;
+};
+
+} // namespace Graphics
+} // namespace ShoeEngine
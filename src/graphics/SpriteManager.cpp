@@ -1,6 +1,10 @@
 #include "SpriteManager.h"
 #include "core/Hash.h"
-#include <stdexcept>
+#include "core/BakedData.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
 
 namespace ShoeEngine {
 namespace Graphics {
@@ -11,34 +15,22 @@ SpriteManager::SpriteManager(Core::DataManager& dataManager, ImageManager& image
 {
     // Register the type string using the base class's protected member
     m_dataManager.RegisterString("sprites");
+    m_storage.SetChangeCounter(&m_generation);
 }
 
 bool SpriteManager::CreateFromJson(const nlohmann::json& jsonData) {
     try {
         for (const auto& [spriteId, spriteData] : jsonData.items()) {
-            // Get the image ID for the sprite
-            std::string imageId = spriteData.at("image").get<std::string>();
-            
-            // Register the sprite and image IDs
-            m_dataManager.RegisterString(spriteId);
-            m_dataManager.RegisterString(imageId);
-            
-            // Create hash from image ID
-            Core::Hash::HashValue imageHash = m_dataManager.RegisterString(imageId);
-            
-            // Get the image from the ImageManager
-            const Image* image = m_imageManager.GetImage(imageHash);
-            if (!image) {
-                throw std::runtime_error("Image not found: " + imageId);
+            // Create the sprite from its image
+            const SpriteHandle sprite = CreateSprite(spriteId, spriteData.at("image").get<std::string>());
+            if (sprite.IsNull()) {
+                return false;
             }
             
-            // Create a new sprite with the image
-            auto sprite = std::make_unique<Sprite>(*image);
-            
             // Set position if specified
             if (spriteData.contains("position")) {
                 const auto& position = spriteData["position"];
-                sprite->SetPosition(
+                m_storage.SetPosition(sprite,
                     position.at("x").get<float>(),
                     position.at("y").get<float>()
                 );
@@ -46,13 +38,13 @@ bool SpriteManager::CreateFromJson(const nlohmann::json& jsonData) {
             
             // Set rotation if specified
             if (spriteData.contains("rotation")) {
-                sprite->SetRotation(spriteData["rotation"].get<float>());
+                m_storage.SetRotation(sprite, spriteData["rotation"].get<float>());
             }
             
             // Set scale if specified
             if (spriteData.contains("scale")) {
                 const auto& scale = spriteData["scale"];
-                sprite->SetScale(
+                m_storage.SetScale(sprite,
                     scale.at("x").get<float>(),
                     scale.at("y").get<float>()
                 );
@@ -61,15 +53,15 @@ bool SpriteManager::CreateFromJson(const nlohmann::json& jsonData) {
             // Set origin if specified
             if (spriteData.contains("origin")) {
                 const auto& origin = spriteData["origin"];
-                sprite->SetOrigin(
+                m_storage.SetOrigin(sprite,
                     origin.at("x").get<float>(),
                     origin.at("y").get<float>()
                 );
-            }            
-            
-            // Add the sprite to our map
-            Core::Hash::HashValue spriteHash(spriteId.c_str(), static_cast<uint32_t>(spriteId.length()));
-            m_sprites[spriteHash] = std::move(sprite);
+            }
+
+            // Draw order defaults to layer 0, depth 0
+            m_storage.SetLayer(sprite, spriteData.value("layer", 0));
+            m_storage.SetDepth(sprite, spriteData.value("depth", 0.0f));
         }
         
         return true;
@@ -79,63 +71,302 @@ bool SpriteManager::CreateFromJson(const nlohmann::json& jsonData) {
     }
 }
 
+bool SpriteManager::CreateFromBaked(const Core::BakedSection& section) {
+    const BakedSprite* records = section.GetRecords<BakedSprite>();
+    if (!records && section.GetRecordCount() > 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < section.GetRecordCount(); ++i) {
+        const BakedSprite& record = records[i];
+        const SpriteHandle sprite = CreateSprite(std::string(section.GetString(record.sprite)),
+            std::string(section.GetString(record.image)));
+        if (sprite.IsNull()) {
+            return false;
+        }
+        m_storage.SetPosition(sprite, record.positionX, record.positionY);
+        m_storage.SetRotation(sprite, record.rotation);
+        m_storage.SetScale(sprite, record.scaleX, record.scaleY);
+        m_storage.SetOrigin(sprite, record.originX, record.originY);
+        m_storage.SetLayer(sprite, record.layer);
+        m_storage.SetDepth(sprite, record.depth);
+    }
+    return true;
+}
+
+bool SpriteManager::BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const {
+    try {
+        for (const auto& [spriteId, spriteData] : jsonData.items()) {
+            BakedSprite record{};
+            record.sprite = writer.AddString(spriteId);
+            record.image = writer.AddString(spriteData.at("image").get<std::string>());
+            if (spriteData.contains("position")) {
+                record.positionX = spriteData["position"].at("x").get<float>();
+                record.positionY = spriteData["position"].at("y").get<float>();
+            }
+            if (spriteData.contains("rotation")) {
+                record.rotation = spriteData["rotation"].get<float>();
+            }
+            if (spriteData.contains("scale")) {
+                record.scaleX = spriteData["scale"].at("x").get<float>();
+                record.scaleY = spriteData["scale"].at("y").get<float>();
+            }
+            if (spriteData.contains("origin")) {
+                record.originX = spriteData["origin"].at("x").get<float>();
+                record.originY = spriteData["origin"].at("y").get<float>();
+            }
+            record.layer = spriteData.value("layer", 0);
+            record.depth = spriteData.value("depth", 0.0f);
+            writer.AddRecord(record);
+        }
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+SpriteHandle SpriteManager::CreateSprite(const std::string& spriteId, const std::string& imageId) {
+    // Register the sprite and image IDs
+    const Core::Hash::HashValue spriteHash = m_dataManager.RegisterString(spriteId);
+    const Core::Hash::HashValue imageHash = m_dataManager.RegisterString(imageId);
+    
+    // Share the image's texture (or atlas page) with other sprites
+    auto region = m_imageManager.AcquireTexture(imageHash);
+    if (!region.texture) {
+        return SpriteHandle();
+    }
+    
+    // Reuse the slot of a sprite with the same id, so its handle stays valid
+    SpriteHandle& sprite = m_spritesByName[spriteHash];
+    if (m_storage.IsValid(sprite)) {
+        m_storage.ResetTransform(sprite);
+        m_storage.SetLayer(sprite, 0);
+        m_storage.SetDepth(sprite, 0.0f);
+    }
+    else {
+        sprite = m_storage.Create(spriteHash);
+    }
+
+    m_storage.SetImage(sprite, imageHash, std::move(region.texture), region.rect);
+    return sprite;
+}
+
+bool SpriteManager::DestroySprite(SpriteHandle handle) {
+    if (!m_storage.IsValid(handle)) {
+        return false;
+    }
+    m_spritesByName.erase(m_storage.GetName(handle));
+    return m_storage.Destroy(handle);
+}
+
+std::shared_ptr<const Image> SpriteManager::GetImage(SpriteHandle handle) const {
+    if (!m_storage.IsValid(handle)) {
+        return nullptr;
+    }
+    return m_imageManager.GetImage(m_storage.GetImage(handle));
+}
+
+std::vector<Core::Hash::HashValue> SpriteManager::GetDependencies() const {
+    return { "images"_h };
+}
+
 Core::Hash::HashValue SpriteManager::GetManagedType() const {
     return "sprites"_h;
 }
 
-Sprite* SpriteManager::GetSprite(const Core::Hash::HashValue& name) {
-    auto it = m_sprites.find(name);
-    return it != m_sprites.end() ? it->second.get() : nullptr;
+SpriteHandle SpriteManager::GetSprite(const Core::Hash::HashValue& name) const {
+    auto it = m_spritesByName.find(name);
+    return it != m_spritesByName.end() ? it->second : SpriteHandle();
+}
+
+void SpriteManager::UpdateSpatialGrid() {
+    m_updatedSlots.clear();
+    m_storage.UpdateTransforms(&m_updatedSlots);
+
+    const auto& textures = m_storage.GetTextures();
+    for (uint32_t slot : m_updatedSlots) {
+        if (m_storage.IsAlive(slot) && textures[slot]) {
+            m_spatialGrid.Update(slot, m_storage.GetGlobalBounds(m_storage.GetHandle(slot)));
+        }
+        else {
+            m_spatialGrid.Remove(slot);
+        }
+    }
+}
+
+void SpriteManager::QuerySprites(const sf::FloatRect& area, std::vector<SpriteHandle>& sprites) {
+    UpdateSpatialGrid();
+    m_querySlots.clear();
+    m_spatialGrid.QueryRect(area, m_querySlots);
+    std::sort(m_querySlots.begin(), m_querySlots.end());
+    for (uint32_t slot : m_querySlots) {
+        sprites.push_back(m_storage.GetHandle(slot));
+    }
+}
+
+SpriteHandle SpriteManager::PickSprite(float x, float y) {
+    UpdateSpatialGrid();
+    m_querySlots.clear();
+    m_spatialGrid.QueryPoint(x, y, m_querySlots);
+    if (m_querySlots.empty()) {
+        return SpriteHandle();
+    }
+    m_drawOrder.Update(m_storage);
+    const auto topmost = std::max_element(m_querySlots.begin(), m_querySlots.end(),
+        [this](uint32_t a, uint32_t b) { return m_drawOrder.GetRank(a) < m_drawOrder.GetRank(b); });
+    return m_storage.GetHandle(*topmost);
+}
+
+namespace {
+
+// World area shown by a view, widened to contain it if the view is rotated
+sf::FloatRect GetViewBounds(const sf::View& view) {
+    const sf::Vector2f& center = view.getCenter();
+    const sf::Vector2f& size = view.getSize();
+    const float angle = view.getRotation() * 3.141592654f / 180.0f;
+    const float cosine = std::abs(std::cos(angle));
+    const float sine = std::abs(std::sin(angle));
+    const float halfWidth = (std::abs(size.x) * cosine + std::abs(size.y) * sine) / 2.0f;
+    const float halfHeight = (std::abs(size.x) * sine + std::abs(size.y) * cosine) / 2.0f;
+    return sf::FloatRect(center.x - halfWidth, center.y - halfHeight, 2.0f * halfWidth, 2.0f * halfHeight);
+}
+
+} // namespace
+
+void SpriteManager::Render(Window& window) {
+    sf::RenderWindow& renderWindow = window.GetRenderWindow();
+    UpdateSpatialGrid();
+    m_querySlots.clear();
+    m_spatialGrid.QueryRect(GetViewBounds(renderWindow.getView()), m_querySlots);
+
+    // The full order is only sorted again when sprites are added, removed or re-layered
+    m_drawOrder.Update(m_storage);
+    m_drawOrder.Sort(m_querySlots);
+
+    const auto& textures = m_storage.GetTextures();
+    const auto& textureRects = m_storage.GetTextureRects();
+    const auto& layers = m_storage.GetLayers();
+    m_spriteBatch.Begin(SpriteBatch::SortMode::Deferred);
+    for (uint32_t slot : m_querySlots) {
+        m_spriteBatch.Draw(textures[slot].get(), m_storage.GetWorldTransform(slot), textureRects[slot],
+            sf::Color::White, layers[slot]);
+    }
+    m_spriteBatch.End(renderWindow);
 }
 
 void SpriteManager::Clear() {
-    m_sprites.clear();
+    m_storage.Clear();
+    m_spritesByName.clear();
+    m_spatialGrid.Clear();
+    MarkDirty();
 }
 
+namespace {
+
+// What SpriteManager saves of one sprite
+struct SpriteRecord {
+    Core::Hash::HashValue sprite;
+    Core::Hash::HashValue image;
+    std::pair<float, float> position;
+    float rotation;
+    std::pair<float, float> scale;
+    std::pair<float, float> origin;
+    int layer;
+    float depth;
+};
+
+void WritePair(Core::JsonWriter& writer, const char* key, const std::pair<float, float>& value) {
+    writer.Key(key);
+    writer.StartObject();
+    writer.Key("x");
+    writer.Float(value.first);
+    writer.Key("y");
+    writer.Float(value.second);
+    writer.EndObject();
+}
+
+// Writes one member of the sprites object; names are looked up in the thread-safe string registry
+void WriteSprite(Core::JsonWriter& writer, std::string_view name, const SpriteRecord& record,
+    const Core::DataManager& dataManager) {
+    writer.Key(name);
+    writer.StartObject();
+    writer.Key("depth");
+    writer.Float(record.depth);
+    writer.Key("image");
+    writer.String(dataManager.GetString(record.image));
+    writer.Key("layer");
+    writer.Integer(record.layer);
+    WritePair(writer, "origin", record.origin);
+    WritePair(writer, "position", record.position);
+    writer.Key("rotation");
+    writer.Float(record.rotation);
+    WritePair(writer, "scale", record.scale);
+    writer.EndObject();
+}
+
+SpriteRecord MakeRecord(const SpriteStorage& storage, size_t index) {
+    return {
+        storage.GetNames()[index],
+        storage.GetImages()[index],
+        { storage.GetPositionsX()[index], storage.GetPositionsY()[index] },
+        storage.GetRotations()[index],
+        { storage.GetScalesX()[index], storage.GetScalesY()[index] },
+        { storage.GetOriginsX()[index], storage.GetOriginsY()[index] },
+        storage.GetLayers()[index],
+        storage.GetDepths()[index]
+    };
+}
+
+// Copy of the sprites' saved state, written by the autosave worker
+class SpriteSnapshot : public Core::ManagerSnapshot {
+public:
+    SpriteSnapshot(std::vector<SpriteRecord> records, const Core::DataManager& dataManager)
+        : m_records(std::move(records))
+        , m_dataManager(dataManager)
+    {
+    }
+
+    void WriteJson(Core::JsonWriter& writer) const override {
+        // Sorted by name like the keys of a dumped tree, so saves do not depend on slot order
+        std::vector<std::pair<std::string_view, const SpriteRecord*>> sorted;
+        sorted.reserve(m_records.size());
+        for (const SpriteRecord& record : m_records) {
+            sorted.emplace_back(m_dataManager.GetString(record.sprite), &record);
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        writer.StartObject();
+        for (const auto& [name, record] : sorted) {
+            WriteSprite(writer, name, *record, m_dataManager);
+        }
+        writer.EndObject();
+    }
+
+private:
+    std::vector<SpriteRecord> m_records;
+    const Core::DataManager& m_dataManager;
+};
+
+} // namespace
+
 nlohmann::json SpriteManager::SerializeToJson() {
-	// Use an object instead of an array
-	nlohmann::json spritesObject = nlohmann::json::object();
-
-	for (const auto& [spriteHash, sprite] : m_sprites)
-	{
-		nlohmann::json spriteJson;
-
-		// Get the image ID from the sprite's image
-		const Image& image = sprite->GetImage();
-		spriteJson["image"] = m_dataManager.GetString(image.GetId());
-
-		// Get position
-		auto position = sprite->GetPosition();
-		spriteJson["position"] = {
-			{ "x", position.first },
-			{ "y", position.second }
-		};
-
-		// Get rotation
-		spriteJson["rotation"] = sprite->GetRotation();
-
-		// Get scale
-		auto scale = sprite->GetScale();
-		spriteJson["scale"] = {
-			{ "x", scale.first },
-			{ "y", scale.second }
-		};
-
-		// Get origin
-		auto origin = sprite->GetOrigin();
-		spriteJson["origin"] = {
-			{ "x", origin.first },
-			{ "y", origin.second }
-		};
-
-		// Convert the sprite's hash back to a string, which we�ll use as the object key.
-		std::string spriteName = m_dataManager.GetString(spriteHash);
-
-		// Instead of pushing to an array, assign it in an object by sprite name
-		spritesObject[spriteName] = spriteJson;
-	}
-
-	return spritesObject;
+    return Core::JsonWriter::ToJson([this](Core::JsonWriter& writer) { WriteJson(writer); });
+}
+
+void SpriteManager::WriteJson(Core::JsonWriter& writer) {
+    CreateSnapshot()->WriteJson(writer);
+}
+
+std::unique_ptr<Core::ManagerSnapshot> SpriteManager::CreateSnapshot() {
+    std::vector<SpriteRecord> records;
+    records.reserve(m_storage.GetCount());
+    for (size_t i = 0; i < m_storage.GetSlotCount(); ++i) {
+        if (m_storage.IsAlive(i)) {
+            records.push_back(MakeRecord(m_storage, i));
+        }
+    }
+    return std::make_unique<SpriteSnapshot>(std::move(records), m_dataManager);
 }
 
 } // namespace Graphics
@@ -1,10 +1,14 @@
 #pragma once
 
 #include "core/BaseManager.h"
-#include "graphics/Sprite.h"
+#include "graphics/SpatialGrid.h"
+#include "graphics/SpriteDrawOrder.h"
+#include "graphics/SpriteBatch.h"
+#include "graphics/SpriteStorage.h"
 #include "graphics/ImageManager.h"
+#include "graphics/Window.h"
 #include "core/DataManager.h"
-#include <unordered_map>
+#include "core/FlatHashMap.h"
 #include <memory>
 
 namespace ShoeEngine {
@@ -12,13 +16,37 @@ namespace Graphics {
 
 /**
  * @class SpriteManager
- * @brief Manages creation and storage of Sprite objects from JSON data
+ * @brief Manages creation and storage of sprites from JSON data
  *
- * This class handles loading and managing Sprite objects, providing a centralized
+ * This class handles loading and managing sprites, providing a centralized
  * way to create and access sprites throughout the engine.
+ *
+ * Sprites live in a SpriteStorage, one array per field, and are referred to by
+ * SpriteHandle. Read and change them through GetStorage(); a handle stays valid until
+ * the sprite is destroyed, replaced or cleared.
  */
 class SpriteManager : public Core::BaseManager {
 public:
+    /**
+     * @struct BakedSprite
+     * @brief Fixed-layout record of one sprite in a baked data file
+     *
+     * Optional JSON fields are baked with the values a sprite has when they are omitted.
+     */
+    struct BakedSprite {
+        uint32_t sprite;       ///< Hash of the sprite id
+        uint32_t image;        ///< Hash of the image id
+        float positionX = 0.0f;
+        float positionY = 0.0f;
+        float rotation = 0.0f; ///< Rotation in degrees
+        float scaleX = 1.0f;
+        float scaleY = 1.0f;
+        float originX = 0.0f;
+        float originY = 0.0f;
+        int32_t layer = 0;
+        float depth = 0.0f;
+    };
+
     /**
      * @brief Constructor taking references to required managers
      * @param dataManager Reference to the DataManager for string registration
@@ -33,6 +61,33 @@ public:
      */
     bool CreateFromJson(const nlohmann::json& jsonData) override;
 
+    /**
+     * @brief Creates Sprite objects from a baked "sprites" section
+     * @param section Section of BakedSprite records
+     * @return bool True if all sprites were created successfully
+     */
+    bool CreateFromBaked(const Core::BakedSection& section) override;
+
+    /**
+     * @brief Bakes a "sprites" JSON section into BakedSprite records
+     * @param jsonData JSON object containing sprite definitions
+     * @param writer Receives the records
+     * @return bool True if the section was valid
+     */
+    bool BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const override;
+
+    /**
+     * @brief Sprites are created from images, so the "images" section loads first
+     * @return Hash of "images"
+     */
+    std::vector<Core::Hash::HashValue> GetDependencies() const override;
+
+    /**
+     * @brief Sprites upload their textures, so they load on the main thread
+     * @return true
+     */
+    bool RequiresMainThread() const override { return true; }
+
     /**
      * @brief Get the type of objects this manager handles
      * @return Core::Hash::HashValue Hash of "sprites" as the managed type
@@ -42,14 +97,93 @@ public:
     /**
      * @brief Gets a sprite by name
      * @param name The name of the sprite to get
-     * @return Pointer to the sprite, or nullptr if not found
+     * @return Handle of the sprite, or a null handle if not found
+     */
+    SpriteHandle GetSprite(const Core::Hash::HashValue& name) const;
+
+    /**
+     * @brief Creates a sprite showing an image, replacing any sprite with the same id
+     * @param spriteId Id of the sprite
+     * @param imageId Id of the image to display
+     * @return Handle of the sprite, or a null handle if the image does not exist
+     */
+    SpriteHandle CreateSprite(const std::string& spriteId, const std::string& imageId);
+
+    /**
+     * @brief Destroys a sprite; its slot is reused by later sprites
+     * @param handle The sprite
+     * @return bool True if the handle referred to an existing sprite
      */
-    Sprite* GetSprite(const Core::Hash::HashValue& name);
+    bool DestroySprite(SpriteHandle handle);
+
+    /**
+     * @brief Whether a handle refers to an existing sprite
+     * @param handle The handle
+     * @return bool False for null handles and handles of destroyed sprites
+     */
+    bool IsValid(SpriteHandle handle) const { return m_storage.IsValid(handle); }
+
+    /**
+     * @brief Gets the image a sprite displays
+     * @param handle The sprite
+     * @return The image, or nullptr if the handle is not valid or the image no longer exists
+     */
+    std::shared_ptr<const Image> GetImage(SpriteHandle handle) const;
+
+    /**
+     * @brief Gets the sprite fields, to read or change sprites by handle or in bulk
+     * @return The storage; changes made through it count as changes to the manager
+     */
+    SpriteStorage& GetStorage() { return m_storage; }
+    const SpriteStorage& GetStorage() const { return m_storage; }
+
+    /**
+     * @brief Finds the sprites whose bounds overlap an area
+     * @param area Area in world coordinates, e.g. the visible part of a view
+     * @param sprites Receives the sprites in slot order; not cleared
+     */
+    void QuerySprites(const sf::FloatRect& area, std::vector<SpriteHandle>& sprites);
+
+    /**
+     * @brief Finds the sprite under a point, e.g. the mouse cursor
+     * @param x X coordinate in world coordinates
+     * @param y Y coordinate in world coordinates
+     * @return Of the sprites containing the point, the one drawn last; a null handle if none
+     */
+    SpriteHandle PickSprite(float x, float y);
+
+    /**
+     * @brief Gets the spatial index of the sprites' bounds, keyed by storage slot
+     * @return The grid, as of the last Render, QuerySprites or PickSprite
+     */
+    const SpatialGrid& GetSpatialGrid() const { return m_spatialGrid; }
+
+    /**
+     * @brief Gets the order sprites are drawn in
+     * @return The order as of the last Render or PickSprite
+     */
+    const SpriteDrawOrder& GetDrawOrder() const { return m_drawOrder; }
+
+    /**
+     * @brief Draws the managed sprites visible in a window's view
+     * @param window The engine Window to draw on
+     *
+     * @note Sprites are drawn through a SpriteBatch, so sprites sharing a texture cost one draw call.
+     *       Sprites outside the view are culled through the spatial grid and not submitted; the
+     *       others are drawn in SpriteDrawOrder: by layer, then texture, then depth.
+     */
+    void Render(Window& window);
+
+    /**
+     * @brief Gets the batch used by Render()
+     * @return Const reference to the sprite batch, e.g. to inspect draw call counts
+     */
+    const SpriteBatch& GetSpriteBatch() const { return m_spriteBatch; }
 
     /**
      * @brief Clear all managed sprites
      */
-    void Clear();
+    void Clear() override;
 
     /**
      * @brief Serialize all managed sprites to JSON
@@ -57,9 +191,38 @@ public:
      */
     nlohmann::json SerializeToJson() override;
 
+    /**
+     * @brief Write all managed sprites straight into a JSON writer
+     * @param writer Receives an object keyed by sprite name
+     */
+    void WriteJson(Core::JsonWriter& writer) override;
+
+    /**
+     * @brief Copy the saved state of all sprites for the autosave worker
+     * @return Snapshot holding plain transform records
+     */
+    std::unique_ptr<Core::ManagerSnapshot> CreateSnapshot() override;
+
+    /**
+     * @brief Changes to the sprites' transforms and images bump the generation
+     * @return true
+     */
+    bool TracksChanges() const override { return true; }
+
 private:
+    /**
+     * @brief Recomputes the bounds of changed sprites and moves them in the spatial grid
+     */
+    void UpdateSpatialGrid();
+
     ImageManager& m_imageManager;
-    std::unordered_map<Core::Hash::HashValue, std::unique_ptr<Sprite>, Core::Hash::Hasher> m_sprites;
+    SpriteStorage m_storage;
+    Core::FlatHashMap<Core::Hash::HashValue, SpriteHandle> m_spritesByName;
+    SpatialGrid m_spatialGrid;
+    SpriteDrawOrder m_drawOrder;
+    std::vector<uint32_t> m_updatedSlots; ///< Scratch for UpdateSpatialGrid
+    std::vector<uint32_t> m_querySlots;   ///< Scratch for queries
+    SpriteBatch m_spriteBatch;
 };
 
 } // namespace Graphics
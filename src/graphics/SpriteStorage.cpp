@@ -0,0 +1,466 @@
+#include "SpriteStorage.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+// Eight lanes with AVX; otherwise four with SSE2, which every x86-64 compiler enables
+#if defined(__AVX__)
+#define SHOE_SPRITE_AVX 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SHOE_SPRITE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace ShoeEngine {
+namespace Graphics {
+
+namespace {
+
+#if defined(SHOE_SPRITE_AVX)
+constexpr size_t LANES = 8;
+#elif defined(SHOE_SPRITE_SSE2)
+constexpr size_t LANES = 4;
+#else
+constexpr size_t LANES = 1;
+#endif
+
+// Whether any of the LANES dirty flags starting at flags is set
+inline bool AnyDirty(const uint8_t* flags)
+{
+    if constexpr (LANES == 8) {
+        uint64_t block;
+        std::memcpy(&block, flags, sizeof(block));
+        return block != 0;
+    }
+    else if constexpr (LANES == 4) {
+        uint32_t block;
+        std::memcpy(&block, flags, sizeof(block));
+        return block != 0;
+    }
+    else {
+        return *flags != 0;
+    }
+}
+
+// Same rounding as sf::Transformable, so cached transforms match sf::Sprite
+inline float Radians(float degrees)
+{
+    return -degrees * 3.141592654f / 180.0f;
+}
+
+} // namespace
+
+SpriteHandle SpriteStorage::Create(Core::Hash::HashValue name)
+{
+    size_t index;
+    if (!m_freeSlots.empty()) {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else {
+        index = m_slotCount++;
+        for (std::vector<float>* field : { &m_positionX, &m_positionY, &m_rotation, &m_originX, &m_originY,
+                 &m_sin, &m_width, &m_height, &m_worldA, &m_worldB, &m_worldC, &m_worldD, &m_worldX, &m_worldY,
+                 &m_boundsLeft, &m_boundsTop, &m_boundsRight, &m_boundsBottom }) {
+            field->push_back(0.0f);
+        }
+        m_scaleX.push_back(1.0f);
+        m_scaleY.push_back(1.0f);
+        m_cos.push_back(1.0f);
+        m_images.emplace_back();
+        m_textures.emplace_back();
+        m_textureRects.emplace_back();
+        m_layers.push_back(0);
+        m_depths.push_back(0.0f);
+        m_names.emplace_back();
+        m_generations.push_back(1);
+        m_alive.push_back(0);
+        m_dirty.push_back(0);
+    }
+
+    m_names[index] = name;
+    m_alive[index] = 1;
+    ++m_orderVersion;
+    Changed(index);
+    return GetHandle(index);
+}
+
+bool SpriteStorage::Destroy(SpriteHandle handle)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+
+    const size_t index = handle.index;
+    m_alive[index] = 0;
+    if (++m_generations[index] == 0) {
+        m_generations[index] = 1;
+    }
+
+    // Reset the slot for reuse and release its texture
+    ResetFields(index);
+    m_images[index] = Core::Hash::HashValue();
+    m_textures[index].reset();
+    m_textureRects[index] = sf::IntRect();
+    m_width[index] = 0.0f;
+    m_height[index] = 0.0f;
+    m_layers[index] = 0;
+    m_depths[index] = 0.0f;
+    m_names[index] = Core::Hash::HashValue();
+    m_freeSlots.push_back(handle.index);
+    ++m_orderVersion;
+    Changed(index); // So UpdateTransforms reports the slot, e.g. to remove it from a SpatialGrid
+    return true;
+}
+
+void SpriteStorage::Clear()
+{
+    for (size_t i = 0; i < m_slotCount; ++i) {
+        if (IsAlive(i)) {
+            Destroy(GetHandle(i));
+        }
+    }
+}
+
+bool SpriteStorage::IsValid(SpriteHandle handle) const
+{
+    return handle.index < m_slotCount && m_alive[handle.index] && m_generations[handle.index] == handle.generation;
+}
+
+void SpriteStorage::ResetFields(size_t index)
+{
+    m_positionX[index] = 0.0f;
+    m_positionY[index] = 0.0f;
+    m_rotation[index] = 0.0f;
+    m_scaleX[index] = 1.0f;
+    m_scaleY[index] = 1.0f;
+    m_originX[index] = 0.0f;
+    m_originY[index] = 0.0f;
+    m_cos[index] = 1.0f;
+    m_sin[index] = 0.0f;
+}
+
+bool SpriteStorage::ResetTransform(SpriteHandle handle)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    ResetFields(handle.index);
+    Changed(handle.index);
+    return true;
+}
+
+bool SpriteStorage::SetPosition(SpriteHandle handle, float x, float y)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    const size_t index = handle.index;
+    m_positionX[index] = x;
+    m_positionY[index] = y;
+    Changed(index);
+    return true;
+}
+
+bool SpriteStorage::Move(SpriteHandle handle, float offsetX, float offsetY)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    const size_t index = handle.index;
+    m_positionX[index] += offsetX;
+    m_positionY[index] += offsetY;
+    Changed(index);
+    return true;
+}
+
+bool SpriteStorage::SetRotation(SpriteHandle handle, float angle)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    // Kept in [0, 360) like sf::Transformable
+    angle = std::fmod(angle, 360.0f);
+    if (angle < 0.0f) {
+        angle += 360.0f;
+    }
+    const size_t index = handle.index;
+    m_rotation[index] = angle;
+    m_cos[index] = static_cast<float>(std::cos(Radians(angle)));
+    m_sin[index] = static_cast<float>(std::sin(Radians(angle)));
+    Changed(index);
+    return true;
+}
+
+bool SpriteStorage::SetScale(SpriteHandle handle, float scaleX, float scaleY)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    const size_t index = handle.index;
+    m_scaleX[index] = scaleX;
+    m_scaleY[index] = scaleY;
+    Changed(index);
+    return true;
+}
+
+bool SpriteStorage::SetOrigin(SpriteHandle handle, float x, float y)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    const size_t index = handle.index;
+    m_originX[index] = x;
+    m_originY[index] = y;
+    Changed(index);
+    return true;
+}
+
+std::pair<float, float> SpriteStorage::GetPosition(SpriteHandle handle) const
+{
+    if (!IsValid(handle)) {
+        return { 0.0f, 0.0f };
+    }
+    return { m_positionX[handle.index], m_positionY[handle.index] };
+}
+
+float SpriteStorage::GetRotation(SpriteHandle handle) const
+{
+    return IsValid(handle) ? m_rotation[handle.index] : 0.0f;
+}
+
+std::pair<float, float> SpriteStorage::GetScale(SpriteHandle handle) const
+{
+    if (!IsValid(handle)) {
+        return { 1.0f, 1.0f };
+    }
+    return { m_scaleX[handle.index], m_scaleY[handle.index] };
+}
+
+std::pair<float, float> SpriteStorage::GetOrigin(SpriteHandle handle) const
+{
+    if (!IsValid(handle)) {
+        return { 0.0f, 0.0f };
+    }
+    return { m_originX[handle.index], m_originY[handle.index] };
+}
+
+bool SpriteStorage::SetImage(SpriteHandle handle, Core::Hash::HashValue image,
+    std::shared_ptr<const sf::Texture> texture, const sf::IntRect& textureRect)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    const size_t index = handle.index;
+    m_images[index] = image;
+    m_textures[index] = std::move(texture);
+    m_textureRects[index] = m_textures[index] ? textureRect : sf::IntRect();
+    m_width[index] = static_cast<float>(std::abs(m_textureRects[index].width));
+    m_height[index] = static_cast<float>(std::abs(m_textureRects[index].height));
+    ++m_orderVersion;
+    Changed(index);
+    return true;
+}
+
+bool SpriteStorage::SetTextureRect(SpriteHandle handle, const sf::IntRect& textureRect)
+{
+    if (!IsValid(handle) || !m_textures[handle.index]) {
+        return false;
+    }
+    const size_t index = handle.index;
+    m_textureRects[index] = textureRect;
+    const float width = static_cast<float>(std::abs(textureRect.width));
+    const float height = static_cast<float>(std::abs(textureRect.height));
+    if (m_width[index] != width || m_height[index] != height) {
+        m_width[index] = width;
+        m_height[index] = height;
+        m_dirty[index] = 1; // The bounds depend on the size; the transform does not
+    }
+    return true;
+}
+
+bool SpriteStorage::SetLayer(SpriteHandle handle, int layer)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    const size_t index = handle.index;
+    if (m_layers[index] != layer) {
+        m_layers[index] = layer;
+        ++m_orderVersion;
+        NotifyChanged(); // The transform and bounds are unchanged
+    }
+    return true;
+}
+
+bool SpriteStorage::SetDepth(SpriteHandle handle, float depth)
+{
+    if (!IsValid(handle)) {
+        return false;
+    }
+    const size_t index = handle.index;
+    if (m_depths[index] != depth) {
+        m_depths[index] = depth;
+        ++m_orderVersion;
+        NotifyChanged();
+    }
+    return true;
+}
+
+sf::Transform SpriteStorage::GetTransform(size_t index) const
+{
+    // Same computation as sf::Transformable::getTransform
+    const float sxc = m_scaleX[index] * m_cos[index];
+    const float syc = m_scaleY[index] * m_cos[index];
+    const float sxs = m_scaleX[index] * m_sin[index];
+    const float sys = m_scaleY[index] * m_sin[index];
+    const float tx = -m_originX[index] * sxc - m_originY[index] * sys + m_positionX[index];
+    const float ty = m_originX[index] * sxs - m_originY[index] * syc + m_positionY[index];
+
+    return sf::Transform(sxc, sys, tx,
+        -sxs, syc, ty,
+        0.0f, 0.0f, 1.0f);
+}
+
+sf::Transform SpriteStorage::GetWorldTransform(size_t index) const
+{
+    assert(!IsDirty(index));
+    return sf::Transform(m_worldA[index], m_worldB[index], m_worldX[index],
+        m_worldC[index], m_worldD[index], m_worldY[index],
+        0.0f, 0.0f, 1.0f);
+}
+
+sf::FloatRect SpriteStorage::GetGlobalBounds(SpriteHandle handle) const
+{
+    if (!IsValid(handle)) {
+        return sf::FloatRect();
+    }
+    const size_t index = handle.index;
+    assert(!IsDirty(index));
+    return sf::FloatRect(m_boundsLeft[index], m_boundsTop[index],
+        m_boundsRight[index] - m_boundsLeft[index], m_boundsBottom[index] - m_boundsTop[index]);
+}
+
+size_t SpriteStorage::UpdateTransforms(std::vector<uint32_t>* updatedSlots)
+{
+    size_t updated = 0;
+    size_t i = 0;
+
+#if defined(SHOE_SPRITE_AVX) || defined(SHOE_SPRITE_SSE2)
+#if defined(SHOE_SPRITE_AVX)
+    using Vector = __m256;
+    const auto load = [](const std::vector<float>& field, size_t index) { return _mm256_loadu_ps(field.data() + index); };
+    const auto store = [](std::vector<float>& field, size_t index, Vector value) { _mm256_storeu_ps(field.data() + index, value); };
+    const auto add = [](Vector a, Vector b) { return _mm256_add_ps(a, b); };
+    const auto sub = [](Vector a, Vector b) { return _mm256_sub_ps(a, b); };
+    const auto mul = [](Vector a, Vector b) { return _mm256_mul_ps(a, b); };
+    const auto min = [](Vector a, Vector b) { return _mm256_min_ps(a, b); };
+    const auto max = [](Vector a, Vector b) { return _mm256_max_ps(a, b); };
+    const Vector zero = _mm256_setzero_ps();
+#else
+    using Vector = __m128;
+    const auto load = [](const std::vector<float>& field, size_t index) { return _mm_loadu_ps(field.data() + index); };
+    const auto store = [](std::vector<float>& field, size_t index, Vector value) { _mm_storeu_ps(field.data() + index, value); };
+    const auto add = [](Vector a, Vector b) { return _mm_add_ps(a, b); };
+    const auto sub = [](Vector a, Vector b) { return _mm_sub_ps(a, b); };
+    const auto mul = [](Vector a, Vector b) { return _mm_mul_ps(a, b); };
+    const auto min = [](Vector a, Vector b) { return _mm_min_ps(a, b); };
+    const auto max = [](Vector a, Vector b) { return _mm_max_ps(a, b); };
+    const Vector zero = _mm_setzero_ps();
+#endif
+
+    for (; i + LANES <= m_slotCount; i += LANES) {
+        if (!AnyDirty(m_dirty.data() + i)) {
+            continue;
+        }
+
+        const Vector scaleX = load(m_scaleX, i);
+        const Vector scaleY = load(m_scaleY, i);
+        const Vector cosine = load(m_cos, i);
+        const Vector sine = load(m_sin, i);
+        const Vector originX = load(m_originX, i);
+        const Vector originY = load(m_originY, i);
+
+        const Vector sxc = mul(scaleX, cosine);
+        const Vector syc = mul(scaleY, cosine);
+        const Vector sxs = mul(scaleX, sine);
+        const Vector sys = mul(scaleY, sine);
+        const Vector negSxs = sub(zero, sxs);
+        const Vector tx = add(sub(sub(zero, mul(originX, sxc)), mul(originY, sys)), load(m_positionX, i));
+        const Vector ty = add(sub(mul(originX, sxs), mul(originY, syc)), load(m_positionY, i));
+        store(m_worldA, i, sxc);
+        store(m_worldB, i, sys);
+        store(m_worldC, i, negSxs);
+        store(m_worldD, i, syc);
+        store(m_worldX, i, tx);
+        store(m_worldY, i, ty);
+
+        // The corners of (0, 0, width, height) reach tx + a * width and tx + b * height at most
+        const Vector width = load(m_width, i);
+        const Vector height = load(m_height, i);
+        const Vector aw = mul(sxc, width);
+        const Vector bh = mul(sys, height);
+        const Vector cw = mul(negSxs, width);
+        const Vector dh = mul(syc, height);
+        store(m_boundsLeft, i, add(tx, add(min(aw, zero), min(bh, zero))));
+        store(m_boundsRight, i, add(tx, add(max(aw, zero), max(bh, zero))));
+        store(m_boundsTop, i, add(ty, add(min(cw, zero), min(dh, zero))));
+        store(m_boundsBottom, i, add(ty, add(max(cw, zero), max(dh, zero))));
+
+        std::memset(m_dirty.data() + i, 0, LANES);
+        updated += LANES;
+        if (updatedSlots) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                updatedSlots->push_back(static_cast<uint32_t>(i + lane));
+            }
+        }
+    }
+#endif
+
+    // Slots past the last full block
+    return updated + UpdateTransformsScalar(i, m_slotCount, updatedSlots);
+}
+
+size_t SpriteStorage::UpdateTransformsScalar(size_t begin, size_t end, std::vector<uint32_t>* updatedSlots)
+{
+    size_t updated = 0;
+    for (size_t i = begin; i < end; ++i) {
+        if (!m_dirty[i]) {
+            continue;
+        }
+
+        const float sxc = m_scaleX[i] * m_cos[i];
+        const float syc = m_scaleY[i] * m_cos[i];
+        const float sxs = m_scaleX[i] * m_sin[i];
+        const float sys = m_scaleY[i] * m_sin[i];
+        const float tx = -m_originX[i] * sxc - m_originY[i] * sys + m_positionX[i];
+        const float ty = m_originX[i] * sxs - m_originY[i] * syc + m_positionY[i];
+        m_worldA[i] = sxc;
+        m_worldB[i] = sys;
+        m_worldC[i] = -sxs;
+        m_worldD[i] = syc;
+        m_worldX[i] = tx;
+        m_worldY[i] = ty;
+
+        const float aw = sxc * m_width[i];
+        const float bh = sys * m_height[i];
+        const float cw = -sxs * m_width[i];
+        const float dh = syc * m_height[i];
+        m_boundsLeft[i] = tx + (std::min(aw, 0.0f) + std::min(bh, 0.0f));
+        m_boundsRight[i] = tx + (std::max(aw, 0.0f) + std::max(bh, 0.0f));
+        m_boundsTop[i] = ty + (std::min(cw, 0.0f) + std::min(dh, 0.0f));
+        m_boundsBottom[i] = ty + (std::max(cw, 0.0f) + std::max(dh, 0.0f));
+        m_dirty[i] = 0;
+        ++updated;
+        if (updatedSlots) {
+            updatedSlots->push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return updated;
+}
+
+} // namespace Graphics
+} // namespace ShoeEngine
@@ -0,0 +1,319 @@
+#pragma once
+
+#include "core/Hash.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+/**
+ * @struct SpriteHandle
+ * @brief Refers to a sprite in a SpriteStorage
+ *
+ * The generation tells a handle to a destroyed sprite apart from the sprite that later
+ * reuses its slot. The default handle never refers to a sprite.
+ */
+struct SpriteHandle {
+    uint32_t index = 0;      ///< Slot of the sprite
+    uint32_t generation = 0; ///< Generation of the slot when the sprite was created; 0 for none
+
+    /**
+     * @brief Whether the handle was ever given a sprite; IsValid tells whether it still exists
+     * @return False for the default handle
+     */
+    bool IsNull() const { return generation == 0; }
+
+    bool operator==(const SpriteHandle& other) const = default;
+};
+
+/**
+ * @class SpriteStorage
+ * @brief Stores sprites as parallel arrays indexed by slot
+ *
+ * Each field of every sprite lives in its own contiguous array, so code that touches one
+ * field of many sprites, like rendering or moving them, walks memory linearly instead of
+ * following a pointer per sprite. Destroyed slots go on a free list and are reused by the
+ * next Create, with their generation bumped so old handles become invalid.
+ *
+ * Slots are iterated from 0 to GetSlotCount(); skip slots for which IsAlive is false.
+ * Accessors taking a handle check it: setters return false and do nothing for a handle
+ * that is not valid, and getters return the value of a newly created sprite.
+ *
+ * World transforms and bounds are cached: changing a sprite marks its slot dirty, and
+ * UpdateTransforms recomputes the dirty slots in one SIMD pass over the field arrays.
+ */
+class SpriteStorage {
+public:
+    /**
+     * @brief Creates a sprite with an identity transform and no texture
+     * @param name Hash of the sprite's id
+     * @return Handle of the sprite
+     */
+    SpriteHandle Create(Core::Hash::HashValue name);
+
+    /**
+     * @brief Destroys a sprite and puts its slot on the free list
+     * @param handle The sprite
+     * @return bool True if the handle was valid
+     */
+    bool Destroy(SpriteHandle handle);
+
+    /**
+     * @brief Destroys all sprites, invalidating every handle
+     */
+    void Clear();
+
+    /**
+     * @brief Whether a handle refers to an existing sprite
+     * @param handle The handle
+     * @return bool False for null handles and handles of destroyed sprites
+     */
+    bool IsValid(SpriteHandle handle) const;
+
+    /**
+     * @brief Gets the number of existing sprites
+     * @return Sprite count
+     */
+    size_t GetCount() const { return m_slotCount - m_freeSlots.size(); }
+
+    /**
+     * @brief Gets the number of slots, including free ones
+     * @return Size of every field array
+     */
+    size_t GetSlotCount() const { return m_slotCount; }
+
+    /**
+     * @brief Whether a slot holds a sprite
+     * @param index Slot below GetSlotCount()
+     * @return bool False for free slots
+     */
+    bool IsAlive(size_t index) const { return m_alive[index] != 0; }
+
+    /**
+     * @brief Gets the handle of the sprite in a slot
+     * @param index Slot of an existing sprite
+     * @return The handle
+     */
+    SpriteHandle GetHandle(size_t index) const { return { static_cast<uint32_t>(index), m_generations[index] }; }
+
+    /**
+     * @brief Sets the counter incremented by every change to a sprite
+     * @param counter Counter to increment, e.g. the owning manager's generation; nullptr for none
+     */
+    void SetChangeCounter(uint64_t* counter) { m_changeCounter = counter; }
+
+    /**
+     * @brief Resets a sprite's transform to the identity without changing its texture
+     * @param handle The sprite
+     * @return bool False if the handle is not valid
+     */
+    bool ResetTransform(SpriteHandle handle);
+
+    // Return false if the handle is not valid
+    bool SetPosition(SpriteHandle handle, float x, float y);
+    bool Move(SpriteHandle handle, float offsetX, float offsetY);
+    bool SetRotation(SpriteHandle handle, float angle);
+    bool SetScale(SpriteHandle handle, float scaleX, float scaleY);
+    bool SetOrigin(SpriteHandle handle, float x, float y);
+
+    std::pair<float, float> GetPosition(SpriteHandle handle) const;
+    float GetRotation(SpriteHandle handle) const;
+    std::pair<float, float> GetScale(SpriteHandle handle) const;
+    std::pair<float, float> GetOrigin(SpriteHandle handle) const;
+
+    /**
+     * @brief Sets the layer of a sprite; lower layers are drawn first
+     * @param handle The sprite
+     * @param layer The layer; SpriteDrawOrder orders layers -32768 to 32767 and clamps others
+     * @return bool False if the handle is not valid
+     */
+    bool SetLayer(SpriteHandle handle, int layer);
+
+    /**
+     * @brief Sets the depth of a sprite; within a layer and texture, lower depths are drawn first
+     * @param handle The sprite
+     * @param depth The depth
+     * @return bool False if the handle is not valid
+     */
+    bool SetDepth(SpriteHandle handle, float depth);
+
+    int GetLayer(SpriteHandle handle) const { return IsValid(handle) ? m_layers[handle.index] : 0; }
+    float GetDepth(SpriteHandle handle) const { return IsValid(handle) ? m_depths[handle.index] : 0.0f; }
+
+    /**
+     * @brief Gets a counter incremented by every change that can affect draw order
+     * @return The counter; it changes when sprites are created or destroyed, or their image,
+     *         layer or depth changes, but not when they are transformed
+     */
+    uint64_t GetOrderVersion() const { return m_orderVersion; }
+
+    /**
+     * @brief Sets the image a sprite displays
+     * @param handle The sprite
+     * @param image Hash of the image id
+     * @param texture Shared texture containing the image, e.g. an atlas page
+     * @param textureRect Area of the texture covered by the image, in pixels
+     * @return bool False if the handle is not valid
+     */
+    bool SetImage(SpriteHandle handle, Core::Hash::HashValue image,
+        std::shared_ptr<const sf::Texture> texture, const sf::IntRect& textureRect);
+
+    /**
+     * @brief Changes the area of its texture a sprite shows, e.g. to the next animation frame
+     * @param handle A sprite with a texture
+     * @param textureRect Area of the texture, in pixels
+     * @return bool False if the handle is not valid or the sprite has no texture
+     *
+     * Keeps the texture, so the draw order is unchanged. The rectangle is not saved, so it
+     * does not notify the change counter; the slot is only marked dirty if the size changes.
+     */
+    bool SetTextureRect(SpriteHandle handle, const sf::IntRect& textureRect);
+
+    Core::Hash::HashValue GetName(SpriteHandle handle) const { return IsValid(handle) ? m_names[handle.index] : Core::Hash::HashValue(); }
+    Core::Hash::HashValue GetImage(SpriteHandle handle) const { return IsValid(handle) ? m_images[handle.index] : Core::Hash::HashValue(); }
+    const sf::Texture* GetTexture(SpriteHandle handle) const { return IsValid(handle) ? m_textures[handle.index].get() : nullptr; }
+    sf::IntRect GetTextureRect(SpriteHandle handle) const { return IsValid(handle) ? m_textureRects[handle.index] : sf::IntRect(); }
+
+    /**
+     * @brief Computes the local-to-world transform of the sprite in a slot
+     * @param index Slot of an existing sprite
+     * @return The transform sf::Sprite would have with the same position, rotation, scale and origin
+     */
+    sf::Transform GetTransform(size_t index) const;
+
+    /**
+     * @brief Recomputes the world transforms and bounds of the sprites changed since the last call
+     * @param updatedSlots If not null, receives the recomputed slots, including destroyed ones
+     * @return Number of slots recomputed; slots are processed in blocks of SIMD width, so
+     *         clean slots sharing a block with a dirty one are included
+     *
+     * Uses AVX or SSE2 when the compiler targets them, and scalar code otherwise.
+     */
+    size_t UpdateTransforms(std::vector<uint32_t>* updatedSlots = nullptr);
+
+    /**
+     * @brief Whether a slot changed since the last UpdateTransforms
+     * @param index Slot below GetSlotCount()
+     * @return bool True if its cached transform and bounds are stale
+     */
+    bool IsDirty(size_t index) const { return m_dirty[index] != 0; }
+
+    /**
+     * @brief Gets the transform cached by UpdateTransforms
+     * @param index Slot of an existing sprite that is not dirty
+     * @return The same transform as GetTransform, without recomputing it
+     */
+    sf::Transform GetWorldTransform(size_t index) const;
+
+    /**
+     * @brief Gets the bounds cached by UpdateTransforms
+     * @param handle A sprite that is not dirty
+     * @return Axis-aligned bounds of the transformed texture rectangle, like sf::Sprite::getGlobalBounds;
+     *         empty if the handle is not valid
+     */
+    sf::FloatRect GetGlobalBounds(SpriteHandle handle) const;
+
+    // Field arrays, indexed by slot, for code processing many sprites
+    const std::vector<float>& GetPositionsX() const { return m_positionX; }
+    const std::vector<float>& GetPositionsY() const { return m_positionY; }
+    const std::vector<float>& GetRotations() const { return m_rotation; }
+    const std::vector<float>& GetScalesX() const { return m_scaleX; }
+    const std::vector<float>& GetScalesY() const { return m_scaleY; }
+    const std::vector<float>& GetOriginsX() const { return m_originX; }
+    const std::vector<float>& GetOriginsY() const { return m_originY; }
+    const std::vector<Core::Hash::HashValue>& GetNames() const { return m_names; }
+    const std::vector<Core::Hash::HashValue>& GetImages() const { return m_images; }
+    const std::vector<std::shared_ptr<const sf::Texture>>& GetTextures() const { return m_textures; }
+    const std::vector<sf::IntRect>& GetTextureRects() const { return m_textureRects; }
+    const std::vector<int>& GetLayers() const { return m_layers; }
+    const std::vector<float>& GetDepths() const { return m_depths; }
+
+    // Bounds arrays, valid for slots that are not dirty
+    const std::vector<float>& GetBoundsLeft() const { return m_boundsLeft; }
+    const std::vector<float>& GetBoundsTop() const { return m_boundsTop; }
+    const std::vector<float>& GetBoundsRight() const { return m_boundsRight; }
+    const std::vector<float>& GetBoundsBottom() const { return m_boundsBottom; }
+
+private:
+    /**
+     * @brief Sets the transform fields of a slot to the identity
+     */
+    void ResetFields(size_t index);
+
+    /**
+     * @brief Increments the change counter, if any
+     */
+    void NotifyChanged() {
+        if (m_changeCounter) {
+            ++*m_changeCounter;
+        }
+    }
+
+    /**
+     * @brief Marks a slot dirty and notifies the change counter
+     */
+    void Changed(size_t index) {
+        m_dirty[index] = 1;
+        NotifyChanged();
+    }
+
+    /**
+     * @brief Recomputes the cached transform and bounds of the dirty slots in [begin, end) without SIMD
+     * @return Number of slots recomputed
+     */
+    size_t UpdateTransformsScalar(size_t begin, size_t end, std::vector<uint32_t>* updatedSlots);
+
+    // Transform fields, read every frame
+    std::vector<float> m_positionX;
+    std::vector<float> m_positionY;
+    std::vector<float> m_rotation; ///< Degrees
+    std::vector<float> m_scaleX;
+    std::vector<float> m_scaleY;
+    std::vector<float> m_originX;
+    std::vector<float> m_originY;
+    std::vector<float> m_cos; ///< Cosine of the rotation, computed when it is set
+    std::vector<float> m_sin; ///< Sine of the rotation
+    std::vector<float> m_width;  ///< Width of the texture rectangle
+    std::vector<float> m_height; ///< Height of the texture rectangle
+
+    // Cached by UpdateTransforms: the affine transform (a b x / c d y) and the bounds
+    std::vector<float> m_worldA;
+    std::vector<float> m_worldB;
+    std::vector<float> m_worldC;
+    std::vector<float> m_worldD;
+    std::vector<float> m_worldX;
+    std::vector<float> m_worldY;
+    std::vector<float> m_boundsLeft;
+    std::vector<float> m_boundsTop;
+    std::vector<float> m_boundsRight;
+    std::vector<float> m_boundsBottom;
+    std::vector<uint8_t> m_dirty; ///< Set by every change, cleared by UpdateTransforms
+
+    // Image fields
+    std::vector<Core::Hash::HashValue> m_images;
+    std::vector<std::shared_ptr<const sf::Texture>> m_textures;
+    std::vector<sf::IntRect> m_textureRects;
+
+    // Draw order fields
+    std::vector<int> m_layers;
+    std::vector<float> m_depths;
+    uint64_t m_orderVersion = 0;
+
+    // Slot bookkeeping
+    std::vector<Core::Hash::HashValue> m_names;
+    std::vector<uint32_t> m_generations; ///< Bumped when a slot is freed; never 0
+    std::vector<uint8_t> m_alive;
+    std::vector<uint32_t> m_freeSlots;
+    size_t m_slotCount = 0;
+    uint64_t* m_changeCounter = nullptr; ///< Incremented by every change
+};
+
+} // namespace Graphics
+} // namespace ShoeEngine
@@ -0,0 +1,56 @@
+#include "TextureCache.h"
+
+namespace ShoeEngine {
+namespace Graphics {
+
+std::shared_ptr<const sf::Texture> TextureCache::Acquire(const Image& image)
+{
+    auto it = m_textures.find(image.GetId());
+    if (it != m_textures.end() && it->second.source == &image) {
+        return it->second.texture;
+    }
+
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromImage(image.GetSFMLImage())) {
+        return nullptr;
+    }
+
+    const size_t bytes = static_cast<size_t>(image.GetWidth()) * image.GetHeight() * 4;
+    ++m_uploadCount;
+    m_uploadedBytes += bytes;
+
+    if (it != m_textures.end()) {
+        m_residentBytes -= it->second.bytes;
+        it->second = Entry{ texture, &image, bytes };
+    }
+    else {
+        m_textures.emplace(image.GetId(), Entry{ texture, &image, bytes });
+    }
+    m_residentBytes += bytes;
+
+    return texture;
+}
+
+std::shared_ptr<const sf::Texture> TextureCache::Find(const Core::Hash::HashValue& imageId) const
+{
+    auto it = m_textures.find(imageId);
+    return it != m_textures.end() ? it->second.texture : nullptr;
+}
+
+void TextureCache::Invalidate(const Core::Hash::HashValue& imageId)
+{
+    auto it = m_textures.find(imageId);
+    if (it != m_textures.end()) {
+        m_residentBytes -= it->second.bytes;
+        m_textures.erase(it);
+    }
+}
+
+void TextureCache::Clear()
+{
+    m_textures.clear();
+    m_residentBytes = 0;
+}
+
+} // namespace Graphics
+} // namespace ShoeEngine
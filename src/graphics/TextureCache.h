@@ -0,0 +1,98 @@
+#pragma once
+
+#include <SFML/Graphics/Texture.hpp>
+#include "core/Hash.h"
+#include "Image.h"
+#include <unordered_map>
+#include <memory>
+#include <cstddef>
+
+namespace ShoeEngine {
+namespace Graphics {
+
+/**
+ * @class TextureCache
+ * @brief Shares one GPU texture per Image between all sprites that display it
+ *
+ * Textures are keyed by the image's HashValue id and uploaded the first time they
+ * are requested. Every later request for the same image hands out a shared reference
+ * to the existing texture instead of uploading the pixels again. The cache also keeps
+ * upload statistics so callers can verify how often pixel data reaches the GPU.
+ *
+ * @note Textures are handed out as shared pointers, so sprites keep a texture alive
+ *       even after it has been invalidated or the cache has been cleared.
+ */
+class TextureCache {
+public:
+    /**
+     * @brief Default constructor creating an empty cache
+     */
+    TextureCache() = default;
+
+    /**
+     * @brief Gets the texture for an image, uploading it on first use
+     * @param image The source image; its id is used as the cache key
+     * @return Shared texture for the image, or nullptr if the upload failed
+     *
+     * @note If a different Image instance is registered under an id that is already
+     *       cached (e.g. after the image was reloaded), the texture is uploaded again.
+     */
+    std::shared_ptr<const sf::Texture> Acquire(const Image& image);
+
+    /**
+     * @brief Looks up an already uploaded texture without creating it
+     * @param imageId The id of the image
+     * @return Shared texture, or nullptr if the image has not been uploaded
+     */
+    std::shared_ptr<const sf::Texture> Find(const Core::Hash::HashValue& imageId) const;
+
+    /**
+     * @brief Drops the cached texture of an image so that the next Acquire uploads it again
+     * @param imageId The id of the image
+     */
+    void Invalidate(const Core::Hash::HashValue& imageId);
+
+    /**
+     * @brief Drops all cached textures; upload statistics are kept
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of textures currently held by the cache
+     * @return Number of cached textures
+     */
+    size_t GetTextureCount() const { return m_textures.size(); }
+
+    /**
+     * @brief Gets the number of texture uploads performed since construction
+     * @return Total upload count
+     */
+    size_t GetUploadCount() const { return m_uploadCount; }
+
+    /**
+     * @brief Gets the number of pixel bytes uploaded since construction
+     * @return Total uploaded bytes (RGBA, 4 bytes per pixel)
+     */
+    size_t GetUploadedBytes() const { return m_uploadedBytes; }
+
+    /**
+     * @brief Gets the number of pixel bytes held by the currently cached textures
+     * @return Resident texture bytes
+     */
+    size_t GetResidentBytes() const { return m_residentBytes; }
+
+private:
+    struct Entry {
+        std::shared_ptr<const sf::Texture> texture; ///< Uploaded texture
+        const Image* source = nullptr;              ///< Image the texture was uploaded from
+        size_t bytes = 0;                           ///< Size of the pixel data in bytes
+    };
+
+    std::unordered_map<Core::Hash::HashValue, Entry, Core::Hash::Hasher> m_textures;
+    size_t m_uploadCount = 0;
+    size_t m_uploadedBytes = 0;
+    size_t m_residentBytes = 0;
+};
+
+} // namespace Graphics
+} // namespace ShoeEngine
@@ -30,6 +30,9 @@ bool Window::ProcessEvents() {
             m_window.close();
             return false;
         }
+        if (event.type == sf::Event::Resized) {
+            NotifyChanged();
+        }
     }
     return true;
 }
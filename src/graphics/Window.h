@@ -2,6 +2,7 @@
 
 #include "core/Hash.h"
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <string>
 
 namespace ShoeEngine {
@@ -72,15 +73,28 @@ public:
 	/**
 	* @brief Sets the hash value of the window title
 	*/
-	void SetTitleHash(Core::Hash::HashValue titleHash) { m_titleHash = titleHash; }
+	void SetTitleHash(Core::Hash::HashValue titleHash) { m_titleHash = titleHash; NotifyChanged(); }
 
 	uint32_t GetWidth() const { return m_window.getSize().x; }
 
 	uint32_t GetHeight() const { return m_window.getSize().y; }
 
+	/**
+	* @brief Sets a counter incremented when the window is resized or retitled
+	* @param counter Counter to increment, e.g. the owning manager's generation; nullptr for none
+	*/
+	void SetChangeCounter(uint64_t* counter) { m_changeCounter = counter; }
+
 private:
+	void NotifyChanged() {
+		if (m_changeCounter) {
+			++*m_changeCounter;
+		}
+	}
+
     sf::RenderWindow m_window;  ///< The SFML window instance
 	Core::Hash::HashValue m_titleHash; ///< Hash value for the window title
+	uint64_t* m_changeCounter = nullptr; ///< Incremented by resizes and title changes
 };
 
 } // namespace Graphics
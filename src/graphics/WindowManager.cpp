@@ -1,6 +1,8 @@
 #include "WindowManager.h"
 #include "core/Hash.h"
 #include "core/DataManager.h"
+#include "core/BakedData.h"
+#include <algorithm>
 
 using namespace ShoeEngine::Core;
 
@@ -23,36 +25,50 @@ bool WindowManager::CreateFromJson(const nlohmann::json& jsonData) {
                 return false;
             }
 
-            bool makeNew = true;
-            size_t windowIndex = 0;
-
-            // Check if the window name is already registered
-            for (size_t i = 0; i < m_windowHashes.size(); ++i) {
-                Core::Hash::HashValue window = m_windowHashes[i];
-                if (window == Core::Hash::HashValue(windowName)) {
-                    makeNew = false;
-                    windowIndex = i;
-                    break;
-                }
-            }
-
             // Use default values for optional fields
             std::string title = windowConfig.value("title", "ShoeEngine Window");
-            Core::Hash::HashValue titleHash = m_dataManager.RegisterString(title);
             unsigned int width = windowConfig.value<unsigned int>("width", 800);
             unsigned int height = windowConfig.value<unsigned int>("height", 600);
 
-            Core::Hash::HashValue windowHash = m_dataManager.RegisterString(windowName);
-            m_windowHashes.push_back(windowHash);
+            CreateOrUpdateWindow(windowName, title, width, height);
+        }
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool WindowManager::CreateFromBaked(const Core::BakedSection& section) {
+    const BakedWindow* records = section.GetRecords<BakedWindow>();
+    if (!records && section.GetRecordCount() > 0) {
+        return false;
+    }
 
-            if (makeNew) {
-                m_windows.push_back(std::make_unique<Window>(title, width, height));
-            } else {
-                auto& window = m_windows[windowIndex];
-                window->SetTitleHash(titleHash);
-                window->GetRenderWindow().setTitle(title);
-                window->GetRenderWindow().setSize(sf::Vector2u(width, height));
+    for (size_t i = 0; i < section.GetRecordCount(); ++i) {
+        const BakedWindow& record = records[i];
+        CreateOrUpdateWindow(std::string(section.GetString(record.name)),
+            std::string(section.GetString(record.title)), record.width, record.height);
+    }
+    return true;
+}
+
+bool WindowManager::BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const {
+    if (!jsonData.is_object()) {
+        return false;
+    }
+
+    try {
+        for (const auto& [windowName, windowConfig] : jsonData.items()) {
+            if (!windowConfig.is_object()) {
+                return false;
             }
+
+            BakedWindow record{};
+            record.name = writer.AddString(windowName);
+            record.title = writer.AddString(windowConfig.value("title", "ShoeEngine Window"));
+            record.width = windowConfig.value<unsigned int>("width", 800);
+            record.height = windowConfig.value<unsigned int>("height", 600);
+            writer.AddRecord(record);
         }
         return true;
     } catch (const std::exception&) {
@@ -60,6 +76,36 @@ bool WindowManager::CreateFromJson(const nlohmann::json& jsonData) {
     }
 }
 
+void WindowManager::CreateOrUpdateWindow(const std::string& windowName, const std::string& title,
+    unsigned int width, unsigned int height) {
+    bool makeNew = true;
+    size_t windowIndex = 0;
+
+    // Check if the window name is already registered
+    for (size_t i = 0; i < m_windowHashes.size(); ++i) {
+        Core::Hash::HashValue window = m_windowHashes[i];
+        if (window == Core::Hash::HashValue(windowName)) {
+            makeNew = false;
+            windowIndex = i;
+            break;
+        }
+    }
+
+    Core::Hash::HashValue titleHash = m_dataManager.RegisterString(title);
+    Core::Hash::HashValue windowHash = m_dataManager.RegisterString(windowName);
+    m_windowHashes.push_back(windowHash);
+
+    if (makeNew) {
+        m_windows.push_back(std::make_unique<Window>(title, width, height));
+        m_windows.back()->SetChangeCounter(&m_generation);
+    } else {
+        auto& window = m_windows[windowIndex];
+        window->SetTitleHash(titleHash);
+        window->GetRenderWindow().setTitle(title);
+        window->GetRenderWindow().setSize(sf::Vector2u(width, height));
+    }
+}
+
 Hash::HashValue WindowManager::GetManagedType() const {
     return "windows"_h;
 }
@@ -84,6 +130,12 @@ void WindowManager::ClearAll() {
     }
 }
 
+void WindowManager::Clear() {
+    m_windows.clear();
+    m_windowHashes.clear();
+    MarkDirty();
+}
+
 void WindowManager::DisplayAll() {
     for (auto& window : m_windows) {
         if (window->IsOpen()) {
@@ -96,23 +148,74 @@ const std::vector<std::unique_ptr<Window>>& WindowManager::GetWindows() const {
     return m_windows;
 }
 
+namespace {
+
+// What WindowManager saves of one window
+struct WindowRecord {
+	Hash::HashValue window;
+	Hash::HashValue title;
+	unsigned int width;
+	unsigned int height;
+};
+
+// Copy of the windows' saved state, written by the autosave worker
+class WindowSnapshot : public Core::ManagerSnapshot {
+public:
+	WindowSnapshot(std::vector<WindowRecord> records, const Core::DataManager& dataManager)
+		: m_records(std::move(records))
+		, m_dataManager(dataManager)
+	{
+	}
+
+	void WriteJson(Core::JsonWriter& writer) const override {
+		// Sorted by name like the keys of a dumped tree
+		std::vector<std::pair<std::string_view, const WindowRecord*>> sorted;
+		sorted.reserve(m_records.size());
+		for (const WindowRecord& record : m_records) {
+			sorted.emplace_back(m_dataManager.GetString(record.window), &record);
+		}
+		std::sort(sorted.begin(), sorted.end());
+
+		writer.StartObject();
+		for (const auto& [name, record] : sorted) {
+			// The original window name is the key
+			writer.Key(name);
+			writer.StartObject();
+			writer.Key("height");
+			writer.Unsigned(record->height);
+			writer.Key("title");
+			writer.String(m_dataManager.GetString(record->title));
+			writer.Key("width");
+			writer.Unsigned(record->width);
+			writer.EndObject();
+		}
+		writer.EndObject();
+	}
+
+private:
+	std::vector<WindowRecord> m_records;
+	const Core::DataManager& m_dataManager;
+};
+
+} // namespace
+
 nlohmann::json WindowManager::SerializeToJson() {
-	nlohmann::json windowsObject = nlohmann::json::object();
+	return Core::JsonWriter::ToJson([this](Core::JsonWriter& writer) { WriteJson(writer); });
+}
+
+void WindowManager::WriteJson(Core::JsonWriter& writer) {
+	CreateSnapshot()->WriteJson(writer);
+}
+
+std::unique_ptr<Core::ManagerSnapshot> WindowManager::CreateSnapshot() {
+	std::vector<WindowRecord> records;
+	records.reserve(m_windows.size());
 	// Assume that m_windows and m_windowHashes are kept in sync.
 	for (size_t i = 0; i < m_windows.size(); ++i) {
 		const auto& window = m_windows[i];
-		nlohmann::json windowJson;
-		// These getters are assumed to be available in the Window class.
-		windowJson["title"] = m_dataManager.GetString(window->GetTitleHash());
-		windowJson["width"] = window->GetWidth();
-		windowJson["height"] = window->GetHeight();
-
-		// Retrieve the original window name using the stored hash.
-		std::string windowName = m_dataManager.GetString(m_windowHashes[i]);
-		windowsObject[windowName] = windowJson;
+		records.push_back({ m_windowHashes[i], window->GetTitleHash(), window->GetWidth(), window->GetHeight() });
 	}
-
-	return windowsObject;
+	return std::make_unique<WindowSnapshot>(std::move(records), m_dataManager);
 }
 
 } // namespace Graphics
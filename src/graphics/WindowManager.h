@@ -21,6 +21,17 @@ namespace Graphics {
  */
 class WindowManager : public Core::BaseManager {
 public:
+    /**
+     * @struct BakedWindow
+     * @brief Fixed-layout record of one window in a baked data file
+     */
+    struct BakedWindow {
+        uint32_t name;   ///< Hash of the window name
+        uint32_t title;  ///< Hash of the window title
+        uint32_t width;  ///< Width in pixels
+        uint32_t height; ///< Height in pixels
+    };
+
     /**
      * @brief Constructor
      * @param dataManager Reference to the DataManager for string registration
@@ -39,6 +50,27 @@ public:
      */
     bool CreateFromJson(const nlohmann::json& jsonData) override;
 
+    /**
+     * @brief Windows must be created on the main thread
+     * @return true
+     */
+    bool RequiresMainThread() const override { return true; }
+
+    /**
+     * @brief Creates Window objects from a baked "windows" section
+     * @param section Section of BakedWindow records
+     * @return bool True if windows were created successfully
+     */
+    bool CreateFromBaked(const Core::BakedSection& section) override;
+
+    /**
+     * @brief Bakes a "windows" JSON section into BakedWindow records
+     * @param jsonData JSON data containing window configurations
+     * @param writer Receives the records
+     * @return bool True if the section was valid
+     */
+    bool BakeJson(const nlohmann::json& jsonData, Core::BakedSectionWriter& writer) const override;
+
     /**
      * @brief Returns the type of objects this manager handles
      * @return Core::Hash::HashValue Hash of "windows"
@@ -56,6 +88,11 @@ public:
      */
     void ClearAll();
 
+    /**
+     * @brief Closes and removes all managed windows
+     */
+    void Clear() override;
+
     /**
      * @brief Display all managed windows
      */
@@ -76,7 +113,35 @@ public:
 	*/
 	nlohmann::json SerializeToJson() override;
 
+	/**
+	* @brief Write all managed windows straight into a JSON writer
+	* @param writer Receives an object keyed by window name
+	*/
+	void WriteJson(Core::JsonWriter& writer) override;
+
+	/**
+	* @brief Copies the names, titles and sizes of the windows
+	* @return Snapshot writing the same JSON as WriteJson
+	*/
+	std::unique_ptr<Core::ManagerSnapshot> CreateSnapshot() override;
+
+	/**
+	* @brief Resizes and title changes of the windows bump the generation
+	* @return true
+	*/
+	bool TracksChanges() const override { return true; }
+
 private:
+    /**
+     * @brief Creates a window, or updates it if a window with the name already exists
+     * @param windowName Name of the window
+     * @param title Window title
+     * @param width Width in pixels
+     * @param height Height in pixels
+     */
+    void CreateOrUpdateWindow(const std::string& windowName, const std::string& title,
+        unsigned int width, unsigned int height);
+
     std::vector<std::unique_ptr<Window>> m_windows;  ///< Collection of managed windows
 	std::vector<Core::Hash::HashValue> m_windowHashes;
 };
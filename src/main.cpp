@@ -4,6 +4,7 @@
  */
 
 #include <iostream>
+#include "core/AutoSaver.h"
 #include "core/DataManager.h"
 #include "graphics/WindowManager.h"
 #include "graphics/ImageManager.h"
@@ -11,6 +12,7 @@
 #include "bayou/BayouStateVisualizer.h"
 #include "Input/InputManager.h"
 #include "Input/Input.h"
+#include <chrono>
 #include <vector>
 
 using namespace ShoeEngine;
@@ -29,6 +31,9 @@ int main() {
 		auto stateManager = std::make_unique<Bayou::BayouStateManager>(dataManager);
 		auto inputManager = std::make_unique<Input::InputManager>(dataManager);
 
+		// Keep decoded pixels on disk so later launches skip PNG decoding.
+		imageManager->SetDecodedCacheDirectory("data/cache/images");
+
 		// Save raw pointers before transferring ownership.
 		auto* winManager = windowManager.get();
 		auto* imgManager = imageManager.get();
@@ -40,9 +45,17 @@ int main() {
 		dataManager.RegisterManager(std::move(stateManager));
 		dataManager.RegisterManager(std::move(inputManager));
 
-		// Load game configuration from JSON.
-		if (!dataManager.LoadFromFile("data/data.json")) {
-			throw std::runtime_error("Failed to load game configuration");
+		// Load game configuration, preferring the baked file written by ShoeEngine_bake
+		// unless data.json was edited since.
+		if (!dataManager.LoadFromBakedFile("data/data.bake", "data/data.json")) {
+			// Drop whatever a partly loaded baked file created before loading the JSON.
+			dataManager.ClearManagers();
+			if (!dataManager.LoadFromFile("data/data.json")) {
+				throw std::runtime_error("Failed to load game configuration");
+			}
+		}
+		for (const auto& timing : dataManager.GetSectionTimings()) {
+			std::cout << "Loaded " << timing.name << " in " << timing.milliseconds << " ms" << std::endl;
 		}
 		dataManager.LoadFromFile("data/user/autosave.json");
 
@@ -50,6 +63,9 @@ int main() {
 			throw std::runtime_error("No windows were created from configuration");
 		}
 
+		// Save in the background while playing, so a crash loses at most one interval.
+		Core::AutoSaver autoSaver(dataManager, "data/user/autosave.json", std::chrono::seconds(30));
+
 		// Create the BayouStateVisualizer, using the loaded Bayou state and ImageManager.
 		Bayou::BayouStateVisualizer stateVisualizer(bayouStateManager->GetState(), *imgManager);
 
@@ -69,9 +85,15 @@ int main() {
 			stateVisualizer.Render(*winManager->GetWindows()[0]);
 
 			winManager->DisplayAll();
+
+			autoSaver.Update();
 		}
 
-		dataManager.SaveToFile("data/user/autosave.json");
+		autoSaver.SaveNow();
+		autoSaver.Flush();
+		const auto saveStats = autoSaver.GetStats();
+		std::cout << "Autosaved " << saveStats.savesWritten << " times: " << saveStats.totalSnapshotMilliseconds
+			<< " ms on the main thread, " << saveStats.totalWriteMilliseconds << " ms on the worker" << std::endl;
 
 		return 0;
 	}
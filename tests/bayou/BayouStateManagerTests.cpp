@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "bayou/BayouStateManager.h"
+#include "core/DataManager.h"
+#include "core/Hash.h"
+#include <nlohmann/json.hpp>
+#include <sstream>
+
+using namespace ShoeEngine;
+using namespace ShoeEngine::Bayou;
+using json = nlohmann::json;
+
+class BayouStateManagerTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        json board = json::array();
+        for (int i = 0; i < BayouState::kBoardNumSquares; ++i) {
+            board.push_back(0);
+        }
+        board[3] = BayouState::EncodeOccupied(0, 0);
+        board[60] = BayouState::EncodeOccupied(1, 0);
+
+        stateJson = {
+            {"board", board},
+            {"pieces", {
+                {"player1", {{{"type", "Gator"}, {"boardIndex", 3}}, {{"type", "Skipped"}}}},
+                {"player2", {{{"type", "Frog"}, {"boardIndex", 60}, {"extra", {{"type", "ignored"}}}}}}
+            }},
+            {"unused", {1, 2, 3}}
+        };
+    }
+
+    // Loads a document containing the state through the streaming path
+    static bool LoadStreaming(Core::DataManager& dataManager, const json& state) {
+        std::istringstream input(json{ {"bayou_state", state} }.dump());
+        return dataManager.ProcessStream(input);
+    }
+
+    json stateJson;
+};
+
+TEST_F(BayouStateManagerTests, StreamingMatchesJson) {
+    Core::DataManager jsonDataManager;
+    auto jsonManager = std::make_unique<BayouStateManager>(jsonDataManager);
+    auto* fromJson = jsonManager.get();
+    jsonDataManager.RegisterManager(std::move(jsonManager));
+    ASSERT_TRUE(fromJson->CreateFromJson(stateJson));
+
+    Core::DataManager streamDataManager;
+    auto streamManager = std::make_unique<BayouStateManager>(streamDataManager);
+    auto* fromStream = streamManager.get();
+    streamDataManager.RegisterManager(std::move(streamManager));
+    ASSERT_TRUE(LoadStreaming(streamDataManager, stateJson));
+
+    EXPECT_EQ(fromStream->SerializeToJson(), fromJson->SerializeToJson());
+    EXPECT_EQ(fromStream->GetState().m_numPieces[0], 1);
+    EXPECT_EQ(fromStream->GetState().m_numPieces[1], 1);
+    EXPECT_EQ(fromStream->GetState().m_playerPieces[1][0].m_type, "Frog"_h);
+    EXPECT_EQ(streamDataManager.GetString("Gator"_h), "Gator");
+}
+
+TEST_F(BayouStateManagerTests, StreamingRejectsInvalidStateAndKeepsOldOne) {
+    Core::DataManager dataManager;
+    auto manager = std::make_unique<BayouStateManager>(dataManager);
+    auto* bayou = manager.get();
+    dataManager.RegisterManager(std::move(manager));
+    ASSERT_TRUE(LoadStreaming(dataManager, stateJson));
+
+    json shortBoard = stateJson;
+    shortBoard["board"].erase(0);
+    EXPECT_FALSE(LoadStreaming(dataManager, shortBoard));
+
+    json noPieces = stateJson;
+    noPieces.erase("pieces");
+    EXPECT_FALSE(LoadStreaming(dataManager, noPieces));
+
+    json textBoard = stateJson;
+    textBoard["board"][5] = "x";
+    EXPECT_FALSE(LoadStreaming(dataManager, textBoard));
+
+    EXPECT_EQ(bayou->GetState().m_numPieces[0], 1);
+    EXPECT_EQ(bayou->GetState().m_board[3], BayouState::EncodeOccupied(0, 0));
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "bayou/BayouStateVisualizer.h"
+#include "bayou/BayouState.h"
+#include "graphics/ImageManager.h"
+#include "core/DataManager.h"
+#include "core/Hash.h"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <vector>
+
+using namespace ShoeEngine;
+using namespace ShoeEngine::Bayou;
+using json = nlohmann::json;
+
+class BayouStateVisualizerTests : public ::testing::Test {
+protected:
+    BayouStateVisualizerTests()
+        : imageManager(dataManager)
+    {}
+
+    void SetUp() override {
+        std::vector<uint8_t> small(4 * 4 * 4, 255);
+        std::vector<uint8_t> large(8 * 8 * 4, 128);
+        Graphics::Image(small.data(), 4, 4).SaveToFile("test_alligator.png");
+        Graphics::Image(large.data(), 8, 8).SaveToFile("test_crocodile.png");
+        Graphics::Image(small.data(), 4, 4).SaveToFile("test_player.png");
+
+        json imageJson = {
+            {"alligator", {{"file", "test_alligator.png"}}},
+            {"crocodile", {{"file", "test_crocodile.png"}}},
+            {"player_image", {{"file", "test_player.png"}}}
+        };
+        ASSERT_TRUE(imageManager.CreateFromJson(imageJson));
+    }
+
+    void TearDown() override {
+        std::remove("test_alligator.png");
+        std::remove("test_crocodile.png");
+        std::remove("test_player.png");
+    }
+
+    size_t UploadCount() const {
+        return imageManager.GetTextureCache().GetUploadCount();
+    }
+
+    Core::DataManager dataManager;
+    Graphics::ImageManager imageManager;
+    BayouState state;
+};
+
+TEST_F(BayouStateVisualizerTests, FirstUpdateBindsOccupiedCells) {
+    ASSERT_TRUE(state.PlaceNewPiece(1, 2, 0, "alligator"_h));
+    ASSERT_TRUE(state.PlaceNewPiece(2, 4, 1, "crocodile"_h));
+
+    BayouStateVisualizer visualizer(state, imageManager);
+    visualizer.Update();
+
+    EXPECT_EQ(visualizer.GetLastUpdateStats().cellsChanged, BayouState::kBoardNumSquares);
+    EXPECT_EQ(visualizer.GetLastUpdateStats().imageLookups, 2);
+    EXPECT_EQ(visualizer.GetPieceSprite(0), nullptr);
+
+    const Graphics::Sprite* alligator = visualizer.GetPieceSprite(BayouState::ToIndex(1, 2));
+    ASSERT_NE(alligator, nullptr);
+    auto [x, y] = alligator->GetPosition();
+    EXPECT_FLOAT_EQ(x, 2 * 64.0f);
+    EXPECT_FLOAT_EQ(y, 1 * 64.0f);
+    auto [scaleX, scaleY] = alligator->GetScale();
+    EXPECT_FLOAT_EQ(scaleX, 16.0f);
+    EXPECT_FLOAT_EQ(scaleY, 16.0f);
+
+    const Graphics::Sprite* crocodile = visualizer.GetPieceSprite(BayouState::ToIndex(2, 4));
+    ASSERT_NE(crocodile, nullptr);
+    EXPECT_FLOAT_EQ(crocodile->GetScale().first, 8.0f);
+}
+
+TEST_F(BayouStateVisualizerTests, UnchangedFrameDoesNoWork) {
+    ASSERT_TRUE(state.PlaceNewPiece(1, 2, 0, "alligator"_h));
+    ASSERT_TRUE(state.PlaceNewPiece(2, 4, 1, "crocodile"_h));
+
+    BayouStateVisualizer visualizer(state, imageManager);
+    visualizer.Update();
+    size_t uploads = UploadCount();
+
+    visualizer.Update();
+    const auto& stats = visualizer.GetLastUpdateStats();
+    EXPECT_EQ(stats.cellsChanged, 0);
+    EXPECT_EQ(stats.imageLookups, 0);
+    EXPECT_EQ(stats.spritesRebound, 0);
+    EXPECT_EQ(UploadCount(), uploads);
+}
+
+TEST_F(BayouStateVisualizerTests, OnlyChangedCellsAreTouched) {
+    ASSERT_TRUE(state.PlaceNewPiece(1, 2, 0, "alligator"_h));
+
+    BayouStateVisualizer visualizer(state, imageManager);
+    visualizer.Update();
+
+    ASSERT_TRUE(state.PlaceNewPiece(5, 5, 0, "alligator"_h));
+    visualizer.Update();
+
+    const auto& stats = visualizer.GetLastUpdateStats();
+    EXPECT_EQ(stats.cellsChanged, 1);
+    EXPECT_EQ(stats.imageLookups, 0); // Alligator visual is already cached
+    EXPECT_EQ(stats.spritesRebound, 1);
+    EXPECT_NE(visualizer.GetPieceSprite(BayouState::ToIndex(5, 5)), nullptr);
+}
+
+TEST_F(BayouStateVisualizerTests, CellsShareTexture) {
+    ASSERT_TRUE(state.PlaceNewPiece(0, 0, 0, "alligator"_h));
+    ASSERT_TRUE(state.PlaceNewPiece(0, 1, 1, "alligator"_h));
+
+    BayouStateVisualizer visualizer(state, imageManager);
+    visualizer.Update();
+
+    const Graphics::Sprite* first = visualizer.GetPieceSprite(0);
+    const Graphics::Sprite* second = visualizer.GetPieceSprite(1);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(first->GetTexture(), second->GetTexture());
+    EXPECT_EQ(UploadCount(), 1);
+}
+
+TEST_F(BayouStateVisualizerTests, RemovedPieceIsHidden) {
+    ASSERT_TRUE(state.PlaceNewPiece(3, 3, 0, "crocodile"_h));
+
+    BayouStateVisualizer visualizer(state, imageManager);
+    visualizer.Update();
+    ASSERT_NE(visualizer.GetPieceSprite(BayouState::ToIndex(3, 3)), nullptr);
+
+    ASSERT_TRUE(state.RemovePiece(3, 3));
+    visualizer.Update();
+
+    EXPECT_EQ(visualizer.GetLastUpdateStats().cellsChanged, 1);
+    EXPECT_EQ(visualizer.GetPieceSprite(BayouState::ToIndex(3, 3)), nullptr);
+}
+
+TEST_F(BayouStateVisualizerTests, ChangedPieceTypeRebindsSprite) {
+    ASSERT_TRUE(state.PlaceNewPiece(0, 0, 0, "alligator"_h));
+
+    BayouStateVisualizer visualizer(state, imageManager);
+    visualizer.Update();
+    const sf::Texture* before = visualizer.GetPieceSprite(0)->GetTexture();
+
+    // Same board byte, different piece type
+    state.m_playerPieces[0][0].m_type = "crocodile"_h;
+    visualizer.Update();
+
+    EXPECT_EQ(visualizer.GetLastUpdateStats().cellsChanged, 1);
+    EXPECT_NE(visualizer.GetPieceSprite(0)->GetTexture(), before);
+}
+
+TEST_F(BayouStateVisualizerTests, InvalidateRebuildsEveryCell) {
+    ASSERT_TRUE(state.PlaceNewPiece(0, 0, 0, "alligator"_h));
+
+    BayouStateVisualizer visualizer(state, imageManager);
+    visualizer.Update();
+    visualizer.Invalidate();
+    visualizer.Update();
+
+    EXPECT_EQ(visualizer.GetLastUpdateStats().cellsChanged, BayouState::kBoardNumSquares);
+    EXPECT_EQ(visualizer.GetLastUpdateStats().imageLookups, 1);
+    EXPECT_EQ(visualizer.GetLastUpdateStats().spritesRebound, 0); // Texture did not change
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "bayou/BoardRenderer.h"
+
+using namespace ShoeEngine::Bayou;
+
+TEST(BoardRendererTests, GeometryIsBuiltOnce) {
+    BoardRenderer renderer(64, 8);
+    EXPECT_EQ(renderer.GetGeometryBuildCount(), 0);
+
+    const sf::VertexArray& grid = renderer.GetGridGeometry();
+    EXPECT_EQ(grid.getVertexCount(), 4 * (8 + 1));
+    EXPECT_EQ(renderer.GetGeometryBuildCount(), 1);
+
+    renderer.GetGridGeometry();
+    renderer.GetBackgroundGeometry();
+    EXPECT_EQ(renderer.GetGeometryBuildCount(), 1);
+}
+
+TEST(BoardRendererTests, GeometryRebuiltOnlyWhenLayoutChanges) {
+    BoardRenderer renderer(64, 8);
+    renderer.GetGridGeometry();
+
+    renderer.SetTileSize(64);
+    renderer.SetGridCount(8);
+    renderer.GetGridGeometry();
+    EXPECT_EQ(renderer.GetGeometryBuildCount(), 1);
+
+    renderer.SetTileSize(32);
+    const sf::VertexArray& grid = renderer.GetGridGeometry();
+    EXPECT_EQ(renderer.GetGeometryBuildCount(), 2);
+    EXPECT_FLOAT_EQ(grid[1].position.y, 8 * 32.0f);
+
+    renderer.SetGridCount(10);
+    EXPECT_EQ(renderer.GetGridGeometry().getVertexCount(), 4 * (10 + 1));
+    EXPECT_EQ(renderer.GetGeometryBuildCount(), 3);
+}
+
+TEST(BoardRendererTests, BackgroundGeometry) {
+    BoardRenderer renderer(64, 4);
+    EXPECT_EQ(renderer.GetBackgroundGeometry().getVertexCount(), 0);
+
+    renderer.SetBackgroundColor(sf::Color(20, 60, 20));
+    const sf::VertexArray& background = renderer.GetBackgroundGeometry();
+    ASSERT_EQ(background.getVertexCount(), 6);
+    EXPECT_FLOAT_EQ(background[2].position.x, 4 * 64.0f);
+    EXPECT_FLOAT_EQ(background[2].position.y, 4 * 64.0f);
+}
+
+TEST(BoardRendererTests, GetBoardCellRespectsGridCount) {
+    BoardRenderer renderer(10, 4);
+    int row = -1;
+    int col = -1;
+
+    EXPECT_TRUE(renderer.GetBoardCell(35.0f, 12.0f, row, col));
+    EXPECT_EQ(row, 1);
+    EXPECT_EQ(col, 3);
+
+    EXPECT_FALSE(renderer.GetBoardCell(45.0f, 12.0f, row, col));
+    EXPECT_FALSE(renderer.GetBoardCell(-1.0f, 12.0f, row, col));
+
+    renderer.SetGridCount(6);
+    EXPECT_TRUE(renderer.GetBoardCell(45.0f, 12.0f, row, col));
+    EXPECT_EQ(col, 4);
+}
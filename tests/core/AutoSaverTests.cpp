@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include "../../src/core/AutoSaver.h"
+#include "../../src/core/DataManager.h"
+#include "../../src/core/Hash.h"
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace ShoeEngine::Core;
+
+namespace {
+
+// Manager holding a counter; its snapshots copy the counter and can be held back or fail
+class CounterManager : public BaseManager {
+public:
+    explicit CounterManager(DataManager& dataManager) : BaseManager(dataManager) {
+        dataManager.RegisterString("counter");
+    }
+
+    bool CreateFromJson(const nlohmann::json& jsonData) override {
+        m_value = jsonData.value("value", 0);
+        return true;
+    }
+    Hash::HashValue GetManagedType() const override { return "counter"_h; }
+
+    nlohmann::json SerializeToJson() override {
+        return { { "value", m_value } };
+    }
+
+    std::unique_ptr<ManagerSnapshot> CreateSnapshot() override {
+        return std::make_unique<Snapshot>(*this, m_value);
+    }
+
+    // While closed, serializing a snapshot blocks
+    void SetGateOpen(bool open) {
+        {
+            std::lock_guard<std::mutex> lock(m_gateMutex);
+            m_gateOpen = open;
+        }
+        m_gateCondition.notify_all();
+    }
+
+    int m_value = 0;
+    bool m_failWrites = false;
+    std::atomic<int> m_serializing{ 0 };
+    std::atomic<std::thread::id> m_serializeThread;
+
+private:
+    struct Snapshot : ManagerSnapshot {
+        Snapshot(CounterManager& owner, int value) : m_owner(owner), m_value(value) {}
+
+        void WriteJson(JsonWriter& writer) const override {
+            m_owner.m_serializeThread = std::this_thread::get_id();
+            ++m_owner.m_serializing;
+            std::unique_lock<std::mutex> lock(m_owner.m_gateMutex);
+            m_owner.m_gateCondition.wait(lock, [this]() { return m_owner.m_gateOpen; });
+            if (m_owner.m_failWrites) {
+                throw std::runtime_error("write failed");
+            }
+            writer.StartObject();
+            writer.Key("value");
+            writer.Integer(m_value);
+            writer.EndObject();
+        }
+
+        CounterManager& m_owner;
+        int m_value;
+    };
+
+    std::mutex m_gateMutex;
+    std::condition_variable m_gateCondition;
+    bool m_gateOpen = true;
+};
+
+nlohmann::json ReadJson(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    return nlohmann::json::parse(file);
+}
+
+} // namespace
+
+class AutoSaverTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_directory = std::filesystem::temp_directory_path() / "shoe_autosaver_tests";
+        std::filesystem::remove_all(m_directory);
+        m_filePath = m_directory / "user" / "autosave.json";
+
+        auto manager = std::make_unique<CounterManager>(m_dataManager);
+        m_manager = manager.get();
+        m_dataManager.RegisterManager(std::move(manager));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_directory);
+    }
+
+    DataManager m_dataManager;
+    CounterManager* m_manager = nullptr;
+    std::filesystem::path m_directory;
+    std::filesystem::path m_filePath;
+};
+
+TEST_F(AutoSaverTest, WritesSnapshotOnWorkerThread) {
+    AutoSaver autoSaver(m_dataManager, m_filePath.string(), std::chrono::hours(1));
+    m_manager->m_value = 7;
+    autoSaver.SaveNow();
+    autoSaver.Flush();
+
+    EXPECT_EQ(ReadJson(m_filePath)["counter"]["value"], 7);
+    EXPECT_FALSE(std::filesystem::exists(m_filePath.string() + ".tmp"));
+    EXPECT_NE(m_manager->m_serializeThread.load(), std::this_thread::get_id());
+
+    const AutoSaver::Stats stats = autoSaver.GetStats();
+    EXPECT_EQ(stats.savesRequested, 1u);
+    EXPECT_EQ(stats.savesWritten, 1u);
+    EXPECT_EQ(stats.savesFailed, 0u);
+    EXPECT_GE(stats.totalSnapshotMilliseconds, 0.0);
+    EXPECT_GE(stats.totalWriteMilliseconds, 0.0);
+}
+
+TEST_F(AutoSaverTest, SavesStateAtSnapshotTime) {
+    AutoSaver autoSaver(m_dataManager, m_filePath.string(), std::chrono::hours(1));
+    m_manager->SetGateOpen(false);
+    m_manager->m_value = 1;
+    autoSaver.SaveNow();
+
+    // The game keeps changing state while the worker is serializing
+    while (m_manager->m_serializing == 0) {
+        std::this_thread::yield();
+    }
+    m_manager->m_value = 2;
+    m_manager->SetGateOpen(true);
+    autoSaver.Flush();
+
+    EXPECT_EQ(ReadJson(m_filePath)["counter"]["value"], 1);
+}
+
+TEST_F(AutoSaverTest, NewerSnapshotReplacesWaitingOne) {
+    AutoSaver autoSaver(m_dataManager, m_filePath.string(), std::chrono::hours(1));
+    m_manager->SetGateOpen(false);
+    autoSaver.SaveNow();
+    while (m_manager->m_serializing == 0) {
+        std::this_thread::yield();
+    }
+
+    // The worker is busy, so only the last of these is written after it
+    for (int value = 1; value <= 3; ++value) {
+        m_manager->m_value = value;
+        autoSaver.SaveNow();
+    }
+    m_manager->SetGateOpen(true);
+    autoSaver.Flush();
+
+    const AutoSaver::Stats stats = autoSaver.GetStats();
+    EXPECT_EQ(stats.savesRequested, 4u);
+    EXPECT_EQ(stats.savesReplaced, 2u);
+    EXPECT_EQ(stats.savesWritten, 2u);
+    EXPECT_EQ(ReadJson(m_filePath)["counter"]["value"], 3);
+}
+
+TEST_F(AutoSaverTest, UpdateWaitsForInterval) {
+    {
+        AutoSaver autoSaver(m_dataManager, m_filePath.string(), std::chrono::hours(1));
+        EXPECT_FALSE(autoSaver.Update());
+    }
+    EXPECT_FALSE(std::filesystem::exists(m_filePath));
+
+    AutoSaver autoSaver(m_dataManager, m_filePath.string(), std::chrono::milliseconds(0));
+    EXPECT_TRUE(autoSaver.Update());
+    autoSaver.Flush();
+    EXPECT_TRUE(std::filesystem::exists(m_filePath));
+}
+
+TEST_F(AutoSaverTest, FailedWriteKeepsPreviousFile) {
+    m_manager->m_value = 5;
+    ASSERT_TRUE(m_dataManager.SaveToFile(m_filePath.string()));
+
+    m_manager->m_value = 6;
+    m_manager->m_failWrites = true;
+    AutoSaver autoSaver(m_dataManager, m_filePath.string(), std::chrono::hours(1));
+    autoSaver.SaveNow();
+    autoSaver.Flush();
+
+    EXPECT_EQ(autoSaver.GetStats().savesFailed, 1u);
+    EXPECT_EQ(ReadJson(m_filePath)["counter"]["value"], 5);
+    EXPECT_FALSE(std::filesystem::exists(m_filePath.string() + ".tmp"));
+}
+
+TEST_F(AutoSaverTest, CompactsDeltaIntoMainFile) {
+    const std::string deltaPath = (m_directory / "user" / "autosave.delta").string();
+    AutoSaver autoSaver(m_dataManager, m_filePath.string(), std::chrono::hours(1));
+    autoSaver.SetDeltaFile(deltaPath, 3);
+
+    for (int value = 1; value <= 2; ++value) {
+        m_manager->m_value = value;
+        autoSaver.SaveNow();
+        autoSaver.Flush();
+    }
+    EXPECT_FALSE(std::filesystem::exists(m_filePath));
+    EXPECT_TRUE(std::filesystem::exists(deltaPath));
+
+    // The third save folds the delta into the main file
+    m_manager->m_value = 3;
+    autoSaver.SaveNow();
+    autoSaver.Flush();
+    EXPECT_EQ(ReadJson(m_filePath)["counter"]["value"], 3);
+    EXPECT_FALSE(std::filesystem::exists(deltaPath));
+
+    m_manager->m_value = 4;
+    autoSaver.SaveNow();
+    autoSaver.Flush();
+
+    const AutoSaver::Stats stats = autoSaver.GetStats();
+    EXPECT_EQ(stats.deltasAppended, 4u);
+    EXPECT_EQ(stats.compactions, 1u);
+
+    DataManager loaded;
+    auto manager = std::make_unique<CounterManager>(loaded);
+    CounterManager* loadedManager = manager.get();
+    loaded.RegisterManager(std::move(manager));
+    ASSERT_TRUE(loaded.LoadFromFileWithDelta(m_filePath.string(), deltaPath));
+    EXPECT_EQ(loadedManager->m_value, 4);
+}
@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+#include "core/BakedData.h"
+#include "core/DataManager.h"
+#include "graphics/WindowManager.h"
+#include "graphics/ImageManager.h"
+#include "graphics/SpriteManager.h"
+#include "graphics/AnimationManager.h"
+#include "bayou/BayouStateManager.h"
+#include "Input/InputManager.h"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <fstream>
+
+using namespace ShoeEngine;
+using namespace ShoeEngine::Core;
+using json = nlohmann::json;
+
+namespace {
+
+// The managers of one DataManager, kept so their state can be compared after loading
+struct Engine {
+    Engine() {
+        auto windows = std::make_unique<Graphics::WindowManager>(dataManager);
+        auto images = std::make_unique<Graphics::ImageManager>(dataManager);
+        auto sprites = std::make_unique<Graphics::SpriteManager>(dataManager, *images);
+        auto animations = std::make_unique<Graphics::AnimationManager>(dataManager, *images, *sprites);
+        auto bayou = std::make_unique<Bayou::BayouStateManager>(dataManager);
+        auto input = std::make_unique<Input::InputManager>(dataManager);
+        managers = { windows.get(), images.get(), sprites.get(), animations.get(), bayou.get(), input.get() };
+        dataManager.RegisterManager(std::move(windows));
+        dataManager.RegisterManager(std::move(images));
+        dataManager.RegisterManager(std::move(sprites));
+        dataManager.RegisterManager(std::move(animations));
+        dataManager.RegisterManager(std::move(bayou));
+        dataManager.RegisterManager(std::move(input));
+    }
+
+    DataManager dataManager;
+    std::vector<BaseManager*> managers;
+};
+
+} // namespace
+
+class BakedDataTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::vector<uint8_t> white(4 * 4 * 4, 255);
+        std::vector<uint8_t> red(2 * 3 * 4, 0);
+        for (size_t i = 0; i < red.size(); i += 4) {
+            red[i] = 255;
+            red[i + 3] = 255;
+        }
+        Graphics::Image(white.data(), 4, 4).SaveToFile("baked_white.png");
+        Graphics::Image(red.data(), 2, 3).SaveToFile("baked_red.png");
+
+        json board = json::array();
+        for (int i = 0; i < 64; ++i) {
+            board.push_back(0);
+        }
+        board[3] = 1;
+        board[60] = 3;
+
+        testJson = {
+            {"windows", {
+                {"main", {{"title", "Baked Window"}, {"width", 640}, {"height", 480}}}
+            }},
+            {"images", {
+                {"white", {{"file", "baked_white.png"}}},
+                {"red", {{"file", "baked_red.png"}, {"atlas", "pieces"}}},
+                {"white_atlas", {{"file", "baked_white.png"}, {"atlas", "pieces"}}}
+            }},
+            {"sprites", {
+                {"hero", {
+                    {"image", "white"},
+                    {"position", {{"x", 10.0f}, {"y", 20.0f}}},
+                    {"rotation", 45.0f},
+                    {"scale", {{"x", 2.0f}, {"y", 0.5f}}},
+                    {"layer", 3},
+                    {"depth", -1.5f}
+                }},
+                {"marker", {{"image", "red"}}}
+            }},
+            {"animations", {
+                {"blink", {
+                    {"image", "white_atlas"},
+                    {"loop", "pingpong"},
+                    {"frames", {
+                        {{"x", 0}, {"y", 0}, {"width", 2}, {"height", 2}},
+                        {{"x", 2}, {"y", 2}, {"width", 2}, {"height", 2}, {"duration", 0.5f}}
+                    }},
+                    {"sprites", {"hero"}}
+                }}
+            }},
+            {"bayou_state", {
+                {"board", board},
+                {"pieces", {
+                    {"player1", {{{"type", "Gator"}, {"boardIndex", 3}}}},
+                    {"player2", {{{"type", "Frog"}, {"boardIndex", 60}}}}
+                }}
+            }},
+            {"inputs", {
+                {"gameplay", {
+                    {{"name", "jump"}, {"type", "keyboard"}, {"key", "Space"}},
+                    {{"name", "fire"}, {"type", "mouseButton"}, {"button", 1}},
+                    {{"name", "look"}, {"type", "mouseAxis"}, {"axis", "x"}}
+                }}
+            }}
+        };
+    }
+
+    void TearDown() override {
+        std::remove("baked_white.png");
+        std::remove("baked_red.png");
+        std::remove("baked_test.bake");
+        std::remove("baked_source.json");
+    }
+
+    json testJson;
+};
+
+TEST_F(BakedDataTests, RoundTripMatchesJson) {
+    Engine fromJson;
+    ASSERT_TRUE(fromJson.dataManager.ProcessData(testJson));
+
+    Engine baker;
+    ASSERT_TRUE(baker.dataManager.BakeToFile(testJson, "baked_test.bake"));
+
+    Engine fromBaked;
+    ASSERT_TRUE(fromBaked.dataManager.LoadFromBakedFile("baked_test.bake"));
+
+    for (size_t i = 0; i < fromJson.managers.size(); ++i) {
+        EXPECT_EQ(fromJson.managers[i]->SerializeToJson(), fromBaked.managers[i]->SerializeToJson())
+            << "Manager " << fromJson.dataManager.GetString(fromJson.managers[i]->GetManagedType());
+    }
+}
+
+TEST_F(BakedDataTests, BakingIsDeterministic) {
+    Engine first;
+    BakedWriter firstWriter;
+    ASSERT_TRUE(first.dataManager.BakeJson(testJson, firstWriter));
+
+    Engine second;
+    BakedWriter secondWriter;
+    ASSERT_TRUE(second.dataManager.BakeJson(testJson, secondWriter));
+
+    EXPECT_EQ(firstWriter.WriteToBuffer(), secondWriter.WriteToBuffer());
+}
+
+TEST_F(BakedDataTests, StringsAreRegisteredOnLoad) {
+    Engine baker;
+    BakedWriter writer;
+    ASSERT_TRUE(baker.dataManager.BakeJson(testJson, writer));
+
+    BakedFile file;
+    ASSERT_TRUE(file.OpenFromMemory(writer.WriteToBuffer()));
+    EXPECT_EQ(file.GetString("Baked Window"_h), "Baked Window");
+    EXPECT_TRUE(file.GetString("not baked"_h).empty());
+
+    Engine loaded;
+    ASSERT_TRUE(loaded.dataManager.ProcessBaked(file));
+    EXPECT_EQ(loaded.dataManager.GetString("hero"_h), "hero");
+    EXPECT_EQ(loaded.dataManager.GetString("Gator"_h), "Gator");
+}
+
+TEST_F(BakedDataTests, RejectsCorruptFiles) {
+    Engine baker;
+    BakedWriter writer;
+    ASSERT_TRUE(baker.dataManager.BakeJson(testJson, writer));
+    const std::vector<uint8_t> bytes = writer.WriteToBuffer();
+
+    // Wrong magic
+    std::vector<uint8_t> badMagic = bytes;
+    badMagic[0] = 'X';
+    EXPECT_FALSE(BakedFile().OpenFromMemory(badMagic));
+
+    // Truncated records
+    std::vector<uint8_t> truncated(bytes.begin(), bytes.end() - 16);
+    EXPECT_FALSE(BakedFile().OpenFromMemory(truncated));
+
+    // Section records pointing past the end of the file
+    std::vector<uint8_t> badOffset = bytes;
+    Baked::SectionHeader section;
+    std::memcpy(&section, badOffset.data() + sizeof(Baked::FileHeader), sizeof(section));
+    section.offset = static_cast<uint32_t>(bytes.size());
+    std::memcpy(badOffset.data() + sizeof(Baked::FileHeader), &section, sizeof(section));
+    EXPECT_FALSE(BakedFile().OpenFromMemory(badOffset));
+
+    // Missing file
+    Engine loaded;
+    EXPECT_FALSE(loaded.dataManager.LoadFromBakedFile("missing.bake"));
+}
+
+TEST_F(BakedDataTests, MismatchedRecordSizeFailsLoad) {
+    BakedWriter writer;
+    writer.AddString("windows");
+    BakedSectionWriter& section = writer.AddSection("windows"_h);
+    const uint32_t notAWindow = 7;
+    section.AddRecord(notAWindow);
+
+    BakedFile file;
+    ASSERT_TRUE(file.OpenFromMemory(writer.WriteToBuffer()));
+
+    Engine loaded;
+    EXPECT_FALSE(loaded.dataManager.ProcessBaked(file));
+}
+
+TEST_F(BakedDataTests, StringCollisionRejectsBake) {
+    // These two strings share the same 32-bit FNV-1a hash
+    testJson["windows"] = {
+        {"key_131459", {{"title", "First"}}},
+        {"key_1404192", {{"title", "Second"}}}
+    };
+
+    Engine baker;
+    BakedWriter writer;
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(baker.dataManager.BakeJson(testJson, writer));
+    EXPECT_NE(testing::internal::GetCapturedStderr().find("key_1404192"), std::string::npos);
+    EXPECT_EQ(writer.GetCollisionCount(), 1u);
+}
+
+TEST_F(BakedDataTests, StaleBakeIsNotLoaded) {
+    std::ofstream("baked_source.json") << testJson.dump();
+    Hash::HashValue64 sourceHash;
+    ASSERT_TRUE(Hash::HashFile("baked_source.json", sourceHash));
+
+    Engine baker;
+    ASSERT_TRUE(baker.dataManager.BakeToFile(testJson, "baked_test.bake", sourceHash));
+
+    Engine current;
+    EXPECT_TRUE(current.dataManager.LoadFromBakedFile("baked_test.bake", "baked_source.json"));
+    Engine withoutSource;
+    EXPECT_TRUE(withoutSource.dataManager.LoadFromBakedFile("baked_test.bake", "missing_source.json"));
+
+    testJson["windows"]["main"]["title"] = "Edited";
+    std::ofstream("baked_source.json") << testJson.dump();
+    Engine stale;
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(stale.dataManager.LoadFromBakedFile("baked_test.bake", "baked_source.json"));
+    EXPECT_NE(testing::internal::GetCapturedStderr().find("stale"), std::string::npos);
+    EXPECT_EQ(stale.dataManager.GetString("Baked Window"_h), "");
+}
+
+TEST_F(BakedDataTests, ClearManagersUndoesPartialLoad) {
+    BakedWriter writer;
+    Engine baker;
+    ASSERT_TRUE(baker.dataManager.BakeJson(testJson, writer));
+    // A section the image manager cannot read fails the load after the windows were created
+    writer.AddString("images");
+    writer.AddSection("images"_h).AddRecord(uint32_t{ 7 });
+    BakedFile file;
+    ASSERT_TRUE(file.OpenFromMemory(writer.WriteToBuffer()));
+
+    Engine loaded;
+    ASSERT_FALSE(loaded.dataManager.ProcessBaked(file));
+    loaded.dataManager.ClearManagers();
+    ASSERT_TRUE(loaded.dataManager.ProcessData(testJson));
+
+    Engine fromJson;
+    ASSERT_TRUE(fromJson.dataManager.ProcessData(testJson));
+    for (size_t i = 0; i < fromJson.managers.size(); ++i) {
+        EXPECT_EQ(fromJson.managers[i]->SerializeToJson(), loaded.managers[i]->SerializeToJson())
+            << "Manager " << fromJson.dataManager.GetString(fromJson.managers[i]->GetManagedType());
+    }
+}
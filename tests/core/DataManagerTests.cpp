@@ -1,7 +1,15 @@
 #include <gtest/gtest.h>
 #include "../../src/core/DataManager.h"
 #include "../../src/core/Hash.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 using namespace ShoeEngine::Core;
 
@@ -24,6 +32,103 @@ private:
     nlohmann::json m_lastData;
 };
 
+// Mock manager opting into streaming; records the events of its section
+class StreamingMockManager : public BaseManager {
+public:
+    StreamingMockManager(DataManager& dataManager, Hash::HashValue type)
+        : BaseManager(dataManager)
+        , m_type(type) {}
+
+    bool CreateFromJson(const nlohmann::json&) override {
+        ++m_jsonCalls;
+        return true;
+    }
+    Hash::HashValue GetManagedType() const override { return m_type; }
+
+    std::unique_ptr<JsonStreamHandler> CreateFromStream() override {
+        return std::make_unique<Recorder>(*this);
+    }
+
+    std::vector<std::string> m_events;
+    int m_jsonCalls = 0;
+    int m_finishCalls = 0;
+    bool m_rejectStrings = false;
+
+private:
+    struct Recorder : JsonStreamHandler {
+        explicit Recorder(StreamingMockManager& owner) : m_owner(owner) {}
+        bool Unsigned(uint64_t value) override { m_owner.m_events.push_back("u:" + std::to_string(value)); return true; }
+        bool String(const std::string& value) override {
+            m_owner.m_events.push_back("s:" + value);
+            return !m_owner.m_rejectStrings;
+        }
+        bool StartObject() override { m_owner.m_events.push_back("{"); return true; }
+        bool Key(const std::string& key) override { m_owner.m_events.push_back("k:" + key); return true; }
+        bool EndObject() override { m_owner.m_events.push_back("}"); return true; }
+        bool StartArray() override { m_owner.m_events.push_back("["); return true; }
+        bool EndArray() override { m_owner.m_events.push_back("]"); return true; }
+        bool Finish() override { ++m_owner.m_finishCalls; return true; }
+        StreamingMockManager& m_owner;
+    };
+
+    Hash::HashValue m_type;
+};
+
+// Mock manager with dependencies; runs a callback when its section loads
+class DependentMockManager : public BaseManager {
+public:
+    DependentMockManager(DataManager& dataManager, Hash::HashValue type, std::vector<Hash::HashValue> dependencies,
+        std::function<bool()> onLoad, bool requiresMainThread = false)
+        : BaseManager(dataManager)
+        , m_type(type)
+        , m_dependencies(std::move(dependencies))
+        , m_onLoad(std::move(onLoad))
+        , m_requiresMainThread(requiresMainThread) {}
+
+    bool CreateFromJson(const nlohmann::json&) override { return m_onLoad(); }
+    Hash::HashValue GetManagedType() const override { return m_type; }
+    std::vector<Hash::HashValue> GetDependencies() const override { return m_dependencies; }
+    bool RequiresMainThread() const override { return m_requiresMainThread; }
+
+private:
+    Hash::HashValue m_type;
+    std::vector<Hash::HashValue> m_dependencies;
+    std::function<bool()> m_onLoad;
+    bool m_requiresMainThread;
+};
+
+// Mock manager tracking changes; counts the snapshots taken of it
+class TrackedMockManager : public BaseManager {
+public:
+    TrackedMockManager(DataManager& dataManager, const std::string& type)
+        : BaseManager(dataManager)
+        , m_type(dataManager.RegisterString(type)) {}
+
+    bool CreateFromJson(const nlohmann::json& jsonData) override {
+        m_data = jsonData;
+        return true;
+    }
+    Hash::HashValue GetManagedType() const override { return m_type; }
+    nlohmann::json SerializeToJson() override { return m_data; }
+    bool TracksChanges() const override { return true; }
+
+    std::unique_ptr<ManagerSnapshot> CreateSnapshot() override {
+        ++m_snapshots;
+        return BaseManager::CreateSnapshot();
+    }
+
+    void SetData(nlohmann::json data) {
+        m_data = std::move(data);
+        MarkDirty();
+    }
+
+    int m_snapshots = 0;
+
+private:
+    Hash::HashValue m_type;
+    nlohmann::json m_data;
+};
+
 class DataManagerTest : public ::testing::Test {
 protected:
     DataManager dataManager;
@@ -94,3 +199,314 @@ TEST_F(DataManagerTest, RegisterDuplicateString) {
     EXPECT_EQ(hash1, hash2);
     EXPECT_EQ(dataManager.GetString(hash1), testString);
 }
+
+TEST_F(DataManagerTest, StreamRoutesEventsToStreamingManager) {
+    auto manager = std::make_unique<StreamingMockManager>(dataManager, "streamed"_h);
+    auto* streamed = manager.get();
+    dataManager.RegisterManager(std::move(manager));
+
+    std::istringstream input(R"({"streamed": {"a": [1, "x"], "b": {}}})");
+    EXPECT_TRUE(dataManager.ProcessStream(input));
+
+    const std::vector<std::string> expected = { "{", "k:a", "[", "u:1", "s:x", "]", "k:b", "{", "}", "}" };
+    EXPECT_EQ(streamed->m_events, expected);
+    EXPECT_EQ(streamed->m_finishCalls, 1);
+    EXPECT_EQ(streamed->m_jsonCalls, 0);
+}
+
+TEST_F(DataManagerTest, StreamBuildsSectionTreeForOtherManagers) {
+    auto manager = std::make_unique<MockManager>(dataManager, "tree"_h);
+    auto* tree = manager.get();
+    dataManager.RegisterManager(std::move(manager));
+
+    std::istringstream input(R"({"unknown": {"big": [1, 2, 3]}, "tree": {"key": ["value", {"n": 2.5}]}})");
+    EXPECT_TRUE(dataManager.ProcessStream(input));
+
+    const nlohmann::json expected = { {"key", {"value", {{"n", 2.5}}}} };
+    EXPECT_EQ(tree->GetLastData(), expected);
+}
+
+TEST_F(DataManagerTest, StreamMatchesProcessData) {
+    nlohmann::json data = {
+        {"tree", {{"list", {1, -2, 3.5, true, nullptr, "s"}}, {"nested", {{"a", {{"b", {}}}}}}}},
+        {"other", 7}
+    };
+
+    auto manager = std::make_unique<MockManager>(dataManager, "tree"_h);
+    auto* streamed = manager.get();
+    dataManager.RegisterManager(std::move(manager));
+    std::istringstream input(data.dump());
+    EXPECT_TRUE(dataManager.ProcessStream(input));
+
+    DataManager domDataManager;
+    auto domManager = std::make_unique<MockManager>(domDataManager, "tree"_h);
+    auto* dom = domManager.get();
+    domDataManager.RegisterManager(std::move(domManager));
+    EXPECT_TRUE(domDataManager.ProcessData(data));
+
+    EXPECT_EQ(streamed->GetLastData(), dom->GetLastData());
+}
+
+TEST_F(DataManagerTest, StreamFailures) {
+    auto manager = std::make_unique<StreamingMockManager>(dataManager, "streamed"_h);
+    auto* streamed = manager.get();
+    dataManager.RegisterManager(std::move(manager));
+
+    // No registered section
+    std::istringstream unknown(R"({"unknown": {}})");
+    EXPECT_FALSE(dataManager.ProcessStream(unknown));
+
+    // Root is not an object
+    std::istringstream array(R"([{"streamed": {}}])");
+    EXPECT_FALSE(dataManager.ProcessStream(array));
+
+    // Syntax error
+    std::istringstream broken(R"({"streamed": {"a": )");
+    EXPECT_FALSE(dataManager.ProcessStream(broken));
+
+    // A handler rejecting an event fails the section and skips the rest of it
+    streamed->m_events.clear();
+    streamed->m_finishCalls = 0;
+    streamed->m_rejectStrings = true;
+    std::istringstream rejected(R"({"streamed": {"a": "x", "b": 1}})");
+    EXPECT_FALSE(dataManager.ProcessStream(rejected));
+    const std::vector<std::string> expected = { "{", "k:a", "s:x" };
+    EXPECT_EQ(streamed->m_events, expected);
+    EXPECT_EQ(streamed->m_finishCalls, 0);
+}
+
+TEST_F(DataManagerTest, DependenciesLoadFirst) {
+    for (size_t threads : { 1, 4 }) {
+        DataManager manager;
+        manager.SetLoadThreadCount(threads);
+        std::mutex mutex;
+        std::vector<std::string> order;
+        auto record = [&](const std::string& name) {
+            return [&, name]() {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back(name);
+                return true;
+            };
+        };
+        // Keys are visited alphabetically, so without dependencies "a" would load first
+        manager.RegisterString("a");
+        manager.RegisterString("b");
+        manager.RegisterString("c");
+        manager.RegisterManager(std::make_unique<DependentMockManager>(manager, "a"_h, std::vector<Hash::HashValue>{ "b"_h }, record("a")));
+        manager.RegisterManager(std::make_unique<DependentMockManager>(manager, "b"_h, std::vector<Hash::HashValue>{ "c"_h }, record("b")));
+        manager.RegisterManager(std::make_unique<DependentMockManager>(manager, "c"_h, std::vector<Hash::HashValue>{ "missing"_h }, record("c")));
+
+        EXPECT_TRUE(manager.ProcessData({ {"a", {}}, {"b", {}}, {"c", {}} }));
+        const std::vector<std::string> expected = { "c", "b", "a" };
+        EXPECT_EQ(order, expected) << threads << " threads";
+
+        ASSERT_EQ(manager.GetSectionTimings().size(), 3u);
+        EXPECT_EQ(manager.GetSectionTimings()[0].name, "a");
+        EXPECT_TRUE(manager.GetSectionTimings()[0].succeeded);
+        EXPECT_GE(manager.GetSectionTimings()[0].milliseconds, 0.0);
+    }
+}
+
+TEST_F(DataManagerTest, DependencyCycleFailsWithoutLoading) {
+    int loads = 0;
+    auto count = [&loads]() { ++loads; return true; };
+    dataManager.RegisterManager(std::make_unique<DependentMockManager>(dataManager, "a"_h, std::vector<Hash::HashValue>{ "b"_h }, count));
+    dataManager.RegisterManager(std::make_unique<DependentMockManager>(dataManager, "b"_h, std::vector<Hash::HashValue>{ "a"_h }, count));
+
+    EXPECT_FALSE(dataManager.ProcessData({ {"a", {}}, {"b", {}} }));
+    EXPECT_EQ(loads, 0);
+}
+
+TEST_F(DataManagerTest, IndependentSectionsLoadConcurrently) {
+    dataManager.SetLoadThreadCount(4);
+
+    // Each section waits for the other one to start, which only succeeds if they overlap
+    std::mutex mutex;
+    std::condition_variable started;
+    int running = 0;
+    auto waitForOther = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++running;
+        started.notify_all();
+        return started.wait_for(lock, std::chrono::seconds(5), [&running]() { return running == 2; });
+    };
+    dataManager.RegisterManager(std::make_unique<DependentMockManager>(dataManager, "a"_h, std::vector<Hash::HashValue>{}, waitForOther));
+    dataManager.RegisterManager(std::make_unique<DependentMockManager>(dataManager, "b"_h, std::vector<Hash::HashValue>{}, waitForOther));
+
+    EXPECT_TRUE(dataManager.ProcessData({ {"a", {}}, {"b", {}} }));
+}
+
+TEST_F(DataManagerTest, MainThreadSectionsRunOnCallingThread) {
+    dataManager.SetLoadThreadCount(4);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<bool> onCaller{ false };
+    std::atomic<bool> failedDependencyRan{ false };
+
+    dataManager.RegisterManager(std::make_unique<DependentMockManager>(dataManager, "window"_h, std::vector<Hash::HashValue>{ "worker"_h },
+        [&]() { onCaller = std::this_thread::get_id() == caller; return true; }, true));
+    dataManager.RegisterManager(std::make_unique<DependentMockManager>(dataManager, "worker"_h, std::vector<Hash::HashValue>{},
+        []() { return false; }));
+    dataManager.RegisterManager(std::make_unique<DependentMockManager>(dataManager, "after"_h, std::vector<Hash::HashValue>{ "worker"_h },
+        [&]() { failedDependencyRan = true; return true; }));
+
+    // A failed section fails the load, but its dependents still run as they did in key order
+    EXPECT_FALSE(dataManager.ProcessData({ {"window", {}}, {"worker", {}}, {"after", {}} }));
+    EXPECT_TRUE(onCaller);
+    EXPECT_TRUE(failedDependencyRan);
+}
+
+TEST_F(DataManagerTest, NonStandardExceptionFailsSectionWithoutHanging) {
+    for (size_t threads : { 1, 4 }) {
+        DataManager manager;
+        manager.SetLoadThreadCount(threads);
+        bool dependentRan = false;
+        manager.RegisterManager(std::make_unique<DependentMockManager>(manager, "a"_h, std::vector<Hash::HashValue>{},
+            []() -> bool { throw 42; }));
+        manager.RegisterManager(std::make_unique<DependentMockManager>(manager, "b"_h, std::vector<Hash::HashValue>{ "a"_h },
+            [&]() { dependentRan = true; return true; }));
+
+        EXPECT_FALSE(manager.ProcessData({ {"a", {}}, {"b", {}} })) << threads << " threads";
+        EXPECT_TRUE(dependentRan) << threads << " threads";
+    }
+}
+
+TEST_F(DataManagerTest, RegisterStringFromManyThreads) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([this, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                dataManager.RegisterString("shared_" + std::to_string(i));
+                dataManager.RegisterString("thread_" + std::to_string(t) + "_" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(dataManager.GetString(Hash::HashValue(std::string("shared_999"))), "shared_999");
+    EXPECT_EQ(dataManager.GetString(Hash::HashValue(std::string("thread_3_500"))), "thread_3_500");
+}
+
+TEST_F(DataManagerTest, SaveReusesUnchangedSections) {
+    auto board = std::make_unique<TrackedMockManager>(dataManager, "board");
+    auto settings = std::make_unique<TrackedMockManager>(dataManager, "settings");
+    TrackedMockManager* boardManager = board.get();
+    TrackedMockManager* settingsManager = settings.get();
+    dataManager.RegisterManager(std::move(board));
+    dataManager.RegisterManager(std::move(settings));
+    ASSERT_TRUE(dataManager.ProcessData({ {"board", {{"cells", {1, 2, 3}}}}, {"settings", {{"volume", 5}}} }));
+
+    const std::string path = "test_save_sections.json";
+    ASSERT_TRUE(dataManager.SaveToFile(path));
+    EXPECT_EQ(boardManager->m_snapshots, 1);
+    EXPECT_EQ(settingsManager->m_snapshots, 1);
+
+    // Only the changed manager is copied again
+    boardManager->SetData({ {"cells", {4}} });
+    ASSERT_TRUE(dataManager.SaveToFile(path));
+    EXPECT_EQ(boardManager->m_snapshots, 2);
+    EXPECT_EQ(settingsManager->m_snapshots, 1);
+
+    // The file matches what nlohmann::json would print
+    const nlohmann::json expected = { {"board", {{"cells", {4}}}}, {"settings", {{"volume", 5}}} };
+    std::ifstream file(path);
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(text, expected.dump(4));
+    file.close();
+    std::filesystem::remove(path);
+}
+
+TEST_F(DataManagerTest, DeltaHoldsOnlyChangedSections) {
+    auto board = std::make_unique<TrackedMockManager>(dataManager, "board");
+    auto settings = std::make_unique<TrackedMockManager>(dataManager, "settings");
+    TrackedMockManager* boardManager = board.get();
+    dataManager.RegisterManager(std::move(board));
+    dataManager.RegisterManager(std::move(settings));
+    ASSERT_TRUE(dataManager.ProcessData({ {"board", {{"turn", 0}}}, {"settings", {{"volume", 5}}} }));
+
+    const std::string basePath = "test_delta_base.json";
+    const std::string deltaPath = "test_delta_base.delta";
+    std::filesystem::remove(deltaPath);
+    DataManager::Snapshot snapshot = dataManager.TakeSnapshot();
+    ASSERT_TRUE(dataManager.WriteSnapshot(snapshot, basePath));
+
+    for (int turn = 1; turn <= 3; ++turn) {
+        boardManager->SetData({ {"turn", turn} });
+        DataManager::Snapshot delta = dataManager.TakeSnapshot();
+        ASSERT_TRUE(dataManager.AppendDelta(delta, deltaPath));
+    }
+    // Nothing changed, so nothing is appended
+    const auto deltaSize = std::filesystem::file_size(deltaPath);
+    DataManager::Snapshot unchanged = dataManager.TakeSnapshot();
+    ASSERT_TRUE(dataManager.AppendDelta(unchanged, deltaPath));
+    EXPECT_EQ(std::filesystem::file_size(deltaPath), deltaSize);
+
+    {
+        std::ifstream delta(deltaPath);
+        const std::string text((std::istreambuf_iterator<char>(delta)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(text.find("settings"), std::string::npos);
+    }
+
+    // A record cut short by a crash is ignored
+    {
+        std::ofstream delta(deltaPath, std::ios::app);
+        delta << "{\n    \"board\": {\n        \"turn\": 9";
+    }
+
+    DataManager loaded;
+    auto loadedBoard = std::make_unique<MockManager>(loaded, "board"_h);
+    auto loadedSettings = std::make_unique<MockManager>(loaded, "settings"_h);
+    MockManager* loadedBoardManager = loadedBoard.get();
+    MockManager* loadedSettingsManager = loadedSettings.get();
+    loaded.RegisterManager(std::move(loadedBoard));
+    loaded.RegisterManager(std::move(loadedSettings));
+    ASSERT_TRUE(loaded.LoadFromFileWithDelta(basePath, deltaPath));
+    EXPECT_EQ(loadedBoardManager->GetLastData()["turn"], 3);
+    EXPECT_EQ(loadedSettingsManager->GetLastData()["volume"], 5);
+
+    std::filesystem::remove(basePath);
+    std::filesystem::remove(deltaPath);
+}
+
+TEST_F(DataManagerTest, DeltaAppendsAfterDamagedRecordsStillLoad) {
+    auto board = std::make_unique<TrackedMockManager>(dataManager, "board");
+    TrackedMockManager* boardManager = board.get();
+    dataManager.RegisterManager(std::move(board));
+    ASSERT_TRUE(dataManager.ProcessData({ {"board", {{"turn", 0}}} }));
+
+    const std::string basePath = "test_delta_damaged.json";
+    const std::string deltaPath = "test_delta_damaged.delta";
+    std::filesystem::remove(deltaPath);
+    DataManager::Snapshot snapshot = dataManager.TakeSnapshot();
+    ASSERT_TRUE(dataManager.WriteSnapshot(snapshot, basePath));
+
+    auto appendTurn = [&](int turn) {
+        boardManager->SetData({ {"turn", turn} });
+        DataManager::Snapshot delta = dataManager.TakeSnapshot();
+        ASSERT_TRUE(dataManager.AppendDelta(delta, deltaPath));
+    };
+    appendTurn(1);
+    // A crash cuts a record short, and the game keeps appending after restarting
+    {
+        std::ofstream delta(deltaPath, std::ios::binary | std::ios::app);
+        delta << "{\n    \"board\": {\n        \"turn\": 9";
+    }
+    appendTurn(2);
+    // Garbage between records only loses itself
+    {
+        std::ofstream delta(deltaPath, std::ios::binary | std::ios::app);
+        delta << "not json\n";
+    }
+    appendTurn(3);
+
+    DataManager loaded;
+    auto loadedBoard = std::make_unique<MockManager>(loaded, "board"_h);
+    MockManager* loadedBoardManager = loadedBoard.get();
+    loaded.RegisterManager(std::move(loadedBoard));
+    ASSERT_TRUE(loaded.LoadFromFileWithDelta(basePath, deltaPath));
+    EXPECT_EQ(loadedBoardManager->GetLastData()["turn"], 3);
+
+    std::filesystem::remove(basePath);
+    std::filesystem::remove(deltaPath);
+}
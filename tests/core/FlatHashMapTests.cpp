@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "core/FlatHashMap.h"
+#include "core/Hash.h"
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+using namespace ShoeEngine::Core;
+
+namespace {
+
+// Hashes every key to the same value, so a few keys share one probe chain
+struct CollidingHasher {
+    size_t operator()(const Hash::HashValue&) const { return 42; }
+};
+
+} // namespace
+
+TEST(FlatHashMapTests, InsertFindErase) {
+    FlatHashMap<Hash::HashValue, std::string> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find("apple"_h), map.end());
+
+    EXPECT_TRUE(map.try_emplace("apple"_h, "red").second);
+    EXPECT_TRUE(map.try_emplace("pear"_h, "green").second);
+    EXPECT_FALSE(map.try_emplace("apple"_h, "yellow").second);
+    map["plum"_h] = "purple";
+
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.at("apple"_h), "red");
+    EXPECT_EQ(map.find("pear"_h)->second, "green");
+    EXPECT_TRUE(map.contains("plum"_h));
+    EXPECT_THROW(map.at("kiwi"_h), std::out_of_range);
+
+    map.insert_or_assign("apple"_h, "yellow");
+    EXPECT_EQ(map.at("apple"_h), "yellow");
+
+    EXPECT_EQ(map.erase("pear"_h), 1u);
+    EXPECT_EQ(map.erase("pear"_h), 0u);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_FALSE(map.contains("pear"_h));
+    EXPECT_EQ(map.at("plum"_h), "purple");
+}
+
+TEST(FlatHashMapTests, MatchesStdMapUnderRandomOperations) {
+    FlatHashMap<Hash::HashValue, int> map;
+    std::map<uint32_t, int> reference;
+    std::mt19937 random(1234);
+
+    for (int i = 0; i < 50000; ++i) {
+        const Hash::HashValue key("key_" + std::to_string(random() % 2000));
+        const int value = static_cast<int>(random());
+        switch (random() % 3) {
+        case 0:
+            map[key] = value;
+            reference[key] = value;
+            break;
+        case 1:
+            EXPECT_EQ(map.erase(key), reference.erase(key));
+            break;
+        default:
+            EXPECT_EQ(map.contains(key), reference.count(key) == 1);
+            break;
+        }
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    size_t visited = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(reference.at(key), value);
+        ++visited;
+    }
+    EXPECT_EQ(visited, reference.size());
+}
+
+TEST(FlatHashMapTests, EraseWhileIteratingVisitsEveryEntry) {
+    FlatHashMap<Hash::HashValue, int, CollidingHasher> map;
+    for (int i = 0; i < 6; ++i) {
+        map[Hash::HashValue("entry_" + std::to_string(i))] = i;
+    }
+
+    // Erasing shifts the rest of the probe chain back into the erased slot
+    int visited = 0;
+    for (auto it = map.begin(); it != map.end();) {
+        ++visited;
+        it = it->second % 2 == 0 ? map.erase(it) : std::next(it);
+    }
+
+    EXPECT_EQ(visited, 6);
+    EXPECT_EQ(map.size(), 3u);
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(value % 2, 1);
+    }
+}
+
+TEST(FlatHashMapTests, KeepsEntriesThroughGrowth) {
+    FlatHashMap<Hash::HashValue, int> map;
+    for (int i = 0; i < 100000; ++i) {
+        map[Hash::HashValue("entry_" + std::to_string(i))] = i;
+    }
+
+    EXPECT_EQ(map.size(), 100000u);
+    EXPECT_LE(map.load_factor(), 0.8f);
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_EQ(map.at(Hash::HashValue("entry_" + std::to_string(i))), i);
+    }
+}
+
+TEST(FlatHashMapTests, ReserveAvoidsRehashing) {
+    FlatHashMap<Hash::HashValue, int> map;
+    map.reserve(1000);
+    const size_t buckets = map.bucket_count();
+    EXPECT_GE(buckets * 0.8, 1000.0);
+
+    for (int i = 0; i < 1000; ++i) {
+        map[Hash::HashValue("key_" + std::to_string(i))] = i;
+    }
+    EXPECT_EQ(map.bucket_count(), buckets);
+    EXPECT_LE(map.load_factor(), 0.8f);
+}
+
+TEST(FlatHashMapTests, MoveOnlyValuesAndCopies) {
+    FlatHashMap<Hash::HashValue, std::unique_ptr<int>> owners;
+    for (int i = 0; i < 100; ++i) {
+        owners[Hash::HashValue("key_" + std::to_string(i))] = std::make_unique<int>(i);
+    }
+    const int* fifty = owners.at("key_50"_h).get();
+
+    FlatHashMap<Hash::HashValue, std::unique_ptr<int>> moved = std::move(owners);
+    EXPECT_TRUE(owners.empty());
+    EXPECT_EQ(owners.begin(), owners.end());
+    EXPECT_EQ(moved.size(), 100u);
+    EXPECT_EQ(moved.at("key_50"_h).get(), fifty);
+
+    FlatHashMap<Hash::HashValue, std::string> original;
+    original["a"_h] = "alpha";
+    original["b"_h] = "beta";
+    FlatHashMap<Hash::HashValue, std::string> copy = original;
+    copy["a"_h] = "changed";
+    EXPECT_EQ(original.at("a"_h), "alpha");
+    EXPECT_EQ(copy.at("b"_h), "beta");
+
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+    EXPECT_FALSE(copy.contains("b"_h));
+    copy["c"_h] = "gamma";
+    EXPECT_EQ(copy.size(), 1u);
+}
+
+TEST(FlatHashMapTests, InsertsFromItsOwnEntriesThroughGrowth) {
+    FlatHashMap<Hash::HashValue, std::string> map;
+    const std::string value(64, 'x');
+    map["key_0"_h] = value;
+    for (int i = 1; i < 200; ++i) {
+        // The value refers into the map, whose slots the growth frees
+        const auto previous = map.find(Hash::HashValue("key_" + std::to_string(i - 1)));
+        map.try_emplace(Hash::HashValue("key_" + std::to_string(i)), previous->second);
+    }
+
+    EXPECT_EQ(map.size(), 200u);
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(map.at(Hash::HashValue("key_" + std::to_string(i))), value);
+    }
+}
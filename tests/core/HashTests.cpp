@@ -1,5 +1,12 @@
 #include "gtest/gtest.h"
 #include "core/Hash.h"
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
 
 using namespace ShoeEngine::Core;
 
@@ -40,3 +47,129 @@ TEST(HashTests, HashValue_StringLiteral)
     Hash::HashValue hash2("test", 4);
     EXPECT_EQ(hash1, hash2);
 }
+
+TEST(HashTests, Hash64_IsConstexpr)
+{
+    constexpr auto literal = "player_sprite"_h64;
+    static_assert(literal == Hash::Hash64("player_sprite", 13));
+    static_assert("a"_h64 != "b"_h64);
+    EXPECT_EQ(literal, Hash::HashValue64(std::string("player_sprite")));
+}
+
+TEST(HashTests, Hash64_SeedAndCombine)
+{
+    const std::string key = "test string";
+    EXPECT_NE(Hash::Hash64(key.data(), key.size(), 0), Hash::Hash64(key.data(), key.size(), 1));
+    EXPECT_EQ("atlas"_h64 + std::string_view("page"), Hash::HashValue64(Hash::Hash64("page", 4, "atlas"_h64)));
+}
+
+TEST(HashTests, Hash64_NoCollisionsAcrossLengths)
+{
+    // Covers every length branch: empty, 1-3, 4-16, 17-47 and 48+ bytes
+    std::unordered_set<uint64_t> seen;
+    std::string key;
+    for (int length = 0; length < 200; ++length) {
+        EXPECT_TRUE(seen.insert(Hash::Hash64(key.data(), key.size())).second) << "length " << length;
+        key.push_back(static_cast<char>('a' + length % 26));
+    }
+    for (int i = 0; i < 100000; ++i) {
+        const std::string id = "sprite_" + std::to_string(i);
+        EXPECT_TRUE(seen.insert(Hash::HashValue64(id)).second) << id;
+    }
+}
+
+TEST(HashTests, Hash64Batch_MatchesScalar)
+{
+    std::vector<std::string> strings;
+    for (int i = 0; i < 101; ++i) {
+        strings.push_back(std::string(static_cast<size_t>(i % 40), 'x') + std::to_string(i));
+    }
+    std::vector<std::string_view> keys(strings.begin(), strings.end());
+
+    for (uint64_t seed : { uint64_t{ 0 }, uint64_t{ 12345 } }) {
+        std::vector<uint64_t> hashes(keys.size());
+        Hash::Hash64Batch(keys.data(), keys.size(), hashes.data(), seed);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            EXPECT_EQ(hashes[i], Hash::Hash64(keys[i].data(), keys[i].size(), seed)) << keys[i];
+        }
+    }
+}
+
+TEST(HashTests, Streams_MatchOneShotForAnySplit)
+{
+    std::mt19937 random(7);
+    std::string data;
+    for (int i = 0; i < 1000; ++i) {
+        data.push_back(static_cast<char>(random()));
+    }
+
+    for (size_t length : { 0, 1, 3, 4, 15, 16, 17, 47, 48, 49, 95, 96, 97, 500, 1000 }) {
+        const std::string_view bytes(data.data(), length);
+        Hash::FNV1aStream fnv(5);
+        Hash::MurmurHash3Stream murmur(5);
+        Hash::Hash64Stream hash64(5);
+
+        // Feed the bytes in random-sized pieces, including empty ones
+        for (size_t offset = 0; offset < length;) {
+            const size_t piece = std::min<size_t>(random() % 70, length - offset);
+            fnv.Update(bytes.data() + offset, piece);
+            murmur.Update(bytes.data() + offset, piece);
+            hash64.Update(bytes.data() + offset, piece);
+            offset += piece;
+        }
+
+        const auto length32 = static_cast<uint32_t>(length);
+        EXPECT_EQ(fnv.Finalize(), Hash::FNV1a(bytes.data(), length32, 5)) << length;
+        EXPECT_EQ(murmur.Finalize(), Hash::MurmurHash3(bytes.data(), length32, 5)) << length;
+        EXPECT_EQ(hash64.Finalize(), Hash::Hash64(bytes.data(), length, 5)) << length;
+    }
+}
+
+TEST(HashTests, Streams_CanBeReused)
+{
+    Hash::Hash64Stream stream;
+    stream.Update("first", 5);
+    stream.Init();
+    stream.Update("second", 6);
+    EXPECT_EQ(stream.Finalize(), "second"_h64);
+}
+
+TEST(HashTests, HashFile_MatchesContents)
+{
+    std::string contents;
+    for (int i = 0; i < 100000; ++i) {
+        contents += static_cast<char>(i * 31);
+    }
+    {
+        std::ofstream file("hash_file_test.bin", std::ios::binary);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        std::ofstream empty("hash_file_empty.bin", std::ios::binary);
+    }
+
+    Hash::HashValue64 hash;
+    ASSERT_TRUE(Hash::HashFile("hash_file_test.bin", hash));
+    EXPECT_EQ(hash, Hash::HashValue64(contents));
+
+    ASSERT_TRUE(Hash::HashFile("hash_file_empty.bin", hash));
+    EXPECT_EQ(hash, Hash::HashValue64(std::string_view()));
+
+    EXPECT_FALSE(Hash::HashFile("hash_file_missing.bin", hash));
+
+    std::remove("hash_file_test.bin");
+    std::remove("hash_file_empty.bin");
+}
+
+TEST(HashTests, MixingHasher_SpreadsStridedKeys)
+{
+    // Keys differing only above bit 16 all land in one power-of-two bucket with Hasher
+    std::unordered_set<size_t> identityBuckets;
+    std::unordered_set<size_t> mixedBuckets;
+    for (uint32_t i = 0; i < 1024; ++i) {
+        const Hash::HashValue key(i << 16);
+        identityBuckets.insert(Hash::Hasher()(key) & 1023);
+        mixedBuckets.insert(Hash::MixingHasher()(key) & 1023);
+    }
+    EXPECT_EQ(identityBuckets.size(), 1u);
+    EXPECT_GT(mixedBuckets.size(), 600u);
+    EXPECT_NE(Hash::MixingHasher()("a"_h), Hash::MixingHasher()("b"_h));
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "core/JsonWriter.h"
+#include <limits>
+#include <sstream>
+#include <string>
+
+using namespace ShoeEngine::Core;
+
+namespace {
+
+const nlohmann::json& Document() {
+    static const nlohmann::json document = {
+        {"empty_array", nlohmann::json::array()},
+        {"empty_object", nlohmann::json::object()},
+        {"flags", {true, false, nullptr}},
+        {"name", "tab\there \"quoted\" \\ \x01 caf\xc3\xa9"},
+        {"numbers", {0, -42, 18446744073709551615ull, 0.5, 100.0, -1.25e-7}},
+        {"nested", {{"a", {{"b", {1, 2}}}}, {"c", "d"}}},
+    };
+    return document;
+}
+
+} // namespace
+
+TEST(JsonWriterTests, MatchesNlohmannLayout) {
+    for (int indent : { -1, 0, 2, 4 }) {
+        JsonWriter writer(indent);
+        writer.Value(Document());
+        EXPECT_EQ(writer.GetBuffer(), Document().dump(indent)) << "indent " << indent;
+    }
+}
+
+TEST(JsonWriterTests, WritesEvents) {
+    JsonWriter writer(2);
+    writer.StartObject();
+    writer.Key("id");
+    writer.Unsigned(7);
+    writer.Key("scale");
+    writer.StartArray();
+    writer.Float(2.0);
+    writer.Float(0.1);
+    writer.EndArray();
+    writer.Key("none");
+    writer.StartObject();
+    writer.EndObject();
+    writer.EndObject();
+
+    EXPECT_EQ(writer.GetBuffer(), "{\n  \"id\": 7,\n  \"scale\": [\n    2.0,\n    0.1\n  ],\n  \"none\": {}\n}");
+    const nlohmann::json parsed = nlohmann::json::parse(writer.GetBuffer());
+    EXPECT_EQ(parsed["scale"][1].get<double>(), 0.1);
+    EXPECT_TRUE(parsed["scale"][0].is_number_float());
+}
+
+TEST(JsonWriterTests, FloatsRoundTrip) {
+    JsonWriter writer;
+    writer.StartArray();
+    const double values[] = { 3.141592653589793, 1e300, -2.5e-300, 123456789.0, 0.30000000000000004 };
+    for (double value : values) {
+        writer.Float(value);
+    }
+    writer.Float(std::numeric_limits<double>::infinity());
+    writer.EndArray();
+
+    const nlohmann::json parsed = nlohmann::json::parse(writer.GetBuffer());
+    for (size_t i = 0; i < std::size(values); ++i) {
+        EXPECT_EQ(parsed[i].get<double>(), values[i]);
+    }
+    EXPECT_TRUE(parsed.back().is_null());
+}
+
+TEST(JsonWriterTests, FloatsUseShortestFloatText) {
+    JsonWriter writer;
+    writer.StartArray();
+    const float values[] = { 0.1f, 1.0f / 3.0f, 16777216.0f, -1e-30f, 2.5f };
+    for (float value : values) {
+        writer.Float(value);
+    }
+    writer.EndArray();
+
+    EXPECT_EQ(writer.GetBuffer().substr(0, 5), "[0.1,");
+    const nlohmann::json parsed = nlohmann::json::parse(writer.GetBuffer());
+    for (size_t i = 0; i < std::size(values); ++i) {
+        EXPECT_EQ(parsed[i].get<float>(), values[i]);
+        EXPECT_TRUE(parsed[i].is_number_float());
+    }
+}
+
+TEST(JsonWriterTests, BaseLevelAndReset) {
+    JsonWriter writer(4);
+    writer.Reset(1);
+    writer.StartArray();
+    writer.Integer(1);
+    writer.EndArray();
+    EXPECT_EQ(writer.GetBuffer(), "[\n        1\n    ]");
+
+    writer.Reset();
+    writer.StartObject();
+    writer.EndObject();
+    EXPECT_TRUE(writer.IsEmptyValue());
+    EXPECT_EQ(writer.GetBuffer(), "{}");
+}
+
+TEST(JsonWriterTests, StreamsLargeDocuments) {
+    std::ostringstream output;
+    JsonWriter writer(output);
+    writer.StartArray();
+    const std::string text(100, 'x');
+    for (int i = 0; i < 2000; ++i) {
+        writer.String(text);
+    }
+    writer.EndArray();
+
+    // The buffer is flushed as it fills, so only the tail remains
+    EXPECT_LT(writer.GetBuffer().size(), JsonWriter::FLUSH_SIZE);
+    writer.Flush();
+    EXPECT_TRUE(writer.GetBuffer().empty());
+
+    const nlohmann::json parsed = nlohmann::json::parse(output.str());
+    ASSERT_EQ(parsed.size(), 2000u);
+    EXPECT_EQ(parsed[1999], text);
+}
+
+TEST(JsonWriterTests, ToJsonParsesOutput) {
+    const nlohmann::json json = JsonWriter::ToJson([](JsonWriter& writer) {
+        writer.StartObject();
+        writer.Key("key");
+        writer.String("value");
+        writer.EndObject();
+    });
+    EXPECT_EQ(json, nlohmann::json({ {"key", "value"} }));
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "core/LiteralTable.h"
+#include "core/Hash.h"
+#include <string>
+
+using namespace ShoeEngine::Core;
+
+namespace {
+
+enum class Color { Red, Green, Blue };
+
+constexpr auto COLORS = MakeLiteralTable<Color>({
+    { "red", Color::Red },
+    { "green", Color::Green },
+    { "blue", Color::Blue },
+    { "crimson", Color::Red },
+});
+static_assert(COLORS.IsValid());
+
+// Lookups are usable in constant expressions
+static_assert(*COLORS.Find("green"_h) == Color::Green);
+static_assert(COLORS.GetName("blue"_h) == "blue");
+static_assert(COLORS.Find("purple"_h) == nullptr);
+
+// Repeated names, and different names with the same FNV1a hash, are rejected
+static_assert(!MakeLiteralTable<int>({ { "a", 1 }, { "a", 2 } }).IsValid());
+static_assert(!MakeLiteralTable<int>({ { "key_131459", 1 }, { "key_1404192", 2 } }).IsValid());
+
+} // namespace
+
+TEST(LiteralTableTests, LooksUpByHashNameAndValue) {
+    EXPECT_EQ(*COLORS.Find(Hash::HashValue(std::string("red"))), Color::Red);
+    EXPECT_EQ(*COLORS.Find(std::string_view("crimson")), Color::Red);
+    EXPECT_EQ(COLORS.Find(std::string_view("purple")), nullptr);
+    EXPECT_EQ(COLORS.GetName("green"_h), "green");
+    EXPECT_TRUE(COLORS.GetName("purple"_h).empty());
+
+    // The first name listed for a value wins
+    ASSERT_NE(COLORS.FindValue(Color::Red), nullptr);
+    EXPECT_EQ(COLORS.FindValue(Color::Red)->name, "red");
+    EXPECT_EQ(COLORS.FindValue(Color::Blue)->hash, "blue"_h);
+    EXPECT_EQ(COLORS.FindValue(static_cast<Color>(7)), nullptr);
+}
+
+TEST(LiteralTableTests, LargeTablesFindEveryEntry) {
+    static constexpr auto NUMBERS = MakeLiteralTable<int>({
+        { "zero", 0 }, { "one", 1 }, { "two", 2 }, { "three", 3 }, { "four", 4 }, { "five", 5 },
+        { "six", 6 }, { "seven", 7 }, { "eight", 8 }, { "nine", 9 }, { "ten", 10 }, { "eleven", 11 },
+        { "twelve", 12 }, { "thirteen", 13 }, { "fourteen", 14 }, { "fifteen", 15 }, { "sixteen", 16 },
+        { "seventeen", 17 }, { "eighteen", 18 }, { "nineteen", 19 }, { "twenty", 20 },
+    });
+    static_assert(NUMBERS.IsValid());
+
+    for (const auto& entry : NUMBERS) {
+        EXPECT_EQ(*NUMBERS.Find(entry.hash), entry.value);
+        EXPECT_EQ(NUMBERS.FindValue(entry.value), &entry);
+    }
+    EXPECT_EQ(NUMBERS.Find("twenty-one"_h), nullptr);
+}
+
+TEST(LiteralTableTests, NonIntegralValues) {
+    static constexpr auto IMAGES = MakeLiteralTable<Hash::HashValue>({
+        { "alligator", "alligator_image"_h },
+        { "crocodile", "crocodile_image"_h },
+    });
+    static_assert(IMAGES.IsValid());
+
+    EXPECT_EQ(*IMAGES.Find("crocodile"_h), "crocodile_image"_h);
+    EXPECT_EQ(IMAGES.FindValue("alligator_image"_h)->name, "alligator");
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "core/RadixSort.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ShoeEngine::Core;
+
+namespace {
+
+std::vector<SortEntry> MakeEntries(size_t count, uint64_t keyMask, uint32_t seed) {
+    std::mt19937_64 random(seed);
+    std::vector<SortEntry> entries(count);
+    for (size_t i = 0; i < count; ++i) {
+        entries[i] = { random() & keyMask, static_cast<uint32_t>(i) };
+    }
+    return entries;
+}
+
+// Same result as std::stable_sort, including the order of equal keys
+void ExpectMatchesStableSort(std::vector<SortEntry> entries) {
+    std::vector<SortEntry> expected = entries;
+    std::stable_sort(expected.begin(), expected.end(),
+        [](const SortEntry& a, const SortEntry& b) { return a.key < b.key; });
+
+    std::vector<SortEntry> scratch;
+    RadixSort(entries, scratch);
+    ASSERT_EQ(entries.size(), expected.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        EXPECT_EQ(entries[i].key, expected[i].key) << "at " << i;
+        EXPECT_EQ(entries[i].value, expected[i].value) << "at " << i;
+    }
+}
+
+} // namespace
+
+TEST(RadixSortTests, MatchesStableSort) {
+    ExpectMatchesStableSort({});
+    ExpectMatchesStableSort(MakeEntries(1, ~0ull, 1));
+    ExpectMatchesStableSort(MakeEntries(INSERTION_SORT_LIMIT, 0xF, 2));
+    ExpectMatchesStableSort(MakeEntries(1000, ~0ull, 3));
+    // Many equal keys, and keys differing only in some bytes
+    ExpectMatchesStableSort(MakeEntries(1000, 0x7, 4));
+    ExpectMatchesStableSort(MakeEntries(5000, 0xFF0000FF00000000ull, 5));
+}
+
+TEST(RadixSortTests, SortableBitsKeepFloatOrder) {
+    const std::vector<float> values = { -std::numeric_limits<float>::infinity(), -1e30f, -2.5f, -1.0f,
+        -1e-30f, 0.0f, 1e-30f, 0.5f, 1.0f, 3.0f, 1e30f, std::numeric_limits<float>::infinity() };
+    for (size_t i = 1; i < values.size(); ++i) {
+        EXPECT_LT(ToSortableBits(values[i - 1]), ToSortableBits(values[i])) << values[i - 1] << " < " << values[i];
+    }
+    EXPECT_EQ(ToSortableBits(-0.0f), ToSortableBits(0.0f));
+}
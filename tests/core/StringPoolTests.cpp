@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "core/StringPool.h"
+#include "core/DataManager.h"
+#include <string>
+
+using namespace ShoeEngine::Core;
+
+TEST(StringPoolTests, InternAndFind) {
+    StringPool pool;
+    EXPECT_EQ(pool.Intern("apple"_h, "apple"), StringPool::InternResult::Added);
+    EXPECT_EQ(pool.Intern("pear"_h, "pear"), StringPool::InternResult::Added);
+
+    EXPECT_EQ(pool.Find("apple"_h), "apple");
+    EXPECT_EQ(pool.Find("pear"_h), "pear");
+    EXPECT_TRUE(pool.Find("plum"_h).empty());
+    EXPECT_EQ(pool.GetCount(), 2u);
+}
+
+TEST(StringPoolTests, ReinternIsNoOp) {
+    StringPool pool;
+    pool.Intern("apple"_h, "apple");
+    const std::string_view first = pool.Find("apple"_h);
+    const size_t capacity = pool.GetCapacityBytes();
+
+    EXPECT_EQ(pool.Intern("apple"_h, std::string("apple")), StringPool::InternResult::Existing);
+    EXPECT_EQ(pool.Find("apple"_h).data(), first.data());
+    EXPECT_EQ(pool.GetCapacityBytes(), capacity);
+    EXPECT_EQ(pool.GetCount(), 1u);
+}
+
+TEST(StringPoolTests, ViewsSurviveNewChunks) {
+    StringPool pool(16);
+    pool.Intern("short"_h, "short");
+    const std::string_view view = pool.Find("short"_h);
+
+    // Longer than a chunk, then enough strings to need several chunks
+    const std::string longString(100, 'x');
+    pool.Intern(Hash::HashValue(longString), longString);
+    for (int i = 0; i < 100; ++i) {
+        const std::string str = "string_" + std::to_string(i);
+        pool.Intern(Hash::HashValue(str), str);
+    }
+
+    EXPECT_EQ(view, "short");
+    EXPECT_EQ(pool.Find("short"_h).data(), view.data());
+    EXPECT_EQ(pool.Find(Hash::HashValue(longString)), longString);
+    EXPECT_EQ(pool.Find("string_99"_h), "string_99");
+}
+
+TEST(StringPoolTests, ReserveAllocatesOneChunkForTheBatch) {
+    StringPool pool(16);
+    pool.Reserve(10, 1000);
+    const size_t capacity = pool.GetCapacityBytes();
+    EXPECT_GE(capacity, 1000u);
+
+    for (int i = 0; i < 10; ++i) {
+        const std::string str = std::string(90, 'a') + std::to_string(i);
+        pool.Intern(Hash::HashValue(str), str);
+    }
+    EXPECT_EQ(pool.GetCapacityBytes(), capacity);
+}
+
+TEST(StringPoolTests, CollisionKeepsFirstString) {
+    StringPool pool;
+    EXPECT_EQ(pool.Intern(Hash::HashValue(5u), "first"), StringPool::InternResult::Added);
+    EXPECT_EQ(pool.Intern(Hash::HashValue(5u), "second"), StringPool::InternResult::Collision);
+    EXPECT_EQ(pool.Find(Hash::HashValue(5u)), "first");
+    EXPECT_EQ(pool.GetCollisionCount(), 1u);
+}
+
+TEST(StringPoolTests, DataManagerReportsRealFnvCollision) {
+    // These two strings share the same 32-bit FNV-1a hash
+    ASSERT_EQ(Hash::HashValue(std::string("key_131459")), Hash::HashValue(std::string("key_1404192")));
+
+    DataManager dataManager;
+    const Hash::HashValue hash = dataManager.RegisterString("key_131459");
+    EXPECT_EQ(dataManager.RegisterString("key_1404192"), hash);
+    EXPECT_EQ(dataManager.GetStringCollisionCount(), 1u);
+    EXPECT_EQ(dataManager.GetString(hash), "key_131459");
+
+    dataManager.RegisterString("key_131459");
+    EXPECT_EQ(dataManager.GetStringCollisionCount(), 1u);
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "core/ThreadPool.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+using namespace ShoeEngine::Core;
+
+TEST(ThreadPoolTests, StartsRequestedThreadCount) {
+    ThreadPool pool(3);
+    EXPECT_EQ(pool.GetThreadCount(), 3);
+
+    ThreadPool defaultPool;
+    EXPECT_EQ(defaultPool.GetThreadCount(), ThreadPool::GetDefaultThreadCount());
+}
+
+TEST(ThreadPoolTests, SubmitReturnsResults) {
+    ThreadPool pool(4);
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; ++i) {
+        results.push_back(pool.Submit([i] { return i * i; }));
+    }
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(results[i].get(), i * i);
+    }
+}
+
+TEST(ThreadPoolTests, ExceptionsReachTheWaitingThread) {
+    ThreadPool pool(2);
+    auto result = pool.Submit([]() -> int { throw std::runtime_error("decode failed"); });
+    EXPECT_THROW(result.get(), std::runtime_error);
+
+    // The worker survives the exception
+    EXPECT_EQ(pool.Submit([] { return 7; }).get(), 7);
+}
+
+TEST(ThreadPoolTests, TasksRunOnWorkerThreads) {
+    ThreadPool pool(2);
+    auto id = pool.Submit([] { return std::this_thread::get_id(); }).get();
+    EXPECT_NE(id, std::this_thread::get_id());
+}
+
+TEST(ThreadPoolTests, DestructorFinishesQueuedTasks) {
+    std::atomic<int> completed{ 0 };
+    {
+        ThreadPool pool(1);
+        for (int i = 0; i < 50; ++i) {
+            pool.Submit([&completed] { ++completed; });
+        }
+    }
+    EXPECT_EQ(completed.load(), 50);
+}
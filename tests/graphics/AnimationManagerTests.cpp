@@ -0,0 +1,271 @@
+#include <gtest/gtest.h>
+#include "graphics/AnimationManager.h"
+#include "core/Hash.h"
+#include "core/DataManager.h"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <memory>
+
+using namespace ShoeEngine::Graphics;
+using namespace ShoeEngine::Core;
+using json = nlohmann::json;
+
+class AnimationManagerTests : public ::testing::Test {
+protected:
+    AnimationManagerTests()
+        : imageManager(dataManager)
+        , spriteManager(dataManager, imageManager)
+        , animationManager(dataManager, imageManager, spriteManager)
+    {}
+
+    void SetUp() override {
+        // A sheet of four 4x4 frames in a row
+        std::vector<uint8_t> pixels(16 * 4 * 4, 255);
+        Image(pixels.data(), 16, 4).SaveToFile("animation_sheet.png");
+        ASSERT_TRUE(imageManager.CreateFromJson({ {"sheet", {{"file", "animation_sheet.png"}}} }));
+        ASSERT_TRUE(spriteManager.CreateFromJson({
+            {"hero", {{"image", "sheet"}}},
+            {"enemy", {{"image", "sheet"}}}
+        }));
+        hero = spriteManager.GetSprite("hero"_h);
+        enemy = spriteManager.GetSprite("enemy"_h);
+    }
+
+    void TearDown() override {
+        std::remove("animation_sheet.png");
+    }
+
+    // Frames of the sheet, each shown for a quarter second
+    static json Frames(int count) {
+        json frames = json::array();
+        for (int i = 0; i < count; ++i) {
+            frames.push_back({ {"x", 4 * i}, {"y", 0}, {"width", 4}, {"height", 4} });
+        }
+        return frames;
+    }
+
+    static json Animation(const std::string& loop, int frameCount) {
+        return { {"image", "sheet"}, {"loop", loop}, {"frameDuration", 0.25f}, {"frames", Frames(frameCount)} };
+    }
+
+    sf::IntRect GetRect(SpriteHandle sprite) const {
+        return spriteManager.GetStorage().GetTextureRect(sprite);
+    }
+
+    DataManager dataManager;
+    ImageManager imageManager;
+    SpriteManager spriteManager;
+    AnimationManager animationManager;
+    SpriteHandle hero;
+    SpriteHandle enemy;
+};
+
+TEST_F(AnimationManagerTests, LoopingAnimationAdvancesFrames) {
+    json walk = Animation("loop", 4);
+    walk["sprites"] = { "hero" };
+    ASSERT_TRUE(animationManager.CreateFromJson({ {"walk", walk} }));
+    EXPECT_EQ(animationManager.GetAnimationCount(), 1);
+    EXPECT_TRUE(animationManager.IsPlaying(hero));
+    EXPECT_FALSE(animationManager.IsPlaying(enemy));
+    EXPECT_EQ(GetRect(hero), sf::IntRect(0, 0, 4, 4));
+
+    const sf::Texture* texture = spriteManager.GetStorage().GetTexture(hero);
+    const size_t uploads = imageManager.GetTextureCache().GetUploadCount();
+
+    EXPECT_EQ(animationManager.Update(0.125f), 0);
+    EXPECT_EQ(animationManager.Update(0.25f), 1);
+    EXPECT_EQ(animationManager.GetFrame(hero), 1);
+    EXPECT_EQ(GetRect(hero), sf::IntRect(4, 0, 4, 4));
+
+    // Passes frames 2 and 3 and wraps around
+    EXPECT_EQ(animationManager.Update(0.75f), 1);
+    EXPECT_EQ(animationManager.GetFrame(hero), 0);
+    EXPECT_EQ(GetRect(hero), sf::IntRect(0, 0, 4, 4));
+
+    // Frame changes only change the texture rectangle
+    EXPECT_EQ(spriteManager.GetStorage().GetTexture(hero), texture);
+    EXPECT_EQ(imageManager.GetTextureCache().GetUploadCount(), uploads);
+}
+
+TEST_F(AnimationManagerTests, OnceAndPingPong) {
+    ASSERT_TRUE(animationManager.CreateFromJson({ {"die", Animation("once", 3)}, {"bob", Animation("pingpong", 3)} }));
+    ASSERT_TRUE(animationManager.Play(hero, "die"_h));
+    ASSERT_TRUE(animationManager.Play(enemy, "bob"_h));
+
+    std::vector<uint32_t> bobFrames;
+    for (int i = 0; i < 5; ++i) {
+        animationManager.Update(0.25f);
+        bobFrames.push_back(animationManager.GetFrame(enemy));
+        if (i == 1) {
+            EXPECT_TRUE(animationManager.IsPlaying(hero));
+            EXPECT_EQ(animationManager.GetFrame(hero), 2);
+        }
+    }
+    EXPECT_EQ(bobFrames, (std::vector<uint32_t>{ 1, 2, 1, 0, 1 }));
+
+    // "die" stopped on its last frame
+    EXPECT_FALSE(animationManager.IsPlaying(hero));
+    EXPECT_EQ(GetRect(hero), sf::IntRect(8, 0, 4, 4));
+    EXPECT_EQ(animationManager.GetPlayingCount(), 1);
+
+    // Long pauses skip whole cycles: a ping-pong cycle of 3 frames takes 1 second
+    ASSERT_TRUE(animationManager.Play(enemy, "bob"_h));
+    animationManager.Update(10.25f);
+    EXPECT_EQ(animationManager.GetFrame(enemy), 1);
+}
+
+TEST_F(AnimationManagerTests, InvalidAnimationsAreRejected) {
+    json outside = Animation("loop", 1);
+    outside["frames"][0]["x"] = 14;
+    EXPECT_FALSE(animationManager.CreateFromJson({ {"a", outside} }));
+
+    json unknownLoop = Animation("backwards", 1);
+    EXPECT_FALSE(animationManager.CreateFromJson({ {"a", unknownLoop} }));
+
+    json zeroDuration = Animation("loop", 1);
+    zeroDuration["frames"][0]["duration"] = 0.0f;
+    EXPECT_FALSE(animationManager.CreateFromJson({ {"a", zeroDuration} }));
+
+    json missingImage = Animation("loop", 1);
+    missingImage["image"] = "nonexistent";
+    EXPECT_FALSE(animationManager.CreateFromJson({ {"a", missingImage} }));
+
+    json missingSprite = Animation("loop", 1);
+    missingSprite["sprites"] = { "nobody" };
+    EXPECT_FALSE(animationManager.CreateFromJson({ {"a", missingSprite} }));
+
+    EXPECT_EQ(animationManager.GetAnimationCount(), 0);
+    EXPECT_FALSE(animationManager.Play(hero, "a"_h));
+}
+
+TEST_F(AnimationManagerTests, StopAndDestroyedSprites) {
+    ASSERT_TRUE(animationManager.CreateFromJson({ {"walk", Animation("loop", 4)} }));
+    ASSERT_TRUE(animationManager.Play(hero, "walk"_h));
+    ASSERT_TRUE(animationManager.Play(enemy, "walk"_h));
+
+    animationManager.Update(0.25f);
+    EXPECT_TRUE(animationManager.Stop(hero));
+    EXPECT_FALSE(animationManager.Stop(hero));
+    animationManager.Update(0.25f);
+    EXPECT_EQ(GetRect(hero), sf::IntRect(4, 0, 4, 4));
+
+    // A destroyed sprite is dropped at its next frame change, and its slot can play again
+    EXPECT_TRUE(spriteManager.DestroySprite(enemy));
+    EXPECT_FALSE(animationManager.IsPlaying(enemy));
+    animationManager.Update(0.25f);
+    EXPECT_EQ(animationManager.GetPlayingCount(), 0);
+
+    const SpriteHandle reborn = spriteManager.CreateSprite("reborn", "sheet");
+    EXPECT_TRUE(animationManager.Play(reborn, "walk"_h));
+    EXPECT_EQ(animationManager.GetPlayingCount(), 1);
+}
+
+TEST_F(AnimationManagerTests, SpriteGivenAnotherImageStops) {
+    json walk = Animation("loop", 4);
+    walk["sprites"] = { "hero", "enemy" };
+    ASSERT_TRUE(animationManager.CreateFromJson({ {"walk", walk} }));
+
+    // Another image with its own texture
+    std::vector<uint8_t> pixels(8 * 8 * 4, 0);
+    Image(pixels.data(), 8, 8).SaveToFile("animation_other.png");
+    ASSERT_TRUE(imageManager.CreateFromJson({ {"other", {{"file", "animation_other.png"}}} }));
+    std::remove("animation_other.png");
+    ASSERT_TRUE(spriteManager.CreateFromJson({ {"hero", {{"image", "other"}}} }));
+    const sf::IntRect heroRect = GetRect(hero);
+
+    // The hero keeps showing its new image, and the enemy keeps playing
+    EXPECT_EQ(animationManager.Update(0.25f), 1);
+    EXPECT_FALSE(animationManager.IsPlaying(hero));
+    EXPECT_TRUE(animationManager.IsPlaying(enemy));
+    EXPECT_EQ(GetRect(hero), heroRect);
+    EXPECT_EQ(GetRect(enemy), sf::IntRect(4, 0, 4, 4));
+    EXPECT_EQ(animationManager.SerializeToJson()["walk"]["sprites"], json({ "enemy" }));
+}
+
+TEST_F(AnimationManagerTests, ReloadAndSerialize) {
+    json walk = Animation("loop", 4);
+    walk["sprites"] = { "hero" };
+    json idle = Animation("pingpong", 2);
+    idle["sprites"] = { "enemy" };
+    ASSERT_TRUE(animationManager.CreateFromJson({ {"walk", walk}, {"idle", idle} }));
+
+    // Replacing "walk" with two later frames keeps "idle" intact and restarts its sprites
+    json shorter = Animation("loop", 2);
+    shorter["frames"] = { {{"x", 8}, {"y", 0}, {"width", 4}, {"height", 4}}, {{"x", 12}, {"y", 0}, {"width", 4}, {"height", 4}, {"duration", 0.5f}} };
+    ASSERT_TRUE(animationManager.CreateFromJson({ {"walk", shorter} }));
+    EXPECT_EQ(animationManager.GetAnimationCount(), 2);
+    EXPECT_EQ(GetRect(hero), sf::IntRect(8, 0, 4, 4));
+    animationManager.Update(0.25f);
+    EXPECT_EQ(GetRect(hero), sf::IntRect(12, 0, 4, 4));
+    EXPECT_EQ(GetRect(enemy), sf::IntRect(4, 0, 4, 4));
+
+    const json serialized = animationManager.SerializeToJson();
+    EXPECT_EQ(serialized["walk"]["sprites"], json({ "hero" }));
+    EXPECT_EQ(serialized["walk"]["frames"][1]["duration"], 0.5f);
+    EXPECT_EQ(serialized["idle"]["loop"], "pingpong");
+
+    // "idle" was created after "walk", but keys are written sorted like a dumped tree
+    JsonWriter writer(4);
+    animationManager.WriteJson(writer);
+    EXPECT_EQ(writer.GetBuffer(), serialized.dump(4));
+
+    animationManager.Clear();
+    EXPECT_EQ(animationManager.GetPlayingCount(), 0);
+    ASSERT_TRUE(animationManager.CreateFromJson(serialized));
+    EXPECT_EQ(animationManager.SerializeToJson(), serialized);
+    EXPECT_TRUE(animationManager.IsPlaying(enemy));
+}
+
+TEST_F(AnimationManagerTests, SnapshotIsACopy) {
+    json walk = Animation("loop", 4);
+    walk["sprites"] = { "hero" };
+    ASSERT_TRUE(animationManager.CreateFromJson({ {"walk", walk} }));
+    const json serialized = animationManager.SerializeToJson();
+
+    // Changes after the snapshot do not reach it
+    auto snapshot = animationManager.CreateSnapshot();
+    animationManager.Stop(hero);
+    animationManager.Clear();
+
+    const json written = JsonWriter::ToJson([&snapshot](JsonWriter& writer) { snapshot->WriteJson(writer); });
+    EXPECT_EQ(written, serialized);
+    EXPECT_EQ(written["walk"]["sprites"], json({ "hero" }));
+}
+
+TEST_F(AnimationManagerTests, DestroyedSpriteIsNotSavedAsPlaying) {
+    DataManager data;
+    auto images = std::make_unique<ImageManager>(data);
+    auto sprites = std::make_unique<SpriteManager>(data, *images);
+    auto animations = std::make_unique<AnimationManager>(data, *images, *sprites);
+    SpriteManager* spriteManagerPtr = sprites.get();
+    data.RegisterManager(std::move(images));
+    data.RegisterManager(std::move(sprites));
+    data.RegisterManager(std::move(animations));
+
+    json walk = Animation("loop", 4);
+    walk["sprites"] = { "hero" };
+    ASSERT_TRUE(data.ProcessData({
+        {"images", {{"sheet", {{"file", "animation_sheet.png"}}}}},
+        {"sprites", {{"hero", {{"image", "sheet"}}}}},
+        {"animations", {{"walk", walk}}}
+    }));
+
+    const std::string path = "test_animation_save.json";
+    ASSERT_TRUE(data.SaveToFile(path));
+    // Destroyed mid-frame, before the animation notices at its next frame change
+    ASSERT_TRUE(spriteManagerPtr->DestroySprite(spriteManagerPtr->GetSprite("hero"_h)));
+    ASSERT_TRUE(data.SaveToFile(path));
+
+    DataManager loaded;
+    auto loadedImages = std::make_unique<ImageManager>(loaded);
+    auto loadedSprites = std::make_unique<SpriteManager>(loaded, *loadedImages);
+    auto loadedAnimations = std::make_unique<AnimationManager>(loaded, *loadedImages, *loadedSprites);
+    AnimationManager* loadedAnimationManager = loadedAnimations.get();
+    loaded.RegisterManager(std::move(loadedImages));
+    loaded.RegisterManager(std::move(loadedSprites));
+    loaded.RegisterManager(std::move(loadedAnimations));
+    EXPECT_TRUE(loaded.LoadFromFile(path));
+    EXPECT_TRUE(loadedAnimationManager->HasAnimation("walk"_h));
+    EXPECT_EQ(loadedAnimationManager->GetPlayingCount(), 0);
+    std::remove(path.c_str());
+}
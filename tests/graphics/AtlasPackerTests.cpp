@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "graphics/AtlasPacker.h"
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+
+class AtlasPackerTests : public ::testing::Test {
+protected:
+    static bool Overlaps(const sf::IntRect& a, const sf::IntRect& b) {
+        return a.left < b.left + b.width && b.left < a.left + a.width
+            && a.top < b.top + b.height && b.top < a.top + a.height;
+    }
+
+    std::vector<sf::Vector2u> MixedSizes() const {
+        std::vector<sf::Vector2u> sizes;
+        for (unsigned int i = 0; i < 40; ++i) {
+            sizes.emplace_back(8 + (i * 7) % 40, 8 + (i * 13) % 32);
+        }
+        return sizes;
+    }
+};
+
+TEST_F(AtlasPackerTests, PlacementsDoNotOverlapAndStayOnPage) {
+    AtlasPacker::Settings settings;
+    settings.maxPageSize = 256;
+    settings.padding = 2;
+    AtlasPacker packer(settings);
+
+    const auto sizes = MixedSizes();
+    ASSERT_TRUE(packer.Pack(sizes));
+    const auto& placements = packer.GetPlacements();
+    ASSERT_EQ(placements.size(), sizes.size());
+
+    for (size_t i = 0; i < placements.size(); ++i) {
+        const auto& rect = placements[i].rect;
+        const auto& page = packer.GetPages()[placements[i].page];
+        EXPECT_EQ(rect.width, static_cast<int>(sizes[i].x));
+        EXPECT_EQ(rect.height, static_cast<int>(sizes[i].y));
+        EXPECT_GE(rect.left, 2);
+        EXPECT_GE(rect.top, 2);
+        EXPECT_LE(static_cast<unsigned int>(rect.left + rect.width + 2), page.width);
+        EXPECT_LE(static_cast<unsigned int>(rect.top + rect.height + 2), page.height);
+        EXPECT_LE(page.width, 256u);
+        EXPECT_LE(page.height, 256u);
+
+        for (size_t j = i + 1; j < placements.size(); ++j) {
+            if (placements[i].page == placements[j].page) {
+                // Grow one rectangle by the padding so touching rectangles also fail
+                sf::IntRect padded(rect.left, rect.top, rect.width + 2, rect.height + 2);
+                EXPECT_FALSE(Overlaps(padded, placements[j].rect)) << i << " overlaps " << j;
+            }
+        }
+    }
+}
+
+TEST_F(AtlasPackerTests, PackingIsDeterministic) {
+    AtlasPacker first;
+    AtlasPacker second;
+    ASSERT_TRUE(first.Pack(MixedSizes()));
+    ASSERT_TRUE(second.Pack(MixedSizes()));
+
+    ASSERT_EQ(first.GetPlacements().size(), second.GetPlacements().size());
+    for (size_t i = 0; i < first.GetPlacements().size(); ++i) {
+        EXPECT_EQ(first.GetPlacements()[i].page, second.GetPlacements()[i].page);
+        EXPECT_EQ(first.GetPlacements()[i].rect, second.GetPlacements()[i].rect);
+    }
+}
+
+TEST_F(AtlasPackerTests, OverflowOpensNewPage) {
+    AtlasPacker::Settings settings;
+    settings.maxPageSize = 64;
+    settings.padding = 0;
+    AtlasPacker packer(settings);
+
+    ASSERT_TRUE(packer.Pack({ { 64, 64 }, { 32, 32 }, { 32, 32 } }));
+    ASSERT_EQ(packer.GetPages().size(), 2);
+    EXPECT_EQ(packer.GetPlacements()[0].page, 0u);
+    EXPECT_EQ(packer.GetPlacements()[1].page, 1u);
+    EXPECT_EQ(packer.GetPlacements()[2].page, 1u);
+    EXPECT_EQ(packer.GetPages()[1].width, 64u);
+    EXPECT_EQ(packer.GetPages()[1].height, 32u);
+}
+
+TEST_F(AtlasPackerTests, OversizedRectangleFails) {
+    AtlasPacker::Settings settings;
+    settings.maxPageSize = 64;
+    settings.padding = 1;
+    AtlasPacker packer(settings);
+
+    EXPECT_FALSE(packer.Pack({ { 16, 16 }, { 64, 8 } }));
+    EXPECT_TRUE(packer.GetPlacements().empty());
+    EXPECT_TRUE(packer.GetPages().empty());
+}
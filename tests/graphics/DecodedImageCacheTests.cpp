@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "graphics/DecodedImageCache.h"
+#include "graphics/ImageManager.h"
+#include "core/DataManager.h"
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+using namespace ShoeEngine::Core;
+
+class DecodedImageCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cacheDirectory = std::filesystem::temp_directory_path() / "shoeengine_decoded_cache_tests";
+        std::filesystem::remove_all(cacheDirectory);
+
+        WriteSource(4, 4, 200);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(cacheDirectory);
+        std::remove(sourcePath.c_str());
+    }
+
+    void WriteSource(unsigned int width, unsigned int height, uint8_t value) {
+        std::vector<uint8_t> pixels(width * height * 4, value);
+        Image(pixels.data(), width, height).SaveToFile(sourcePath);
+    }
+
+    std::filesystem::path cacheDirectory;
+    std::string sourcePath = "decoded_cache_source.png";
+};
+
+TEST_F(DecodedImageCacheTests, MissThenHit) {
+    DecodedImageCache cache(cacheDirectory);
+    Image image;
+    EXPECT_FALSE(cache.Load(sourcePath, image));
+    EXPECT_EQ(cache.GetStats().misses, 1);
+
+    Image decoded(sourcePath);
+    ASSERT_TRUE(cache.Store(sourcePath, decoded));
+    EXPECT_TRUE(std::filesystem::exists(cache.GetEntryPath(sourcePath)));
+
+    Image cached;
+    ASSERT_TRUE(cache.Load(sourcePath, cached));
+    EXPECT_EQ(cached.GetWidth(), 4);
+    EXPECT_EQ(cached.GetHeight(), 4);
+    EXPECT_EQ(cached.GetPixels()[0], decoded.GetPixels()[0]);
+    EXPECT_EQ(cached.GetFilePathHash(), decoded.GetFilePathHash());
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.stores, 1);
+    EXPECT_EQ(stats.stale, 0);
+}
+
+TEST_F(DecodedImageCacheTests, ChangedSourceIsStale) {
+    DecodedImageCache cache(cacheDirectory);
+    ASSERT_TRUE(cache.Store(sourcePath, Image(sourcePath)));
+
+    WriteSource(8, 2, 10);
+    std::filesystem::last_write_time(sourcePath,
+        std::filesystem::last_write_time(sourcePath) + std::chrono::seconds(5));
+
+    Image image;
+    EXPECT_FALSE(cache.Load(sourcePath, image));
+    EXPECT_EQ(cache.GetStats().stale, 1);
+    EXPECT_EQ(image.GetWidth(), 0);
+}
+
+TEST_F(DecodedImageCacheTests, CorruptEntryIsRejected) {
+    DecodedImageCache cache(cacheDirectory);
+    ASSERT_TRUE(cache.Store(sourcePath, Image(sourcePath)));
+
+    // Truncate the blob
+    const auto entryPath = cache.GetEntryPath(sourcePath);
+    std::filesystem::resize_file(entryPath, std::filesystem::file_size(entryPath) - 3);
+
+    Image image;
+    EXPECT_FALSE(cache.Load(sourcePath, image));
+    EXPECT_EQ(cache.GetStats().stale, 1);
+
+    // Garbage of the right size is rejected by the header check
+    const auto size = std::filesystem::file_size(entryPath);
+    {
+        std::ofstream garbage(entryPath, std::ios::binary | std::ios::trunc);
+        garbage << std::string(static_cast<size_t>(size), 'x');
+    }
+    EXPECT_FALSE(cache.Load(sourcePath, image));
+    EXPECT_EQ(cache.GetStats().stale, 2);
+}
+
+TEST_F(DecodedImageCacheTests, ImageManagerFallsBackAndRepairsEntry) {
+    DataManager dataManager;
+    ImageManager manager(dataManager);
+    manager.SetDecodedCacheDirectory(cacheDirectory.string());
+    nlohmann::json images = { {"cached", {{"file", sourcePath}}} };
+
+    ASSERT_TRUE(manager.CreateFromJson(images));
+    EXPECT_EQ(manager.GetDecodedCache()->GetStats().stores, 1);
+
+    ASSERT_TRUE(manager.CreateFromJson(images));
+    EXPECT_EQ(manager.GetDecodedCache()->GetStats().hits, 1);
+    ASSERT_NE(manager.GetImage("cached"_h), nullptr);
+    EXPECT_EQ(manager.GetImage("cached"_h)->GetPixels()[0], 200);
+
+    // A corrupt entry is decoded from the source again and rewritten
+    std::filesystem::resize_file(manager.GetDecodedCache()->GetEntryPath(sourcePath), 10);
+    ASSERT_TRUE(manager.CreateFromJson(images));
+    EXPECT_EQ(manager.GetDecodedCache()->GetStats().stale, 1);
+    EXPECT_EQ(manager.GetDecodedCache()->GetStats().stores, 2);
+    EXPECT_EQ(manager.GetImage("cached"_h)->GetWidth(), 4);
+}
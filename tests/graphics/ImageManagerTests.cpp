@@ -2,7 +2,9 @@
 #include "graphics/ImageManager.h"
 #include "core/Hash.h"
 #include <nlohmann/json.hpp>
+#include <cstring>
 #include <fstream>
+#include <thread>
 #include "core/DataManager.h"
 
 using namespace ShoeEngine::Graphics;
@@ -45,7 +47,7 @@ TEST_F(ImageManagerTests, GetManagedType) {
 TEST_F(ImageManagerTests, CreateFromJson) {
     EXPECT_TRUE(manager.CreateFromJson(testJson));
     
-    const Image* image = manager.GetImage("test_image"_h);
+    auto image = manager.GetImage("test_image"_h);
     ASSERT_NE(image, nullptr);
     EXPECT_EQ(image->GetWidth(), 4);
     EXPECT_EQ(image->GetHeight(), 4);
@@ -62,3 +64,298 @@ TEST_F(ImageManagerTests, Clear) {
     manager.Clear();
     EXPECT_EQ(manager.GetImage("test_image"_h), nullptr);
 }
+
+TEST_F(ImageManagerTests, AtlasPageIdsCannotClashWithImageIds) {
+    json atlasJson = {
+        {"white", {{"file", "test_image.png"}, {"atlas", "ui"}}},
+        {"ui#0", {{"file", "test_image.png"}}}
+    };
+    ASSERT_TRUE(manager.CreateFromJson(atlasJson));
+
+    // The image named like a page keeps its own texture
+    const Image* page = manager.GetAtlasPage("ui"_h, 0);
+    ASSERT_NE(page, nullptr);
+    EXPECT_NE(page->GetId(), "ui#0"_h);
+    auto white = manager.AcquireTexture("white"_h);
+    auto named = manager.AcquireTexture("ui#0"_h);
+    ASSERT_TRUE(named.texture);
+    EXPECT_NE(white.texture, named.texture);
+    EXPECT_EQ(named.rect, sf::IntRect(0, 0, 4, 4));
+
+    // Ids starting with the page prefix are rejected, before anything is stored
+    EXPECT_FALSE(manager.CreateFromJson({ {"#ui#0", {{"file", "test_image.png"}}} }));
+    EXPECT_EQ(manager.GetImage("#ui#0"_h), nullptr);
+    EXPECT_EQ(manager.AcquireTexture("white"_h).texture, white.texture);
+}
+
+TEST_F(ImageManagerTests, AtlasImagesSharePageTexture) {
+    std::vector<uint8_t> red(2 * 3 * 4, 0);
+    for (size_t i = 0; i < red.size(); i += 4) {
+        red[i] = 255;
+        red[i + 3] = 255;
+    }
+    Image(red.data(), 2, 3).SaveToFile("test_image_red.png");
+
+    json atlasJson = {
+        {"white", {{"file", "test_image.png"}, {"atlas", "pieces"}}},
+        {"red", {{"file", "test_image_red.png"}, {"atlas", "pieces"}}},
+        {"loose", {{"file", "test_image.png"}}}
+    };
+    ASSERT_TRUE(manager.CreateFromJson(atlasJson));
+    std::remove("test_image_red.png");
+
+    EXPECT_EQ(manager.GetAtlasPageCount("pieces"_h), 1);
+    const auto whiteRegion = manager.GetAtlasRegion("white"_h);
+    const auto redRegion = manager.GetAtlasRegion("red"_h);
+    ASSERT_TRUE(whiteRegion.has_value());
+    ASSERT_TRUE(redRegion.has_value());
+    EXPECT_FALSE(manager.GetAtlasRegion("loose"_h).has_value());
+    EXPECT_EQ(whiteRegion->rect.width, 4);
+    EXPECT_EQ(redRegion->rect.height, 3);
+    EXPECT_FALSE(whiteRegion->rect.intersects(redRegion->rect));
+
+    // The page holds the member pixels at their regions
+    const Image* page = manager.GetAtlasPage("pieces"_h, 0);
+    ASSERT_NE(page, nullptr);
+    EXPECT_FLOAT_EQ(redRegion->u1 - redRegion->u0, 2.0f / page->GetWidth());
+    const size_t redPixel = (static_cast<size_t>(redRegion->rect.top) * page->GetWidth() + redRegion->rect.left) * 4;
+    EXPECT_EQ(page->GetPixels()[redPixel], 255);
+    EXPECT_EQ(page->GetPixels()[redPixel + 1], 0);
+
+    auto white = manager.AcquireTexture("white"_h);
+    auto red2 = manager.AcquireTexture("red"_h);
+    auto loose = manager.AcquireTexture("loose"_h);
+    EXPECT_EQ(white.texture, red2.texture);
+    EXPECT_NE(white.texture, loose.texture);
+    EXPECT_EQ(white.rect, whiteRegion->rect);
+    EXPECT_EQ(loose.rect, sf::IntRect(0, 0, 4, 4));
+
+    EXPECT_EQ(manager.SerializeToJson()["white"]["atlas"], "pieces");
+}
+
+TEST_F(ImageManagerTests, AtlasPackingIsDeterministic) {
+    json atlasJson = {
+        {"a", {{"file", "test_image.png"}, {"atlas", "ui"}}},
+        {"b", {{"file", "test_image.png"}, {"atlas", "ui"}}},
+        {"c", {{"file", "test_image.png"}, {"atlas", "ui"}}}
+    };
+    ASSERT_TRUE(manager.CreateFromJson(atlasJson));
+
+    DataManager otherData;
+    ImageManager other(otherData);
+    ASSERT_TRUE(other.CreateFromJson(atlasJson));
+
+    for (auto id : { "a"_h, "b"_h, "c"_h }) {
+        ASSERT_TRUE(manager.GetAtlasRegion(id).has_value());
+        EXPECT_EQ(manager.GetAtlasRegion(id)->rect, other.GetAtlasRegion(id)->rect);
+    }
+}
+
+TEST_F(ImageManagerTests, ImageTooLargeForAtlasFails) {
+    manager.SetAtlasSettings(AtlasPacker::Settings{ 4, 1 });
+    json atlasJson = {
+        {"test_image", {{"file", "test_image.png"}, {"atlas", "tiny"}}}
+    };
+    EXPECT_FALSE(manager.CreateFromJson(atlasJson));
+}
+
+TEST_F(ImageManagerTests, AtlasFailureInsertsNothing) {
+    manager.SetAtlasSettings(AtlasPacker::Settings{ 4, 1 });
+    json atlasJson = {
+        {"a_loose", {{"file", "test_image.png"}}},
+        {"b_member", {{"file", "test_image.png"}, {"atlas", "tiny"}}}
+    };
+    EXPECT_FALSE(manager.CreateFromJson(atlasJson));
+    EXPECT_EQ(manager.GetImage("a_loose"_h), nullptr);
+    EXPECT_EQ(manager.GetAtlasPageCount("tiny"_h), 0);
+}
+
+TEST_F(ImageManagerTests, AtlasMembersReleaseTheirPixels) {
+    json atlasJson = {
+        {"white", {{"file", "test_image.png"}, {"atlas", "pieces"}}}
+    };
+    ASSERT_TRUE(manager.CreateFromJson(atlasJson));
+    EXPECT_EQ(manager.GetStats().residentBytes, 0);
+
+    // Sprites are served from the page without decoding the member again
+    auto region = manager.AcquireTexture("white"_h);
+    EXPECT_NE(region.texture, nullptr);
+    EXPECT_EQ(region.rect.width, 4);
+    EXPECT_EQ(manager.GetStats().misses, 0);
+
+    auto white = manager.GetImage("white"_h);
+    ASSERT_NE(white, nullptr);
+    EXPECT_TRUE(white->IsLoaded());
+    EXPECT_EQ(manager.GetStats().misses, 1);
+}
+
+TEST_F(ImageManagerTests, ParallelDecodeMatchesSequential) {
+    // Images of different sizes and colors, so a mixed-up entry would show
+    json manyJson = json::object();
+    for (int i = 0; i < 16; ++i) {
+        const unsigned int width = 1 + i % 5;
+        const unsigned int height = 1 + i / 5;
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        for (size_t p = 0; p < pixels.size(); ++p) {
+            pixels[p] = static_cast<uint8_t>(i * 16 + p);
+        }
+        const std::string file = "test_image_" + std::to_string(i) + ".png";
+        Image(pixels.data(), width, height).SaveToFile(file);
+        manyJson["image_" + std::to_string(i)] = {{"file", file}};
+    }
+
+    manager.SetDecodeThreadCount(4);
+    ASSERT_TRUE(manager.CreateFromJson(manyJson));
+
+    DataManager sequentialData;
+    ImageManager sequential(sequentialData);
+    sequential.SetDecodeThreadCount(1);
+    ASSERT_TRUE(sequential.CreateFromJson(manyJson));
+
+    for (int i = 0; i < 16; ++i) {
+        std::remove(("test_image_" + std::to_string(i) + ".png").c_str());
+        const Hash::HashValue id("image_" + std::to_string(i));
+        auto image = manager.GetImage(id);
+        auto expected = sequential.GetImage(id);
+        ASSERT_NE(image, nullptr);
+        ASSERT_NE(expected, nullptr);
+        EXPECT_EQ(image->GetId(), id);
+        ASSERT_EQ(image->GetWidth(), expected->GetWidth());
+        ASSERT_EQ(image->GetHeight(), expected->GetHeight());
+        const size_t bytes = static_cast<size_t>(image->GetWidth()) * image->GetHeight() * 4;
+        EXPECT_EQ(std::memcmp(image->GetPixels(), expected->GetPixels(), bytes), 0) << "image_" << i;
+    }
+}
+
+TEST_F(ImageManagerTests, ParallelDecodeStopsAtFailedFile) {
+    json brokenJson = {
+        {"a_good", {{"file", "test_image.png"}}},
+        {"b_missing", {{"file", "missing_image.png"}}},
+        {"c_good", {{"file", "test_image.png"}}}
+    };
+
+    manager.SetDecodeThreadCount(4);
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(manager.CreateFromJson(brokenJson));
+    std::string errors = testing::internal::GetCapturedStderr();
+
+    EXPECT_NE(errors.find("missing_image.png"), std::string::npos);
+    // Entries before the failed file are still inserted, as with sequential loading
+    EXPECT_NE(manager.GetImage("a_good"_h), nullptr);
+    EXPECT_EQ(manager.GetImage("c_good"_h), nullptr);
+}
+
+TEST_F(ImageManagerTests, LazyLoadingDecodesOnFirstRequest) {
+    manager.SetLazyLoading(true);
+    ASSERT_TRUE(manager.CreateFromJson(testJson));
+    EXPECT_EQ(manager.GetStats().residentBytes, 0);
+    EXPECT_EQ(manager.GetStats().misses, 0);
+
+    auto image = manager.GetImage("test_image"_h);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->GetWidth(), 4);
+    EXPECT_EQ(image->GetId(), "test_image"_h);
+    EXPECT_EQ(manager.GetStats().misses, 1);
+    EXPECT_EQ(manager.GetStats().residentBytes, 4 * 4 * 4);
+
+    EXPECT_EQ(manager.GetImage("test_image"_h), image);
+    EXPECT_EQ(manager.GetStats().hits, 1);
+}
+
+TEST_F(ImageManagerTests, LazyLoadingReportsMissingFileOnRequest) {
+    manager.SetLazyLoading(true);
+    json missingJson = {{"missing", {{"file", "missing_image.png"}}}};
+    ASSERT_TRUE(manager.CreateFromJson(missingJson));
+
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(manager.GetImage("missing"_h), nullptr);
+    EXPECT_NE(testing::internal::GetCapturedStderr().find("missing_image.png"), std::string::npos);
+}
+
+TEST_F(ImageManagerTests, ConcurrentRequestsDecodeEachImageOnce) {
+    json fourJson = {
+        {"a", {{"file", "test_image.png"}}},
+        {"b", {{"file", "test_image.png"}}},
+        {"c", {{"file", "test_image.png"}}},
+        {"d", {{"file", "test_image.png"}}}
+    };
+    const Hash::HashValue ids[] = { "a"_h, "b"_h, "c"_h, "d"_h };
+    manager.SetLazyLoading(true);
+    ASSERT_TRUE(manager.CreateFromJson(fourJson));
+
+    // Each thread requests every image, starting at a different one
+    std::vector<std::vector<std::shared_ptr<const Image>>> results(8);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < 4; ++i) {
+                results[t].push_back(manager.GetImage(ids[(t + i) % 4]));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < results.size(); ++t) {
+        for (size_t i = 0; i < 4; ++i) {
+            ASSERT_NE(results[t][i], nullptr);
+            EXPECT_TRUE(results[t][i]->IsLoaded());
+            EXPECT_EQ(results[t][i], manager.GetImage(ids[(t + i) % 4]));
+        }
+    }
+    EXPECT_EQ(manager.GetStats().misses, 4);
+    EXPECT_EQ(manager.GetStats().residentBytes, 4 * 4 * 4 * 4);
+}
+
+TEST_F(ImageManagerTests, MemoryBudgetEvictsLeastRecentlyUsed) {
+    json threeJson = {
+        {"a", {{"file", "test_image.png"}}},
+        {"b", {{"file", "test_image.png"}}},
+        {"c", {{"file", "test_image.png"}}}
+    };
+    const size_t imageBytes = 4 * 4 * 4;
+    manager.SetLazyLoading(true);
+    manager.SetMemoryBudget(2 * imageBytes);
+    ASSERT_TRUE(manager.CreateFromJson(threeJson));
+
+    auto a = manager.GetImage("a"_h);
+    manager.GetImage("b"_h);
+    manager.GetImage("a"_h);  // b is now the least recently used
+    manager.GetImage("c"_h);
+
+    EXPECT_EQ(manager.GetStats().evictions, 1);
+    EXPECT_EQ(manager.GetStats().residentBytes, 2 * imageBytes);
+    EXPECT_TRUE(a->IsLoaded());
+
+    // The evicted image is decoded again in place
+    const size_t misses = manager.GetStats().misses;
+    auto b = manager.GetImage("b"_h);
+    ASSERT_NE(b, nullptr);
+    EXPECT_TRUE(b->IsLoaded());
+    EXPECT_EQ(manager.GetStats().misses, misses + 1);
+    EXPECT_EQ(manager.GetStats().evictions, 2);
+}
+
+TEST_F(ImageManagerTests, PinnedImagesAreNotEvicted) {
+    json twoJson = {
+        {"a", {{"file", "test_image.png"}}},
+        {"b", {{"file", "test_image.png"}}}
+    };
+    manager.SetLazyLoading(true);
+    manager.SetMemoryBudget(4 * 4 * 4);
+    ASSERT_TRUE(manager.CreateFromJson(twoJson));
+
+    auto pinned = manager.GetImage("a"_h);
+    ASSERT_NE(pinned, nullptr);
+    manager.GetImage("b"_h);
+
+    // Over budget, but the only other image is pinned
+    EXPECT_TRUE(pinned->IsLoaded());
+    EXPECT_EQ(manager.GetStats().evictions, 0);
+    EXPECT_EQ(manager.GetStats().residentBytes, 2 * 4 * 4 * 4);
+
+    pinned.reset();
+    manager.SetMemoryBudget(4 * 4 * 4);
+    EXPECT_EQ(manager.GetStats().evictions, 1);
+}
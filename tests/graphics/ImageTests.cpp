@@ -67,3 +67,16 @@ TEST_F(ImageTests, CloneImage) {
     EXPECT_EQ(clonePixels[2], originalPixels[2]);
     EXPECT_EQ(clonePixels[3], originalPixels[3]);
 }
+
+TEST_F(ImageTests, UnloadEmptiesImageInPlace) {
+    Image image(testPixels.data(), 4, 4);
+    const sf::Image& sfmlImage = image.GetSFMLImage();
+
+    image.Unload();
+    EXPECT_FALSE(image.IsLoaded());
+    EXPECT_EQ(&image.GetSFMLImage(), &sfmlImage);
+    EXPECT_EQ(sfmlImage.getSize().x, 0u);
+
+    ASSERT_TRUE(image.LoadFromPixels(testPixels.data(), 4, 4));
+    EXPECT_EQ(sfmlImage.getSize().x, 4u);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "graphics/SpatialGrid.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+
+namespace {
+
+std::vector<uint32_t> QueryRect(const SpatialGrid& grid, const sf::FloatRect& area) {
+    std::vector<uint32_t> results;
+    grid.QueryRect(area, results);
+    std::sort(results.begin(), results.end());
+    return results;
+}
+
+std::vector<uint32_t> QueryPoint(const SpatialGrid& grid, float x, float y) {
+    std::vector<uint32_t> results;
+    grid.QueryPoint(x, y, results);
+    std::sort(results.begin(), results.end());
+    return results;
+}
+
+bool Overlaps(const sf::FloatRect& a, const sf::FloatRect& b) {
+    return a.left < b.left + b.width && b.left < a.left + a.width && a.top < b.top + b.height && b.top < a.top + a.height;
+}
+
+} // namespace
+
+TEST(SpatialGridTests, QueriesFindOverlappingItems) {
+    SpatialGrid grid(10.0f);
+    grid.Update(0, sf::FloatRect(0.0f, 0.0f, 5.0f, 5.0f));
+    grid.Update(1, sf::FloatRect(100.0f, 100.0f, 5.0f, 5.0f));
+    grid.Update(2, sf::FloatRect(-25.0f, -25.0f, 40.0f, 40.0f)); // Spans 25 cells
+    EXPECT_EQ(grid.GetCount(), 3);
+
+    EXPECT_EQ(QueryRect(grid, sf::FloatRect(-1.0f, -1.0f, 3.0f, 3.0f)), (std::vector<uint32_t>{ 0, 2 }));
+    EXPECT_EQ(QueryRect(grid, sf::FloatRect(90.0f, 90.0f, 50.0f, 50.0f)), (std::vector<uint32_t>{ 1 }));
+    EXPECT_EQ(QueryRect(grid, sf::FloatRect(-1000.0f, -1000.0f, 2000.0f, 2000.0f)), (std::vector<uint32_t>{ 0, 1, 2 }));
+    EXPECT_TRUE(QueryRect(grid, sf::FloatRect(50.0f, 0.0f, 10.0f, 10.0f)).empty());
+
+    EXPECT_EQ(QueryPoint(grid, 2.0f, 2.0f), (std::vector<uint32_t>{ 0, 2 }));
+    EXPECT_EQ(QueryPoint(grid, -20.0f, 10.0f), (std::vector<uint32_t>{ 2 }));
+    EXPECT_TRUE(QueryPoint(grid, 5.0f, 20.0f).empty());
+}
+
+TEST(SpatialGridTests, UpdateMovesAndRemovesItems) {
+    SpatialGrid grid(10.0f);
+    grid.Update(3, sf::FloatRect(0.0f, 0.0f, 5.0f, 5.0f));
+    grid.Update(3, sf::FloatRect(200.0f, 0.0f, 5.0f, 5.0f));
+    EXPECT_EQ(grid.GetCount(), 1);
+    EXPECT_TRUE(QueryPoint(grid, 2.0f, 2.0f).empty());
+    EXPECT_EQ(QueryPoint(grid, 202.0f, 2.0f), (std::vector<uint32_t>{ 3 }));
+
+    // Empty bounds remove the item, like Remove
+    grid.Update(3, sf::FloatRect(200.0f, 0.0f, 0.0f, 5.0f));
+    EXPECT_FALSE(grid.Contains(3));
+    EXPECT_EQ(grid.GetCount(), 0);
+    EXPECT_FALSE(grid.Remove(3));
+
+    grid.Update(4, sf::FloatRect(0.0f, 0.0f, 5.0f, 5.0f));
+    EXPECT_TRUE(grid.Remove(4));
+    EXPECT_TRUE(QueryPoint(grid, 2.0f, 2.0f).empty());
+}
+
+TEST(SpatialGridTests, LargeItemsAreFound) {
+    SpatialGrid grid(1.0f);
+    grid.Update(0, sf::FloatRect(0.0f, 0.0f, 1000.0f, 1000.0f));
+    grid.Update(1, sf::FloatRect(10.0f, 10.0f, 0.5f, 0.5f));
+
+    EXPECT_EQ(QueryPoint(grid, 10.25f, 10.25f), (std::vector<uint32_t>{ 0, 1 }));
+    EXPECT_EQ(QueryRect(grid, sf::FloatRect(500.0f, 500.0f, 1.0f, 1.0f)), (std::vector<uint32_t>{ 0 }));
+
+    // Shrinking the item lists it in cells again
+    grid.Update(0, sf::FloatRect(0.0f, 0.0f, 2.0f, 2.0f));
+    EXPECT_TRUE(QueryRect(grid, sf::FloatRect(500.0f, 500.0f, 1.0f, 1.0f)).empty());
+    EXPECT_EQ(QueryPoint(grid, 1.5f, 1.5f), (std::vector<uint32_t>{ 0 }));
+}
+
+TEST(SpatialGridTests, MatchesBruteForce) {
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> size(1.0f, 150.0f);
+    const auto randomRect = [&] { return sf::FloatRect(position(random), position(random), size(random), size(random)); };
+
+    SpatialGrid grid(64.0f);
+    std::vector<sf::FloatRect> bounds(300);
+    std::vector<bool> present(bounds.size(), false);
+    for (int round = 0; round < 2000; ++round) {
+        const uint32_t id = static_cast<uint32_t>(random() % bounds.size());
+        if (random() % 5 == 0) {
+            EXPECT_EQ(grid.Remove(id), present[id]);
+            present[id] = false;
+        }
+        else {
+            bounds[id] = randomRect();
+            grid.Update(id, bounds[id]);
+            present[id] = true;
+        }
+
+        if (round % 50 == 0) {
+            const sf::FloatRect area = randomRect();
+            std::vector<uint32_t> expected;
+            for (uint32_t i = 0; i < bounds.size(); ++i) {
+                if (present[i] && Overlaps(bounds[i], area)) {
+                    expected.push_back(i);
+                }
+            }
+            EXPECT_EQ(QueryRect(grid, area), expected);
+        }
+    }
+    EXPECT_EQ(grid.GetCount(), static_cast<size_t>(std::count(present.begin(), present.end(), true)));
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "graphics/SpriteBatch.h"
+#include "graphics/TextureCache.h"
+#include "core/Hash.h"
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+using namespace ShoeEngine::Core;
+
+class SpriteBatchTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::vector<uint8_t> pixels(4 * 4 * 4, 255);
+        imageA = Image(pixels.data(), 2, 2);
+        imageA.SetId("image_a"_h);
+        imageB = Image(pixels.data(), 4, 4);
+        imageB.SetId("image_b"_h);
+    }
+
+    Sprite MakeSprite(const Image& image, float x, float y) {
+        Sprite sprite(image, cache.Acquire(image));
+        sprite.SetPosition(x, y);
+        return sprite;
+    }
+
+    TextureCache cache;
+    Image imageA;
+    Image imageB;
+    SpriteBatch batch;
+};
+
+TEST_F(SpriteBatchTests, AppendQuadMatchesSpriteGeometry) {
+    Sprite sprite = MakeSprite(imageA, 10.0f, 20.0f);
+    sprite.SetScale(2.0f, 3.0f);
+
+    std::vector<sf::Vertex> vertices;
+    const sf::Sprite& sfSprite = sprite.GetSFMLSprite();
+    SpriteBatch::AppendQuad(sfSprite.getTransform(), sfSprite.getTextureRect(), sf::Color::White, vertices);
+
+    ASSERT_EQ(vertices.size(), SpriteBatch::VERTICES_PER_SPRITE);
+    EXPECT_FLOAT_EQ(vertices[0].position.x, 10.0f);
+    EXPECT_FLOAT_EQ(vertices[0].position.y, 20.0f);
+    EXPECT_FLOAT_EQ(vertices[2].position.x, 14.0f);
+    EXPECT_FLOAT_EQ(vertices[2].position.y, 26.0f);
+    EXPECT_FLOAT_EQ(vertices[2].texCoords.x, 2.0f);
+    EXPECT_FLOAT_EQ(vertices[2].texCoords.y, 2.0f);
+
+    auto [left, top, width, height] = sprite.GetGlobalBounds();
+    EXPECT_FLOAT_EQ(vertices[5].position.x, left);
+    EXPECT_FLOAT_EQ(vertices[5].position.y, top + height);
+    EXPECT_FLOAT_EQ(vertices[1].position.x, left + width);
+}
+
+TEST_F(SpriteBatchTests, AppendQuadFlippedTextureRect) {
+    std::vector<sf::Vertex> vertices;
+    SpriteBatch::AppendQuad(sf::Transform::Identity, sf::IntRect(4, 0, -4, 2), sf::Color::Red, vertices);
+
+    ASSERT_EQ(vertices.size(), SpriteBatch::VERTICES_PER_SPRITE);
+    EXPECT_FLOAT_EQ(vertices[1].position.x, 4.0f);   // Geometry uses the absolute size
+    EXPECT_FLOAT_EQ(vertices[0].texCoords.x, 4.0f);  // Texture coordinates run backwards
+    EXPECT_FLOAT_EQ(vertices[1].texCoords.x, 0.0f);
+    EXPECT_EQ(vertices[0].color, sf::Color::Red);
+}
+
+TEST_F(SpriteBatchTests, SpritesSharingTextureFormOneBatch) {
+    std::vector<Sprite> sprites;
+    sprites.push_back(MakeSprite(imageA, 0.0f, 0.0f));
+    sprites.push_back(MakeSprite(imageB, 10.0f, 0.0f));
+    sprites.push_back(MakeSprite(imageA, 20.0f, 0.0f));
+    sprites.push_back(MakeSprite(imageA, 30.0f, 0.0f));
+
+    batch.Begin();
+    for (const auto& sprite : sprites) {
+        batch.Draw(sprite);
+    }
+    batch.Build();
+
+    ASSERT_EQ(batch.GetBatches().size(), 2);
+    EXPECT_EQ(batch.GetBatches()[0].texture, sprites[0].GetTexture());
+    EXPECT_EQ(batch.GetBatches()[0].vertexCount, 3 * SpriteBatch::VERTICES_PER_SPRITE);
+    EXPECT_EQ(batch.GetBatches()[1].texture, sprites[1].GetTexture());
+    EXPECT_EQ(batch.GetVertices().size(), 4 * SpriteBatch::VERTICES_PER_SPRITE);
+    EXPECT_EQ(batch.GetLastStats().sprites, 4);
+
+    // Sort is stable: sprites with the same texture keep their submission order
+    EXPECT_FLOAT_EQ(batch.GetVertices()[SpriteBatch::VERTICES_PER_SPRITE].position.x, 20.0f);
+}
+
+TEST_F(SpriteBatchTests, DeferredModeKeepsSubmissionOrder) {
+    Sprite first = MakeSprite(imageA, 0.0f, 0.0f);
+    Sprite second = MakeSprite(imageB, 0.0f, 0.0f);
+    Sprite third = MakeSprite(imageA, 0.0f, 0.0f);
+
+    batch.Begin(SpriteBatch::SortMode::Deferred);
+    batch.Draw(first);
+    batch.Draw(third);
+    batch.Draw(second);
+    batch.Draw(first);
+    batch.Build();
+
+    ASSERT_EQ(batch.GetBatches().size(), 3);
+    EXPECT_EQ(batch.GetBatches()[0].vertexCount, 2 * SpriteBatch::VERTICES_PER_SPRITE);
+    EXPECT_EQ(batch.GetBatches()[1].texture, second.GetTexture());
+    EXPECT_EQ(batch.GetBatches()[2].texture, first.GetTexture());
+}
+
+TEST_F(SpriteBatchTests, LowerLayersComeFirst) {
+    Sprite top = MakeSprite(imageA, 0.0f, 0.0f);
+    Sprite bottom = MakeSprite(imageB, 0.0f, 0.0f);
+
+    batch.Begin();
+    batch.Draw(top, 2);
+    batch.Draw(bottom, -1);
+    batch.Build();
+
+    ASSERT_EQ(batch.GetBatches().size(), 2);
+    EXPECT_EQ(batch.GetBatches()[0].layer, -1);
+    EXPECT_EQ(batch.GetBatches()[0].texture, bottom.GetTexture());
+    EXPECT_EQ(batch.GetBatches()[1].layer, 2);
+}
+
+TEST_F(SpriteBatchTests, SpritesWithoutTextureAreIgnored) {
+    Sprite empty;
+
+    batch.Begin();
+    batch.Draw(empty);
+    batch.Build();
+
+    EXPECT_TRUE(batch.GetBatches().empty());
+    EXPECT_EQ(batch.GetLastStats().sprites, 0);
+}
+
+TEST_F(SpriteBatchTests, EndIssuesOneDrawCallPerBatch) {
+    Sprite first = MakeSprite(imageA, 0.0f, 0.0f);
+    Sprite second = MakeSprite(imageA, 4.0f, 0.0f);
+    Sprite third = MakeSprite(imageB, 8.0f, 0.0f);
+
+    sf::RenderTexture target;
+    ASSERT_TRUE(target.create(16, 16));
+
+    batch.Begin();
+    batch.Draw(first);
+    batch.Draw(third);
+    batch.Draw(second);
+    batch.End(target);
+
+    EXPECT_EQ(batch.GetLastStats().drawCalls, 2);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "graphics/SpriteDrawOrder.h"
+#include <memory>
+#include <vector>
+
+using namespace ShoeEngine;
+using namespace ShoeEngine::Graphics;
+
+namespace {
+
+SpriteHandle CreateSprite(SpriteStorage& storage, uint32_t name, const std::shared_ptr<const sf::Texture>& texture,
+    int layer, float depth) {
+    const SpriteHandle sprite = storage.Create(name);
+    storage.SetImage(sprite, Core::Hash::HashValue(name), texture, sf::IntRect(0, 0, 8, 8));
+    storage.SetLayer(sprite, layer);
+    storage.SetDepth(sprite, depth);
+    return sprite;
+}
+
+} // namespace
+
+TEST(SpriteDrawOrderTests, KeysOrderByLayerTextureDepth) {
+    EXPECT_LT(SpriteDrawOrder::MakeKey(-1, 9, 9.0f), SpriteDrawOrder::MakeKey(0, 0, -9.0f));
+    EXPECT_LT(SpriteDrawOrder::MakeKey(0, 1, 9.0f), SpriteDrawOrder::MakeKey(0, 2, -9.0f));
+    EXPECT_LT(SpriteDrawOrder::MakeKey(0, 1, -0.5f), SpriteDrawOrder::MakeKey(0, 1, 0.25f));
+    // Out of range layers clamp
+    EXPECT_EQ(SpriteDrawOrder::MakeKey(100000, 0, 0.0f), SpriteDrawOrder::MakeKey(32767, 0, 0.0f));
+    EXPECT_EQ(SpriteDrawOrder::MakeKey(-100000, 0, 0.0f), SpriteDrawOrder::MakeKey(-32768, 0, 0.0f));
+}
+
+TEST(SpriteDrawOrderTests, SortsByLayerThenTextureThenDepth) {
+    const auto textureA = std::make_shared<const sf::Texture>();
+    const auto textureB = std::make_shared<const sf::Texture>();
+    SpriteStorage storage;
+    const SpriteHandle top = CreateSprite(storage, 1, textureA, 2, 0.0f);
+    const SpriteHandle b = CreateSprite(storage, 2, textureB, 0, 0.0f);
+    const SpriteHandle aBack = CreateSprite(storage, 3, textureA, 0, -1.0f);
+    const SpriteHandle aFront = CreateSprite(storage, 4, textureA, 0, 5.0f);
+    const SpriteHandle background = CreateSprite(storage, 5, textureB, -3, 0.0f);
+    const SpriteHandle tie = CreateSprite(storage, 6, textureA, 0, 5.0f);
+    storage.Create(7); // No texture, so not drawn
+
+    SpriteDrawOrder order;
+    EXPECT_TRUE(order.Update(storage));
+    // textureA is numbered first, as it is used by the lowest slot; equal keys keep slot order
+    const std::vector<uint32_t> expected = { background.index, aBack.index, aFront.index, tie.index, b.index, top.index };
+    EXPECT_EQ(order.GetSlots(), expected);
+    EXPECT_EQ(order.GetRank(background.index), 0);
+    EXPECT_EQ(order.GetRank(6), SpriteDrawOrder::NOT_DRAWN);
+
+    std::vector<uint32_t> visible = { top.index, aBack.index, b.index };
+    order.Sort(visible);
+    EXPECT_EQ(visible, (std::vector<uint32_t>{ aBack.index, b.index, top.index }));
+}
+
+TEST(SpriteDrawOrderTests, SortsOnlyAfterOrderChanges) {
+    const auto texture = std::make_shared<const sf::Texture>();
+    SpriteStorage storage;
+    const SpriteHandle first = CreateSprite(storage, 1, texture, 0, 0.0f);
+    const SpriteHandle second = CreateSprite(storage, 2, texture, 0, 0.0f);
+
+    SpriteDrawOrder order;
+    EXPECT_TRUE(order.Update(storage));
+    EXPECT_FALSE(order.Update(storage));
+
+    // Transforms do not affect the order
+    storage.SetPosition(first, 10.0f, 10.0f);
+    storage.SetRotation(first, 30.0f);
+    storage.SetLayer(first, 0);
+    EXPECT_FALSE(order.Update(storage));
+    EXPECT_EQ(order.GetSortCount(), 1);
+
+    storage.SetDepth(first, 1.0f);
+    EXPECT_TRUE(order.Update(storage));
+    EXPECT_EQ(order.GetSlots(), (std::vector<uint32_t>{ second.index, first.index }));
+
+    storage.Destroy(second);
+    EXPECT_TRUE(order.Update(storage));
+    EXPECT_EQ(order.GetSlots(), (std::vector<uint32_t>{ first.index }));
+    EXPECT_EQ(order.GetSortCount(), 3);
+}
@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 #include "graphics/SpriteManager.h"
+#include "graphics/Window.h"
 #include "core/Hash.h"
 #include "core/DataManager.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <fstream>
 
 using namespace ShoeEngine::Graphics;
@@ -72,20 +74,21 @@ TEST_F(SpriteManagerTests, GetManagedType) {
 TEST_F(SpriteManagerTests, CreateFromJson) {
     EXPECT_TRUE(spriteManager.CreateFromJson(testJson));
     
-    const Sprite* sprite = spriteManager.GetSprite("test_sprite"_h);
-    ASSERT_NE(sprite, nullptr);
+    const SpriteHandle sprite = spriteManager.GetSprite("test_sprite"_h);
+    ASSERT_TRUE(spriteManager.IsValid(sprite));
+    const SpriteStorage& storage = spriteManager.GetStorage();
     
-    auto position = sprite->GetPosition();
+    auto position = storage.GetPosition(sprite);
     EXPECT_EQ(position.first, 100.0f);
     EXPECT_EQ(position.second, 200.0f);
     
-    EXPECT_EQ(sprite->GetRotation(), 45.0f);
+    EXPECT_EQ(storage.GetRotation(sprite), 45.0f);
     
-    auto scale = sprite->GetScale();
+    auto scale = storage.GetScale(sprite);
     EXPECT_EQ(scale.first, 2.0f);
     EXPECT_EQ(scale.second, 2.0f);
     
-    auto origin = sprite->GetOrigin();
+    auto origin = storage.GetOrigin(sprite);
     EXPECT_EQ(origin.first, 2.0f);
     EXPECT_EQ(origin.second, 2.0f);
 }
@@ -101,16 +104,38 @@ TEST_F(SpriteManagerTests, CreateWithInvalidImage) {
     EXPECT_FALSE(spriteManager.CreateFromJson(invalidJson));
 }
 
+TEST_F(SpriteManagerTests, SpritesShareImageTexture) {
+    json multipleJson = {
+        {"sprite_a", {{"image", "test_image"}}},
+        {"sprite_b", {{"image", "test_image"}}},
+        {"sprite_c", {{"image", "test_image"}}}
+    };
+
+    EXPECT_TRUE(spriteManager.CreateFromJson(multipleJson));
+
+    const SpriteHandle spriteA = spriteManager.GetSprite("sprite_a"_h);
+    const SpriteHandle spriteC = spriteManager.GetSprite("sprite_c"_h);
+    ASSERT_TRUE(spriteManager.IsValid(spriteA));
+    ASSERT_TRUE(spriteManager.IsValid(spriteC));
+    EXPECT_EQ(spriteManager.GetStorage().GetTexture(spriteA), spriteManager.GetStorage().GetTexture(spriteC));
+
+    const TextureCache& cache = imageManager.GetTextureCache();
+    EXPECT_EQ(cache.GetUploadCount(), 1);
+    EXPECT_EQ(cache.GetUploadedBytes(), 4 * 4 * 4);
+}
+
 TEST_F(SpriteManagerTests, GetNonexistentSprite) {
-    EXPECT_EQ(spriteManager.GetSprite("nonexistent"_h), nullptr);
+    EXPECT_TRUE(spriteManager.GetSprite("nonexistent"_h).IsNull());
 }
 
 TEST_F(SpriteManagerTests, Clear) {
     EXPECT_TRUE(spriteManager.CreateFromJson(testJson));
-    EXPECT_NE(spriteManager.GetSprite("test_sprite"_h), nullptr);
+    const SpriteHandle sprite = spriteManager.GetSprite("test_sprite"_h);
+    EXPECT_TRUE(spriteManager.IsValid(sprite));
     
     spriteManager.Clear();
-    EXPECT_EQ(spriteManager.GetSprite("test_sprite"_h), nullptr);
+    EXPECT_TRUE(spriteManager.GetSprite("test_sprite"_h).IsNull());
+    EXPECT_FALSE(spriteManager.IsValid(sprite));
 }
 
 TEST_F(SpriteManagerTests, SerializeEmptyManager) {
@@ -127,26 +152,27 @@ TEST_F(SpriteManagerTests, SerializeAndDeserialize) {
     
     // Clear and verify
     spriteManager.Clear();
-    EXPECT_EQ(spriteManager.GetSprite("test_sprite"_h), nullptr);
+    EXPECT_TRUE(spriteManager.GetSprite("test_sprite"_h).IsNull());
     
     // Deserialize
     EXPECT_TRUE(spriteManager.CreateFromJson(serialized));
     
     // Verify sprite was restored correctly
-    const Sprite* sprite = spriteManager.GetSprite("test_sprite"_h);
-    ASSERT_NE(sprite, nullptr);
+    const SpriteHandle sprite = spriteManager.GetSprite("test_sprite"_h);
+    ASSERT_TRUE(spriteManager.IsValid(sprite));
+    const SpriteStorage& storage = spriteManager.GetStorage();
     
-    auto position = sprite->GetPosition();
+    auto position = storage.GetPosition(sprite);
     EXPECT_EQ(position.first, 100.0f);
     EXPECT_EQ(position.second, 200.0f);
     
-    EXPECT_EQ(sprite->GetRotation(), 45.0f);
+    EXPECT_EQ(storage.GetRotation(sprite), 45.0f);
     
-    auto scale = sprite->GetScale();
+    auto scale = storage.GetScale(sprite);
     EXPECT_EQ(scale.first, 2.0f);
     EXPECT_EQ(scale.second, 2.0f);
     
-    auto origin = sprite->GetOrigin();
+    auto origin = storage.GetOrigin(sprite);
     EXPECT_EQ(origin.first, 2.0f);
     EXPECT_EQ(origin.second, 2.0f);
 }
@@ -182,25 +208,173 @@ TEST_F(SpriteManagerTests, SerializeMultipleSprites) {
     
     // Clear and verify
     spriteManager.Clear();
-    EXPECT_EQ(spriteManager.GetSprite("test_sprite"_h), nullptr);
-    EXPECT_EQ(spriteManager.GetSprite("test_sprite2"_h), nullptr);
+    EXPECT_TRUE(spriteManager.GetSprite("test_sprite"_h).IsNull());
+    EXPECT_TRUE(spriteManager.GetSprite("test_sprite2"_h).IsNull());
     
     // Deserialize
     EXPECT_TRUE(spriteManager.CreateFromJson(serialized));
     
     // Verify first sprite
-    const Sprite* sprite1 = spriteManager.GetSprite("test_sprite"_h);
-    ASSERT_NE(sprite1, nullptr);
+    const SpriteHandle sprite1 = spriteManager.GetSprite("test_sprite"_h);
+    ASSERT_TRUE(spriteManager.IsValid(sprite1));
     
-    auto position1 = sprite1->GetPosition();
+    auto position1 = spriteManager.GetStorage().GetPosition(sprite1);
     EXPECT_EQ(position1.first, 100.0f);
     EXPECT_EQ(position1.second, 200.0f);
     
     // Verify second sprite
-    const Sprite* sprite2 = spriteManager.GetSprite("test_sprite2"_h);
-    ASSERT_NE(sprite2, nullptr);
+    const SpriteHandle sprite2 = spriteManager.GetSprite("test_sprite2"_h);
+    ASSERT_TRUE(spriteManager.IsValid(sprite2));
     
-    auto position2 = sprite2->GetPosition();
+    auto position2 = spriteManager.GetStorage().GetPosition(sprite2);
     EXPECT_EQ(position2.first, 300.0f);
     EXPECT_EQ(position2.second, 400.0f);
 }
+
+TEST_F(SpriteManagerTests, SpriteChangesBumpGeneration) {
+    EXPECT_TRUE(spriteManager.CreateFromJson(testJson));
+    const SpriteHandle sprite = spriteManager.GetSprite("test_sprite"_h);
+    ASSERT_TRUE(spriteManager.IsValid(sprite));
+
+    const uint64_t generation = spriteManager.GetGeneration();
+    EXPECT_EQ(spriteManager.GetGeneration(), generation);
+    spriteManager.GetStorage().SetPosition(sprite, 5.0f, 6.0f);
+    EXPECT_GT(spriteManager.GetGeneration(), generation);
+
+    const uint64_t moved = spriteManager.GetGeneration();
+    spriteManager.Clear();
+    EXPECT_GT(spriteManager.GetGeneration(), moved);
+}
+
+TEST_F(SpriteManagerTests, ReloadKeepsHandles) {
+    EXPECT_TRUE(spriteManager.CreateFromJson(testJson));
+    const SpriteHandle sprite = spriteManager.GetSprite("test_sprite"_h);
+
+    json moved = testJson;
+    moved["test_sprite"]["position"] = { {"x", 7.0f}, {"y", 8.0f} };
+    EXPECT_TRUE(spriteManager.CreateFromJson(moved));
+
+    EXPECT_EQ(spriteManager.GetSprite("test_sprite"_h), sprite);
+    EXPECT_EQ(spriteManager.GetStorage().GetPosition(sprite), std::make_pair(7.0f, 8.0f));
+    EXPECT_EQ(spriteManager.GetStorage().GetCount(), 1);
+}
+
+TEST_F(SpriteManagerTests, DestroySpriteRecyclesSlot) {
+    const SpriteHandle first = spriteManager.CreateSprite("first", "test_image");
+    ASSERT_TRUE(spriteManager.IsValid(first));
+    EXPECT_EQ(spriteManager.GetImage(first), imageManager.GetImage("test_image"_h));
+    EXPECT_TRUE(spriteManager.CreateSprite("missing", "nonexistent_image").IsNull());
+
+    EXPECT_TRUE(spriteManager.DestroySprite(first));
+    EXPECT_FALSE(spriteManager.DestroySprite(first));
+    EXPECT_TRUE(spriteManager.GetSprite("first"_h).IsNull());
+
+    const SpriteHandle second = spriteManager.CreateSprite("second", "test_image");
+    EXPECT_EQ(second.index, first.index);
+    EXPECT_FALSE(spriteManager.IsValid(first));
+    EXPECT_TRUE(spriteManager.IsValid(second));
+
+    json serialized = spriteManager.SerializeToJson();
+    EXPECT_EQ(serialized.size(), 1);
+    EXPECT_TRUE(serialized.contains("second"));
+}
+
+TEST_F(SpriteManagerTests, WrittenSectionMatchesDumpedTree) {
+    // Slot order differs from name order
+    ASSERT_TRUE(spriteManager.CreateSprite("zebra", "test_image").index < spriteManager.CreateSprite("apple", "test_image").index);
+    ASSERT_TRUE(spriteManager.IsValid(spriteManager.CreateSprite("mango", "test_image")));
+
+    JsonWriter writer(4);
+    spriteManager.WriteJson(writer);
+    EXPECT_EQ(writer.GetBuffer(), spriteManager.SerializeToJson().dump(4));
+}
+
+TEST_F(SpriteManagerTests, PickAndQuerySprites) {
+    // The 4x4 test image, scaled by 2
+    json spritesJson = {
+        {"near", {{"image", "test_image"}, {"position", {{"x", 10.0f}, {"y", 10.0f}}}, {"scale", {{"x", 2.0f}, {"y", 2.0f}}}}},
+        {"overlap", {{"image", "test_image"}, {"position", {{"x", 14.0f}, {"y", 14.0f}}}, {"scale", {{"x", 2.0f}, {"y", 2.0f}}}}},
+        {"far", {{"image", "test_image"}, {"position", {{"x", 5000.0f}, {"y", 5000.0f}}}}}
+    };
+    EXPECT_TRUE(spriteManager.CreateFromJson(spritesJson));
+    const SpriteHandle nearSprite = spriteManager.GetSprite("near"_h);
+    const SpriteHandle overlapSprite = spriteManager.GetSprite("overlap"_h);
+    const SpriteHandle farSprite = spriteManager.GetSprite("far"_h);
+
+    EXPECT_EQ(spriteManager.PickSprite(11.0f, 11.0f), nearSprite);
+    EXPECT_EQ(spriteManager.PickSprite(5001.0f, 5001.0f), farSprite);
+    EXPECT_TRUE(spriteManager.PickSprite(30.0f, 30.0f).IsNull());
+
+    // Where the two overlap, the sprite in the higher slot wins
+    const SpriteHandle top = nearSprite.index > overlapSprite.index ? nearSprite : overlapSprite;
+    EXPECT_EQ(spriteManager.PickSprite(15.0f, 15.0f), top);
+
+    std::vector<SpriteHandle> found;
+    spriteManager.QuerySprites(sf::FloatRect(0.0f, 0.0f, 100.0f, 100.0f), found);
+    EXPECT_EQ(found.size(), 2);
+
+    // Moved and destroyed sprites are updated in the index
+    spriteManager.GetStorage().SetPosition(farSprite, 50.0f, 50.0f);
+    EXPECT_TRUE(spriteManager.DestroySprite(nearSprite));
+    found.clear();
+    spriteManager.QuerySprites(sf::FloatRect(0.0f, 0.0f, 100.0f, 100.0f), found);
+    ASSERT_EQ(found.size(), 2);
+    EXPECT_LT(found[0].index, found[1].index);
+    EXPECT_TRUE(std::find(found.begin(), found.end(), overlapSprite) != found.end());
+    EXPECT_TRUE(std::find(found.begin(), found.end(), farSprite) != found.end());
+    EXPECT_EQ(spriteManager.GetSpatialGrid().GetCount(), 2);
+}
+
+TEST_F(SpriteManagerTests, RenderCullsSpritesOutsideView) {
+    json spritesJson = {
+        {"visible", {{"image", "test_image"}, {"position", {{"x", 100.0f}, {"y", 100.0f}}}}},
+        {"offscreen", {{"image", "test_image"}, {"position", {{"x", -500.0f}, {"y", 100.0f}}}}}
+    };
+    EXPECT_TRUE(spriteManager.CreateFromJson(spritesJson));
+
+    Window window("Culling", 800, 600);
+    spriteManager.Render(window);
+    EXPECT_EQ(spriteManager.GetSpriteBatch().GetLastStats().sprites, 1);
+
+    spriteManager.GetStorage().SetPosition(spriteManager.GetSprite("offscreen"_h), 300.0f, 300.0f);
+    spriteManager.Render(window);
+    EXPECT_EQ(spriteManager.GetSpriteBatch().GetLastStats().sprites, 2);
+}
+
+TEST_F(SpriteManagerTests, LayersControlDrawOrderAndPicking) {
+    // "front" has the lowest slot but the highest layer
+    json spritesJson = {
+        {"front", {{"image", "test_image"}, {"layer", 2}, {"position", {{"x", 10.0f}, {"y", 10.0f}}}}},
+        {"back", {{"image", "test_image"}, {"layer", -1}, {"depth", 0.5f}, {"position", {{"x", 12.0f}, {"y", 12.0f}}}}}
+    };
+    EXPECT_TRUE(spriteManager.CreateFromJson(spritesJson));
+    const SpriteHandle front = spriteManager.GetSprite("front"_h);
+    const SpriteHandle back = spriteManager.GetSprite("back"_h);
+    const SpriteStorage& storage = spriteManager.GetStorage();
+    EXPECT_EQ(storage.GetLayer(front), 2);
+    EXPECT_EQ(storage.GetLayer(back), -1);
+    EXPECT_EQ(storage.GetDepth(back), 0.5f);
+
+    EXPECT_EQ(spriteManager.PickSprite(13.0f, 13.0f), front);
+
+    Window window("Layers", 800, 600);
+    spriteManager.Render(window);
+    const auto& batches = spriteManager.GetSpriteBatch().GetBatches();
+    ASSERT_EQ(batches.size(), 2);
+    EXPECT_EQ(batches[0].layer, -1);
+    EXPECT_EQ(batches[1].layer, 2);
+
+    // Moving sprites keeps the order without sorting again
+    const size_t sorts = spriteManager.GetDrawOrder().GetSortCount();
+    spriteManager.GetStorage().Move(back, 1.0f, 1.0f);
+    spriteManager.Render(window);
+    EXPECT_EQ(spriteManager.GetDrawOrder().GetSortCount(), sorts);
+
+    // Layer and depth are saved
+    json serialized = spriteManager.SerializeToJson();
+    EXPECT_EQ(serialized["back"]["layer"], -1);
+    EXPECT_EQ(serialized["back"]["depth"], 0.5f);
+    spriteManager.Clear();
+    EXPECT_TRUE(spriteManager.CreateFromJson(serialized));
+    EXPECT_EQ(spriteManager.GetStorage().GetLayer(spriteManager.GetSprite("front"_h)), 2);
+}
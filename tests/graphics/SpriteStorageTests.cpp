@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include "graphics/SpriteStorage.h"
+#include "graphics/Sprite.h"
+#include <SFML/Graphics/Transformable.hpp>
+#include <memory>
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+using namespace ShoeEngine::Core;
+
+TEST(SpriteStorageTests, CreateStartsWithIdentityTransform) {
+    SpriteStorage storage;
+    const SpriteHandle sprite = storage.Create("hero"_h);
+
+    ASSERT_TRUE(storage.IsValid(sprite));
+    EXPECT_FALSE(sprite.IsNull());
+    EXPECT_EQ(storage.GetName(sprite), "hero"_h);
+    EXPECT_EQ(storage.GetPosition(sprite), std::make_pair(0.0f, 0.0f));
+    EXPECT_EQ(storage.GetRotation(sprite), 0.0f);
+    EXPECT_EQ(storage.GetScale(sprite), std::make_pair(1.0f, 1.0f));
+    EXPECT_EQ(storage.GetOrigin(sprite), std::make_pair(0.0f, 0.0f));
+    EXPECT_EQ(storage.GetTexture(sprite), nullptr);
+    EXPECT_FALSE(storage.IsValid(SpriteHandle()));
+}
+
+TEST(SpriteStorageTests, FieldsLiveInParallelArrays) {
+    SpriteStorage storage;
+    const SpriteHandle a = storage.Create("a"_h);
+    const SpriteHandle b = storage.Create("b"_h);
+    storage.SetPosition(a, 1.0f, 2.0f);
+    storage.SetPosition(b, 3.0f, 4.0f);
+    storage.Move(b, 1.0f, 1.0f);
+    storage.SetScale(b, 2.0f, 3.0f);
+
+    ASSERT_EQ(storage.GetSlotCount(), 2);
+    EXPECT_EQ(storage.GetPositionsX()[a.index], 1.0f);
+    EXPECT_EQ(storage.GetPositionsY()[a.index], 2.0f);
+    EXPECT_EQ(storage.GetPositionsX()[b.index], 4.0f);
+    EXPECT_EQ(storage.GetPositionsY()[b.index], 5.0f);
+    EXPECT_EQ(storage.GetScalesX()[b.index], 2.0f);
+    EXPECT_EQ(storage.GetScalesY()[b.index], 3.0f);
+}
+
+TEST(SpriteStorageTests, DestroyedSlotsAreRecycled) {
+    SpriteStorage storage;
+    const SpriteHandle a = storage.Create("a"_h);
+    const SpriteHandle b = storage.Create("b"_h);
+    storage.SetPosition(a, 5.0f, 5.0f);
+
+    EXPECT_TRUE(storage.Destroy(a));
+    EXPECT_FALSE(storage.Destroy(a));
+    EXPECT_FALSE(storage.IsValid(a));
+    EXPECT_FALSE(storage.IsAlive(a.index));
+    EXPECT_EQ(storage.GetCount(), 1);
+
+    // The new sprite takes the freed slot under a new generation, with fresh fields
+    const SpriteHandle c = storage.Create("c"_h);
+    EXPECT_EQ(c.index, a.index);
+    EXPECT_NE(c.generation, a.generation);
+    EXPECT_FALSE(storage.IsValid(a));
+    EXPECT_TRUE(storage.IsValid(b));
+    EXPECT_TRUE(storage.IsValid(c));
+    EXPECT_EQ(storage.GetPosition(c), std::make_pair(0.0f, 0.0f));
+    EXPECT_EQ(storage.GetSlotCount(), 2);
+
+    storage.Clear();
+    EXPECT_EQ(storage.GetCount(), 0);
+    EXPECT_FALSE(storage.IsValid(b));
+    EXPECT_FALSE(storage.IsValid(c));
+}
+
+TEST(SpriteStorageTests, StaleHandlesAreIgnored) {
+    SpriteStorage storage;
+    const SpriteHandle stale = storage.Create("a"_h);
+    ASSERT_TRUE(storage.Destroy(stale));
+    const SpriteHandle reused = storage.Create("b"_h);
+    ASSERT_EQ(reused.index, stale.index);
+    const SpriteHandle outOfRange{ 7, 1 };
+
+    // Setters do nothing, so the sprite now in the slot is untouched
+    for (const SpriteHandle handle : { stale, outOfRange, SpriteHandle() }) {
+        EXPECT_FALSE(storage.SetPosition(handle, 5.0f, 5.0f));
+        EXPECT_FALSE(storage.Move(handle, 1.0f, 1.0f));
+        EXPECT_FALSE(storage.SetRotation(handle, 90.0f));
+        EXPECT_FALSE(storage.SetScale(handle, 2.0f, 2.0f));
+        EXPECT_FALSE(storage.SetOrigin(handle, 1.0f, 1.0f));
+        EXPECT_FALSE(storage.SetLayer(handle, 3));
+        EXPECT_FALSE(storage.SetDepth(handle, 0.5f));
+        EXPECT_FALSE(storage.SetImage(handle, "image"_h, nullptr, sf::IntRect()));
+        EXPECT_FALSE(storage.SetTextureRect(handle, sf::IntRect(0, 0, 4, 4)));
+        EXPECT_FALSE(storage.ResetTransform(handle));
+
+        // Getters return the values of a new sprite
+        EXPECT_EQ(storage.GetPosition(handle), std::make_pair(0.0f, 0.0f));
+        EXPECT_EQ(storage.GetScale(handle), std::make_pair(1.0f, 1.0f));
+        EXPECT_EQ(storage.GetName(handle), Hash::HashValue());
+        EXPECT_EQ(storage.GetTexture(handle), nullptr);
+        EXPECT_EQ(storage.GetLayer(handle), 0);
+    }
+    EXPECT_EQ(storage.GetName(reused), "b"_h);
+    EXPECT_EQ(storage.GetPosition(reused), std::make_pair(0.0f, 0.0f));
+    EXPECT_EQ(storage.GetRotation(reused), 0.0f);
+    EXPECT_EQ(storage.GetLayer(reused), 0);
+
+    // Only sprites with a texture can change their rectangle
+    EXPECT_FALSE(storage.SetTextureRect(reused, sf::IntRect(0, 0, 4, 4)));
+}
+
+TEST(SpriteStorageTests, TransformMatchesSfmlTransformable) {
+    SpriteStorage storage;
+    const SpriteHandle sprite = storage.Create("sprite"_h);
+    storage.SetPosition(sprite, 100.0f, -20.0f);
+    storage.SetRotation(sprite, -30.0f);
+    storage.SetScale(sprite, 2.0f, 0.5f);
+    storage.SetOrigin(sprite, 8.0f, 4.0f);
+
+    sf::Transformable expected;
+    expected.setPosition(100.0f, -20.0f);
+    expected.setRotation(-30.0f);
+    expected.setScale(2.0f, 0.5f);
+    expected.setOrigin(8.0f, 4.0f);
+
+    EXPECT_FLOAT_EQ(storage.GetRotation(sprite), expected.getRotation());
+    const sf::Transform actual = storage.GetTransform(sprite.index);
+    const sf::Transform expectedTransform = expected.getTransform();
+    const float* actualMatrix = actual.getMatrix();
+    const float* expectedMatrix = expectedTransform.getMatrix();
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_FLOAT_EQ(actualMatrix[i], expectedMatrix[i]) << "element " << i;
+    }
+}
+
+TEST(SpriteStorageTests, ChangesIncrementCounter) {
+    SpriteStorage storage;
+    uint64_t counter = 0;
+    storage.SetChangeCounter(&counter);
+
+    const SpriteHandle sprite = storage.Create("sprite"_h);
+    const uint64_t created = counter;
+    EXPECT_GT(created, 0);
+    storage.SetRotation(sprite, 10.0f);
+    EXPECT_GT(counter, created);
+
+    const uint64_t rotated = counter;
+    storage.Destroy(sprite);
+    EXPECT_GT(counter, rotated);
+}
+
+TEST(SpriteStorageTests, BulkBoundsMatchSpriteGlobalBounds) {
+    // Enough sprites for full SIMD blocks and a scalar tail, with varied transforms
+    std::vector<uint8_t> pixels(5 * 3 * 4, 255);
+    const Image image(pixels.data(), 5, 3);
+    auto texture = std::make_shared<sf::Texture>();
+    texture->loadFromImage(image.GetSFMLImage());
+
+    SpriteStorage storage;
+    std::vector<std::unique_ptr<Sprite>> sprites;
+    for (int i = 0; i < 37; ++i) {
+        const float x = static_cast<float>(i * 13 % 200) - 50.0f;
+        const float y = static_cast<float>(i * 7 % 90);
+        const float angle = static_cast<float>(i * 37 % 720) - 360.0f;
+        const float scaleX = (i % 3 == 0 ? -1.0f : 1.0f) * (0.5f + static_cast<float>(i % 4));
+        const float scaleY = 0.25f + static_cast<float>(i % 5) * 0.5f;
+        const float originX = static_cast<float>(i % 5);
+        const float originY = static_cast<float>(i % 3);
+
+        const SpriteHandle handle = storage.Create(static_cast<uint32_t>(i + 1));
+        storage.SetImage(handle, "image"_h, texture, sf::IntRect(0, 0, 5, 3));
+        storage.SetPosition(handle, x, y);
+        storage.SetRotation(handle, angle);
+        storage.SetScale(handle, scaleX, scaleY);
+        storage.SetOrigin(handle, originX, originY);
+
+        auto sprite = std::make_unique<Sprite>(image, texture);
+        sprite->SetPosition(x, y);
+        sprite->SetRotation(angle);
+        sprite->SetScale(scaleX, scaleY);
+        sprite->SetOrigin(originX, originY);
+        sprites.push_back(std::move(sprite));
+    }
+
+    EXPECT_EQ(storage.UpdateTransforms(), sprites.size());
+    for (size_t i = 0; i < sprites.size(); ++i) {
+        const sf::FloatRect bounds = storage.GetGlobalBounds(storage.GetHandle(i));
+        const auto [left, top, width, height] = sprites[i]->GetGlobalBounds();
+        EXPECT_NEAR(bounds.left, left, 1e-3f) << "sprite " << i;
+        EXPECT_NEAR(bounds.top, top, 1e-3f) << "sprite " << i;
+        EXPECT_NEAR(bounds.width, width, 1e-3f) << "sprite " << i;
+        EXPECT_NEAR(bounds.height, height, 1e-3f) << "sprite " << i;
+
+        const sf::Transform cached = storage.GetWorldTransform(i);
+        const sf::Transform computed = storage.GetTransform(i);
+        for (int element = 0; element < 16; ++element) {
+            EXPECT_NEAR(cached.getMatrix()[element], computed.getMatrix()[element], 1e-4f);
+        }
+    }
+}
+
+TEST(SpriteStorageTests, UpdateSkipsCleanSprites) {
+    SpriteStorage storage;
+    std::vector<SpriteHandle> handles;
+    for (int i = 0; i < 64; ++i) {
+        handles.push_back(storage.Create(static_cast<uint32_t>(i + 1)));
+    }
+    EXPECT_EQ(storage.UpdateTransforms(), 64);
+    EXPECT_EQ(storage.UpdateTransforms(), 0);
+
+    // Only the block holding the moved sprite is recomputed
+    storage.Move(handles[40], 3.0f, 4.0f);
+    EXPECT_TRUE(storage.IsDirty(40));
+    const size_t updated = storage.UpdateTransforms();
+    EXPECT_GE(updated, 1);
+    EXPECT_LE(updated, 8);
+    EXPECT_FALSE(storage.IsDirty(40));
+    EXPECT_EQ(storage.GetBoundsLeft()[40], 3.0f);
+    EXPECT_EQ(storage.GetBoundsTop()[40], 4.0f);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "graphics/TextureCache.h"
+#include "graphics/Sprite.h"
+#include "core/Hash.h"
+#include <vector>
+
+using namespace ShoeEngine::Graphics;
+using namespace ShoeEngine::Core;
+
+class TextureCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::vector<uint8_t> pixels(4 * 4 * 4, 255); // 4x4 white image
+        imageA = Image(pixels.data(), 4, 4);
+        imageA.SetId("image_a"_h);
+        imageB = Image(pixels.data(), 2, 2);
+        imageB.SetId("image_b"_h);
+    }
+
+    TextureCache cache;
+    Image imageA;
+    Image imageB;
+};
+
+TEST_F(TextureCacheTests, EmptyCache) {
+    EXPECT_EQ(cache.GetTextureCount(), 0);
+    EXPECT_EQ(cache.GetUploadCount(), 0);
+    EXPECT_EQ(cache.GetUploadedBytes(), 0);
+    EXPECT_EQ(cache.Find("image_a"_h), nullptr);
+}
+
+TEST_F(TextureCacheTests, AcquireUploadsOnce) {
+    auto first = cache.Acquire(imageA);
+    auto second = cache.Acquire(imageA);
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(cache.GetUploadCount(), 1);
+    EXPECT_EQ(cache.GetUploadedBytes(), 4 * 4 * 4);
+    EXPECT_EQ(cache.GetResidentBytes(), 4 * 4 * 4);
+    EXPECT_EQ(cache.Find("image_a"_h), first);
+}
+
+TEST_F(TextureCacheTests, DistinctImagesGetDistinctTextures) {
+    auto textureA = cache.Acquire(imageA);
+    auto textureB = cache.Acquire(imageB);
+
+    EXPECT_NE(textureA, textureB);
+    EXPECT_EQ(cache.GetTextureCount(), 2);
+    EXPECT_EQ(cache.GetUploadCount(), 2);
+    EXPECT_EQ(cache.GetUploadedBytes(), 4 * 4 * 4 + 2 * 2 * 4);
+}
+
+TEST_F(TextureCacheTests, InvalidateForcesReupload) {
+    auto first = cache.Acquire(imageA);
+    cache.Invalidate("image_a"_h);
+    EXPECT_EQ(cache.Find("image_a"_h), nullptr);
+    EXPECT_EQ(cache.GetResidentBytes(), 0);
+
+    auto second = cache.Acquire(imageA);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(cache.GetUploadCount(), 2);
+}
+
+TEST_F(TextureCacheTests, ReplacedImageIsReuploaded) {
+    auto first = cache.Acquire(imageA);
+
+    std::vector<uint8_t> pixels(8 * 8 * 4, 0);
+    Image replacement(pixels.data(), 8, 8);
+    replacement.SetId("image_a"_h);
+
+    auto second = cache.Acquire(replacement);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(cache.GetTextureCount(), 1);
+    EXPECT_EQ(cache.GetResidentBytes(), 8 * 8 * 4);
+}
+
+TEST_F(TextureCacheTests, EmptyImageIsNotCached) {
+    Image empty;
+    empty.SetId("empty"_h);
+    EXPECT_EQ(cache.Acquire(empty), nullptr);
+    EXPECT_EQ(cache.GetTextureCount(), 0);
+    EXPECT_EQ(cache.GetUploadCount(), 0);
+}
+
+TEST_F(TextureCacheTests, ClearKeepsHandedOutTexturesAlive) {
+    Sprite sprite(imageA, cache.Acquire(imageA));
+    cache.Clear();
+
+    EXPECT_EQ(cache.GetTextureCount(), 0);
+    ASSERT_NE(sprite.GetTexture(), nullptr);
+    auto [left, top, width, height] = sprite.GetLocalBounds();
+    EXPECT_FLOAT_EQ(width, 4.0f);
+    EXPECT_FLOAT_EQ(height, 4.0f);
+}
+
+TEST_F(TextureCacheTests, SpritesShareTexture) {
+    Sprite first(imageA, cache.Acquire(imageA));
+    Sprite second(imageA, cache.Acquire(imageA));
+
+    EXPECT_EQ(first.GetTexture(), second.GetTexture());
+    EXPECT_EQ(cache.GetUploadCount(), 1);
+}
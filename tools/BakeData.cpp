@@ -0,0 +1,66 @@
+/**
+ * @file BakeData.cpp
+ * @brief Command-line tool that bakes a JSON data file into the binary format read by
+ *        DataManager::LoadFromBakedFile
+ *
+ * Usage: ShoeEngine_bake <input.json> <output.bake>
+ */
+
+#include <iostream>
+#include <fstream>
+#include "core/DataManager.h"
+#include "graphics/WindowManager.h"
+#include "graphics/ImageManager.h"
+#include "graphics/SpriteManager.h"
+#include "graphics/AnimationManager.h"
+#include "bayou/BayouStateManager.h"
+#include "Input/InputManager.h"
+
+using namespace ShoeEngine;
+
+int main(int argc, char* argv[]) {
+	if (argc != 3) {
+		std::cerr << "Usage: " << argv[0] << " <input.json> <output.bake>" << std::endl;
+		return 1;
+	}
+
+	try {
+		std::ifstream file(argv[1]);
+		if (!file.is_open()) {
+			std::cerr << "Failed to open " << argv[1] << std::endl;
+			return 1;
+		}
+		nlohmann::json jsonData = nlohmann::json::parse(file);
+
+		// Stored in the baked file, so the engine can tell when the JSON changed since.
+		Core::Hash::HashValue64 sourceHash;
+		if (!Core::Hash::HashFile(argv[1], sourceHash)) {
+			std::cerr << "Failed to hash " << argv[1] << std::endl;
+			return 1;
+		}
+
+		// Register the same managers as the engine; baking only reads the JSON, no files are loaded.
+		Core::DataManager dataManager;
+		auto imageManager = std::make_unique<Graphics::ImageManager>(dataManager);
+		auto spriteManager = std::make_unique<Graphics::SpriteManager>(dataManager, *imageManager);
+		auto animationManager = std::make_unique<Graphics::AnimationManager>(dataManager, *imageManager, *spriteManager);
+		dataManager.RegisterManager(std::make_unique<Graphics::WindowManager>(dataManager));
+		dataManager.RegisterManager(std::move(imageManager));
+		dataManager.RegisterManager(std::move(spriteManager));
+		dataManager.RegisterManager(std::move(animationManager));
+		dataManager.RegisterManager(std::make_unique<Bayou::BayouStateManager>(dataManager));
+		dataManager.RegisterManager(std::make_unique<Input::InputManager>(dataManager));
+
+		if (!dataManager.BakeToFile(jsonData, argv[2], sourceHash)) {
+			std::cerr << "Failed to bake " << argv[1] << " into " << argv[2] << std::endl;
+			return 1;
+		}
+
+		std::cout << "Baked " << argv[1] << " into " << argv[2] << std::endl;
+		return 0;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		return 1;
+	}
+}